@@ -121,8 +121,13 @@
  */
 #define OMPI_DATATYPE_MPI_FLOAT128                0x34
 
+/*
+ * Brain floating point (bfloat16), exposed through the shortfloat extension.
+ */
+#define OMPI_DATATYPE_MPI_BFLOAT16                0x35
+
 /* This should __ALWAYS__ stay last  */
-#define OMPI_DATATYPE_MPI_UNAVAILABLE             0x35
+#define OMPI_DATATYPE_MPI_UNAVAILABLE             0x36
 
 
 #define OMPI_DATATYPE_MPI_MAX_PREDEFINED          (OMPI_DATATYPE_MPI_UNAVAILABLE+1)
@@ -624,6 +629,9 @@ extern const ompi_datatype_t* ompi_datatype_basicDatatypes[OMPI_DATATYPE_MPI_MAX
 
 #define OMPI_DATATYPE_INITIALIZER_WCHAR               OPAL_DATATYPE_INITIALIZER_WCHAR
 
+/* There is no bfloat16 in OPAL: move it around as its 16 bits representation */
+#define OMPI_DATATYPE_INITIALIZER_BFLOAT16            OPAL_DATATYPE_INITIALIZER_UINT2
+
 #define OMPI_DATATYPE_INITIALIZER_C_SHORT_FLOAT_COMPLEX OPAL_DATATYPE_INITIALIZER_SHORT_FLOAT_COMPLEX
 #define OMPI_DATATYPE_INITIALIZER_C_FLOAT_COMPLEX       OPAL_DATATYPE_INITIALIZER_FLOAT_COMPLEX
 #define OMPI_DATATYPE_INITIALIZER_C_DOUBLE_COMPLEX      OPAL_DATATYPE_INITIALIZER_DOUBLE_COMPLEX
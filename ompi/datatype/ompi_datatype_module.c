@@ -103,6 +103,7 @@ ompi_predefined_datatype_t ompi_mpi_short_float =    OMPI_DATATYPE_INIT_PREDEFIN
 #else
 ompi_predefined_datatype_t ompi_mpi_short_float =    OMPI_DATATYPE_INIT_UNAVAILABLE (SHORT_FLOAT, OMPI_DATATYPE_FLAG_DATA_C | OMPI_DATATYPE_FLAG_DATA_FLOAT );
 #endif  /* HAVE_SHORT_FLOAT */
+ompi_predefined_datatype_t ompi_mpi_bfloat16 =       OMPI_DATATYPE_INIT_PREDEFINED (BFLOAT16, OMPI_DATATYPE_FLAG_DATA_C | OMPI_DATATYPE_FLAG_DATA_FLOAT );
 ompi_predefined_datatype_t ompi_mpi_float =          OMPI_DATATYPE_INIT_PREDEFINED (FLOAT, OMPI_DATATYPE_FLAG_DATA_C | OMPI_DATATYPE_FLAG_DATA_FLOAT );
 ompi_predefined_datatype_t ompi_mpi_double =         OMPI_DATATYPE_INIT_PREDEFINED (DOUBLE, OMPI_DATATYPE_FLAG_DATA_C | OMPI_DATATYPE_FLAG_DATA_FLOAT );
 ompi_predefined_datatype_t ompi_mpi_long_double =    OMPI_DATATYPE_INIT_PREDEFINED (LONG_DOUBLE, OMPI_DATATYPE_FLAG_DATA_C | OMPI_DATATYPE_FLAG_DATA_FLOAT );
@@ -400,6 +401,8 @@ const ompi_datatype_t* ompi_datatype_basicDatatypes[OMPI_DATATYPE_MPI_MAX_PREDEF
 
     [OMPI_DATATYPE_MPI_FLOAT128] = &ompi_mpi_real16.dt,
 
+    [OMPI_DATATYPE_MPI_BFLOAT16] = &ompi_mpi_bfloat16.dt,
+
     [OMPI_DATATYPE_MPI_UNAVAILABLE] = &ompi_mpi_unavailable.dt,
 };
 
@@ -684,6 +687,9 @@ int32_t ompi_datatype_init( void )
     /* Datatype added in MPI 5.0 */
     MOOG(logical16, 77);
 
+    /* bfloat16, exposed by the shortfloat extension */
+    MOOG(bfloat16, 78);
+
     /**
      * Now make sure all non-contiguous types are marked as such.
      */
@@ -76,6 +76,10 @@ static inline ucc_datatype_t ompi_dtype_to_ucc_dtype(ompi_datatype_t *dtype)
     int ompi_type_id = dtype->id;
     int opal_type_id = dtype->super.id;
 
+    /* bfloat16 travels as UINT2 in OPAL, which is not what UCC should reduce */
+    if (OMPI_DATATYPE_MPI_BFLOAT16 == ompi_type_id) {
+        return COLL_UCC_DT_UNSUPPORTED;
+    }
     if (ompi_type_id < OMPI_DATATYPE_MPI_MAX_PREDEFINED &&
         dtype->super.flags & OMPI_DATATYPE_FLAG_PREDEFINED) {
         if (opal_type_id > 0 && opal_type_id < OPAL_DATATYPE_MAX_PREDEFINED) {
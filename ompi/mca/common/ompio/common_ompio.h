@@ -134,6 +134,9 @@ typedef struct mca_common_ompio_access_array_t{
 
 /* forward declaration to keep the compiler happy. */
 struct ompio_file_t;
+typedef struct mca_common_ompio_write_cache_t mca_common_ompio_write_cache_t;
+typedef struct mca_common_ompio_readahead_t mca_common_ompio_readahead_t;
+typedef struct mca_common_ompio_trace_t mca_common_ompio_trace_t;
 typedef int (*mca_common_ompio_generate_current_file_view_fn_t) (struct ompio_file_t *fh,
 							         size_t max_data,
 							         struct iovec **f_iov,
@@ -195,6 +198,14 @@ struct ompio_file_t {
        Note: Neither f_sharedfp nor f_sharedfp_component seemed appropriate for this.
     */
     void                  *f_sharedfp_data;
+    /* Place for the selected fbtl module to hang its per file data */
+    void                  *f_fbtl_data;
+    /* write-behind cache of small independent writes, allocated on first use */
+    mca_common_ompio_write_cache_t *f_write_cache;
+    /* read-ahead state and prefetched window, allocated on first use */
+    mca_common_ompio_readahead_t *f_readahead;
+    /* I/O statistics, only allocated when tracing is enabled */
+    mca_common_ompio_trace_t *f_trace;
 
     /* File View parameters */
     struct ompio_fview_t   f_fview;
@@ -229,6 +240,10 @@ struct ompio_file_t {
     int  f_init_procs_per_group;
     int *f_init_procs_in_group;
 
+    /* node and NUMA domain of each process, used for the topology aware
+       placement of the aggregators. Allocated on first use. */
+    int *f_locality;
+
     /* final of aggregators and groups*/
     int *f_aggr_list;
     int  f_num_aggrs;
@@ -329,6 +344,34 @@ OMPI_DECLSPEC int mca_common_ompio_create_incomplete_file_handle (const char *fi
                                                                   ompio_file_t **fh);
 
 OMPI_DECLSPEC int mca_common_ompio_file_close (ompio_file_t *ompio_fh);
+
+/* Write-behind cache of small independent writes */
+int mca_common_ompio_write_cache_write (ompio_file_t *fh, const void *buf, size_t count,
+                                        struct ompi_datatype_t *datatype,
+                                        ompi_status_public_t *status);
+OMPI_DECLSPEC int mca_common_ompio_write_cache_flush (ompio_file_t *fh);
+int mca_common_ompio_write_cache_check (ompio_file_t *fh);
+void mca_common_ompio_write_cache_free (ompio_file_t *fh);
+
+/* Read-ahead for sequential and strided reads */
+int mca_common_ompio_readahead_read (ompio_file_t *fh, void *buf, size_t count,
+                                     struct ompi_datatype_t *datatype, bool eligible,
+                                     bool collective, ompi_status_public_t *status);
+OMPI_DECLSPEC void mca_common_ompio_readahead_invalidate (ompio_file_t *fh);
+void mca_common_ompio_readahead_free (ompio_file_t *fh);
+OMPI_DECLSPEC extern unsigned long mca_common_ompio_readahead_hits;
+OMPI_DECLSPEC extern unsigned long mca_common_ompio_readahead_misses;
+OMPI_DECLSPEC extern unsigned long mca_common_ompio_readahead_bytes;
+
+/* Per-file I/O tracing */
+#define OMPIO_TRACE_READ  0
+#define OMPIO_TRACE_WRITE 1
+int mca_common_ompio_trace_init (ompio_file_t *fh);
+void mca_common_ompio_trace_begin (ompio_file_t *fh);
+void mca_common_ompio_trace_end (ompio_file_t *fh, int type, bool collective,
+                                 size_t count, struct ompi_datatype_t *datatype);
+void mca_common_ompio_trace_finalize (ompio_file_t *fh);
+
 OMPI_DECLSPEC int mca_common_ompio_file_get_size (ompio_file_t *ompio_fh, OMPI_MPI_OFFSET_TYPE *size);
 OMPI_DECLSPEC int mca_common_ompio_file_get_position (ompio_file_t *fh,OMPI_MPI_OFFSET_TYPE *offset);
 OMPI_DECLSPEC int mca_common_ompio_set_explicit_offset (ompio_file_t *fh, OMPI_MPI_OFFSET_TYPE offset);
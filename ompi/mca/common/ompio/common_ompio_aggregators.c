@@ -40,6 +40,7 @@
 #include "ompi/request/request.h"
 
 #include <math.h>
+#include <stdlib.h>
 #include <unistd.h>
 
 #include "common_ompio.h"
@@ -54,6 +55,9 @@
 ** 2. fview_based_grouping: analysis the fileview to detect regular patterns
 ** 3. cart_based_grouping: uses a cartesian communicator to derive certain (probable) properties
 **    of the access pattern
+**
+** Once the number of aggregators is known, topology_grouping can be used to place them
+** evenly across the nodes and NUMA domains of the processes.
 */
 
 static double cost_calc (int P, int P_agg, size_t Data_proc, size_t coll_buffer, int dim );
@@ -184,6 +188,7 @@ int mca_common_ompio_simple_grouping(ompio_file_t *fh,
     if ( 1 >= num_groups ) {
 	num_groups = 1;
     }
+    num_groups = mca_common_ompio_stripe_aware_num_aggregators (fh, num_groups);
     
     *num_groups_out = num_groups;
 
@@ -199,6 +204,11 @@ int  mca_common_ompio_forced_grouping ( ompio_file_t *fh,
     int flag = OMPI_COMM_IS_MAPBY_NODE (&ompi_mpi_comm_world.comm);
     int k=0, p=0, g=0;
 
+    if ( 1 == OMPIO_MCA_GET(fh, aggregator_placement) &&
+         OMPI_SUCCESS == mca_common_ompio_topology_grouping (fh, num_groups, contg_groups) ) {
+        return OMPI_SUCCESS;
+    }
+
     for ( k=0, p=0; p<num_groups; p++ ) {
         if ( p < rest ) {
             contg_groups[p].procs_per_contg_group = group_size+1;
@@ -225,6 +235,279 @@ int  mca_common_ompio_forced_grouping ( ompio_file_t *fh,
     return OMPI_SUCCESS;
 }
 
+/*
+** Sort key for the processes in topology_grouping: compared lexicographically.
+*/
+typedef struct {
+    int rank;
+    int key[3];
+} ompio_locality_key_t;
+
+static int locality_key_cmp (const void *a, const void *b)
+{
+    const ompio_locality_key_t *ka = (const ompio_locality_key_t *) a;
+    const ompio_locality_key_t *kb = (const ompio_locality_key_t *) b;
+    int i;
+
+    for ( i=0; i<3; i++ ) {
+        if ( ka->key[i] != kb->key[i] ) {
+            return ( ka->key[i] < kb->key[i] ) ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+/*
+** Determine for every process of the file communicator the lowest rank on
+** its node and the lowest rank in its NUMA domain. The result is stored in
+** fh->f_locality as pairs, and reused by subsequent calls.
+*/
+static int get_locality (ompio_file_t *fh)
+{
+    ompi_communicator_t *node_comm = NULL, *numa_comm = NULL;
+    int mine[2];
+    int ret;
+
+    if ( NULL != fh->f_locality ) {
+        return OMPI_SUCCESS;
+    }
+
+    ret = ompi_comm_split_type (fh->f_comm, MPI_COMM_TYPE_SHARED, 0, NULL, &node_comm);
+    if ( OMPI_SUCCESS != ret ) {
+        return ret;
+    }
+    mine[0] = fh->f_rank;
+    ret = node_comm->c_coll->coll_allreduce (MPI_IN_PLACE, &mine[0], 1, MPI_INT, MPI_MIN,
+                                             node_comm, node_comm->c_coll->coll_allreduce_module);
+    if ( OMPI_SUCCESS != ret ) {
+        goto exit;
+    }
+
+    /* Without information about the NUMA domains, the whole node is
+    ** considered to be one domain */
+    mine[1] = mine[0];
+    ret = ompi_comm_split_type (node_comm, OMPI_COMM_TYPE_NUMA, 0, NULL, &numa_comm);
+    if ( OMPI_SUCCESS == ret && NULL != numa_comm && MPI_COMM_NULL != numa_comm ) {
+        mine[1] = fh->f_rank;
+        ret = numa_comm->c_coll->coll_allreduce (MPI_IN_PLACE, &mine[1], 1, MPI_INT, MPI_MIN,
+                                                 numa_comm, numa_comm->c_coll->coll_allreduce_module);
+        ompi_comm_free (&numa_comm);
+        if ( OMPI_SUCCESS != ret ) {
+            goto exit;
+        }
+    }
+
+    fh->f_locality = (int *) malloc ( 2 * fh->f_size * sizeof(int));
+    if ( NULL == fh->f_locality ) {
+        ret = OMPI_ERR_OUT_OF_RESOURCE;
+        goto exit;
+    }
+    ret = fh->f_comm->c_coll->coll_allgather (mine, 2, MPI_INT,
+                                              fh->f_locality, 2, MPI_INT,
+                                              fh->f_comm,
+                                              fh->f_comm->c_coll->coll_allgather_module);
+    if ( OMPI_SUCCESS != ret ) {
+        free (fh->f_locality);
+        fh->f_locality = NULL;
+    }
+
+exit:
+    ompi_comm_free (&node_comm);
+    return ret;
+}
+
+/*
+** Build num_groups groups whose aggregators are spread evenly across the
+** nodes, and within a node across the NUMA domains. The aggregators are
+** picked round-robin over the nodes, and on each node round-robin over
+** its NUMA domains. The other processes join a group whose aggregator
+** is on the same node whenever possible. The group sizes are the same
+** as with forced_grouping.
+*/
+int mca_common_ompio_topology_grouping (ompio_file_t *fh,
+                                        int num_groups,
+                                        mca_common_ompio_contg *contg_groups)
+{
+    int group_size = fh->f_size / num_groups;
+    int rest = fh->f_size % num_groups;
+    ompio_locality_key_t *keys = NULL;
+    int *node_index = NULL, *domain_index = NULL, *counter = NULL, *group_of = NULL;
+    int *node_groups = NULL, *node_groups_start = NULL, *capacity = NULL;
+    int nnodes = 0, r, n, p = 0, i, ret;
+
+    ret = get_locality (fh);
+    if ( OMPI_SUCCESS != ret ) {
+        return ret;
+    }
+
+    keys         = (ompio_locality_key_t *) malloc (fh->f_size * sizeof(ompio_locality_key_t));
+    node_index   = (int *) malloc (fh->f_size * sizeof(int));
+    domain_index = (int *) malloc (fh->f_size * sizeof(int));
+    counter      = (int *) calloc (fh->f_size, sizeof(int));
+    group_of     = (int *) malloc (fh->f_size * sizeof(int));
+    node_groups  = (int *) malloc (num_groups * sizeof(int));
+    node_groups_start = (int *) calloc (fh->f_size + 1, sizeof(int));
+    capacity     = (int *) malloc (num_groups * sizeof(int));
+    if ( NULL == keys || NULL == node_index || NULL == domain_index || NULL == counter ||
+         NULL == group_of || NULL == node_groups || NULL == node_groups_start ||
+         NULL == capacity ) {
+        ret = OMPI_ERR_OUT_OF_RESOURCE;
+        goto exit;
+    }
+
+    /* Number the nodes and the NUMA domains of each node in the order of
+    ** their lowest rank. Leaders are ranks, so they can be used as indexes. */
+    for ( r=0; r<fh->f_size; r++ ) {
+        int node   = fh->f_locality[2*r];
+        int domain = fh->f_locality[2*r+1];
+
+        if ( node == r ) {
+            node_index[r] = nnodes++;
+        }
+        if ( domain == r ) {
+            /* counter[] of a node leader counts the domains of the node */
+            domain_index[r] = counter[node]++;
+        }
+    }
+    memset (counter, 0, fh->f_size * sizeof(int));
+
+    /* Position of each process in its NUMA domain */
+    for ( r=0; r<fh->f_size; r++ ) {
+        int domain = fh->f_locality[2*r+1];
+
+        keys[r].rank   = r;
+        keys[r].key[0] = node_index[fh->f_locality[2*r]];
+        keys[r].key[1] = counter[domain]++;
+        keys[r].key[2] = domain_index[domain];
+    }
+
+    /* Order the processes of each node by interleaving its NUMA domains,
+    ** and then interleave the nodes. */
+    qsort (keys, fh->f_size, sizeof(ompio_locality_key_t), locality_key_cmp);
+    for ( i=0, n=-1; i<fh->f_size; i++ ) {
+        if ( keys[i].key[0] != n ) {
+            n = keys[i].key[0];
+            p = 0;
+        }
+        keys[i].key[1] = keys[i].key[0];
+        keys[i].key[0] = p++;
+        keys[i].key[2] = 0;
+    }
+    qsort (keys, fh->f_size, sizeof(ompio_locality_key_t), locality_key_cmp);
+
+    /* The first num_groups processes of that order become the aggregators */
+    for ( r=0; r<fh->f_size; r++ ) {
+        group_of[r] = -1;
+    }
+    for ( p=0; p<num_groups; p++ ) {
+        r = keys[p].rank;
+        group_of[r] = p;
+        contg_groups[p].procs_in_contg_group[0] = r;
+        contg_groups[p].procs_per_contg_group   = 1;
+        capacity[p] = ( p < rest ) ? group_size : group_size - 1;
+        node_groups_start[node_index[fh->f_locality[2*r]] + 1]++;
+    }
+    for ( n=0; n<nnodes; n++ ) {
+        node_groups_start[n+1] += node_groups_start[n];
+    }
+    memset (counter, 0, nnodes * sizeof(int));
+    for ( p=0; p<num_groups; p++ ) {
+        n = node_index[fh->f_locality[2*keys[p].rank]];
+        node_groups[node_groups_start[n] + counter[n]++] = p;
+    }
+
+    /* Fill the groups of each node with the processes of that node, in
+    ** rank order, and put the processes that are left in the groups that
+    ** still have room */
+    memset (counter, 0, nnodes * sizeof(int));
+    for ( r=0; r<fh->f_size; r++ ) {
+        if ( -1 != group_of[r] ) {
+            continue;
+        }
+        n = node_index[fh->f_locality[2*r]];
+        while ( node_groups_start[n] + counter[n] < node_groups_start[n+1] &&
+                0 == capacity[node_groups[node_groups_start[n] + counter[n]]] ) {
+            counter[n]++;
+        }
+        if ( node_groups_start[n] + counter[n] < node_groups_start[n+1] ) {
+            p = node_groups[node_groups_start[n] + counter[n]];
+            contg_groups[p].procs_in_contg_group[contg_groups[p].procs_per_contg_group++] = r;
+            capacity[p]--;
+            group_of[r] = p;
+        }
+    }
+    for ( r=0, p=0; r<fh->f_size; r++ ) {
+        if ( -1 != group_of[r] ) {
+            continue;
+        }
+        while ( 0 == capacity[p] ) {
+            p++;
+        }
+        contg_groups[p].procs_in_contg_group[contg_groups[p].procs_per_contg_group++] = r;
+        capacity[p]--;
+        group_of[r] = p;
+    }
+
+exit:
+    free (keys);
+    free (node_index);
+    free (domain_index);
+    free (counter);
+    free (group_of);
+    free (node_groups);
+    free (node_groups_start);
+    free (capacity);
+    return ret;
+}
+
+/*
+** On striped file systems, use as many aggregators as there are stripes,
+** or a divisor of the stripe count if fewer aggregators were requested,
+** such that every storage target can be assigned to a single aggregator.
+*/
+int mca_common_ompio_stripe_aware_num_aggregators (ompio_file_t *fh, int num_groups)
+{
+    int n;
+
+    if ( 1 != OMPIO_MCA_GET(fh, stripe_aware_aggregators) || 1 >= fh->f_stripe_count ) {
+        return num_groups;
+    }
+
+    n = ( num_groups < fh->f_stripe_count ) ? num_groups : fh->f_stripe_count;
+    if ( n > fh->f_size ) {
+        n = fh->f_size;
+    }
+    while ( n > 1 && 0 != (fh->f_stripe_count % n) ) {
+        n--;
+    }
+    return n;
+}
+
+/*
+** Adjust the size of the file domains, which are assigned round-robin to
+** the aggregators, to the stripe layout of the file. If the number of
+** aggregators divides the stripe count, every aggregator owns the same
+** stripe_count/num_aggregators storage targets for the whole file.
+** Otherwise the domains are at least aligned to stripe boundaries.
+*/
+long mca_common_ompio_stripe_aligned_domain (ompio_file_t *fh, int num_aggregators,
+                                             long domain_size)
+{
+    long stripe_size = (long) fh->f_stripe_size;
+
+    if ( 1 != OMPIO_MCA_GET(fh, stripe_aware_aggregators) || 0 >= stripe_size ) {
+        return domain_size;
+    }
+
+    if ( 1 < fh->f_stripe_count && 0 == (fh->f_stripe_count % num_aggregators) ) {
+        return stripe_size * (fh->f_stripe_count / num_aggregators);
+    }
+    if ( domain_size < stripe_size ) {
+        return stripe_size;
+    }
+    return ((domain_size + stripe_size - 1) / stripe_size) * stripe_size;
+}
+
 int mca_common_ompio_fview_based_grouping(ompio_file_t *fh,
                      		          int *num_groups,
 				          mca_common_ompio_contg *contg_groups)
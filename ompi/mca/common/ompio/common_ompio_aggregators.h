@@ -65,6 +65,14 @@ int mca_common_ompio_fview_based_grouping(ompio_file_t *fh, int *num_groups,
 int mca_common_ompio_simple_grouping(ompio_file_t *fh, int *num_groups,
                                      mca_common_ompio_contg *contg_groups);
 
+int mca_common_ompio_topology_grouping(ompio_file_t *fh, int num_groups,
+                                       mca_common_ompio_contg *contg_groups);
+
+int mca_common_ompio_stripe_aware_num_aggregators(ompio_file_t *fh, int num_groups);
+
+OMPI_DECLSPEC long mca_common_ompio_stripe_aligned_domain(ompio_file_t *fh, int num_aggregators,
+                                                          long domain_size);
+
 int mca_common_ompio_finalize_initial_grouping(ompio_file_t *fh,  int num_groups,
                                                mca_common_ompio_contg *contg_groups);
 
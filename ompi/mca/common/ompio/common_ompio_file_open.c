@@ -147,11 +147,15 @@ int mca_common_ompio_file_open (ompi_communicator_t *comm,
         opal_output(1, "mca_fs_base_file_select() failed\n");
         goto fn_fail;
     }
+    ompio_fh->f_fbtl_data = NULL;
     if (OMPI_SUCCESS != (ret = mca_fbtl_base_file_select (ompio_fh,
                                                           NULL))) {
         opal_output(1, "mca_fbtl_base_file_select() failed\n");
         goto fn_fail;
     }
+    if (OMPI_SUCCESS != (ret = mca_common_ompio_trace_init (ompio_fh))) {
+        goto fn_fail;
+    }
 
 
     ompio_fh->f_sharedfp_component = NULL; /*component*/
@@ -261,6 +265,14 @@ int mca_common_ompio_file_close (ompio_file_t *ompio_fh)
         return OMPI_SUCCESS;
     }
 
+    /* cached data has to be in the file before any process returns */
+    if ( NULL != ompio_fh->f_fbtl ) {
+        ret = mca_common_ompio_write_cache_flush (ompio_fh);
+        if ( OMPI_SUCCESS != ret ) {
+            opal_output (1,"mca_common_ompio_file_close: error flushing the write-behind cache \n");
+        }
+    }
+
     ret = ompio_fh->f_comm->c_coll->coll_barrier ( ompio_fh->f_comm, ompio_fh->f_comm->c_coll->coll_barrier_module);
     if ( OMPI_SUCCESS != ret ) {
         /* Not sure what to do */
@@ -294,6 +306,10 @@ int mca_common_ompio_file_close (ompio_file_t *ompio_fh)
         delete_flag = 1;
     }
 
+    mca_common_ompio_write_cache_free (ompio_fh);
+    mca_common_ompio_readahead_free (ompio_fh);
+    mca_common_ompio_trace_finalize (ompio_fh);
+
     /*close the sharedfp file*/
     if( NULL != ompio_fh->f_sharedfp ){
         ret = ompio_fh->f_sharedfp->sharedfp_file_close(ompio_fh);
@@ -340,6 +356,10 @@ int mca_common_ompio_file_close (ompio_file_t *ompio_fh)
         free (ompio_fh->f_init_procs_in_group);
         ompio_fh->f_init_procs_in_group = NULL;
     }
+    if (NULL != ompio_fh->f_locality) {
+        free (ompio_fh->f_locality);
+        ompio_fh->f_locality = NULL;
+    }
     if (NULL != ompio_fh->f_procs_in_group) {
         free (ompio_fh->f_procs_in_group);
         ompio_fh->f_procs_in_group = NULL;
@@ -406,6 +426,10 @@ int mca_common_ompio_file_get_size (ompio_file_t *ompio_fh,
 {
     int ret = OMPI_SUCCESS;
 
+    ret = mca_common_ompio_write_cache_flush (ompio_fh);
+    if (OMPI_SUCCESS != ret) {
+        return ret;
+    }
     ret = ompio_fh->f_fs->fs_file_get_size (ompio_fh, size);
 
     return ret;
@@ -487,6 +511,10 @@ int mca_common_ompio_set_file_defaults (ompio_file_t *fh)
        fh->f_init_aggr_list       = NULL;
        fh->f_num_aggrs            = -1;
        fh->f_aggr_list            = NULL;
+       fh->f_locality             = NULL;
+       fh->f_write_cache          = NULL;
+       fh->f_readahead            = NULL;
+       fh->f_trace                = NULL;
        fh->f_datarep              = NULL;
        
        /*Create a derived datatype for the created iovec */
@@ -72,6 +72,7 @@ int mca_common_ompio_file_read (ompio_file_t *fh,
 {
     bool need_to_copy = false;
     int is_gpu, is_managed;
+    int ret = OMPI_SUCCESS;
 
     if (fh->f_amode & MPI_MODE_WRONLY) {
         return MPI_ERR_ACCESS;
@@ -101,13 +102,21 @@ int mca_common_ompio_file_read (ompio_file_t *fh,
         need_to_copy = true;
     }         
 
+    mca_common_ompio_trace_begin (fh);
     if (need_to_copy) {
-        return mca_common_ompio_file_read_pipelined (fh, buf, count, datatype, status);
+        ret = mca_common_ompio_write_cache_flush (fh);
+        if (OMPI_SUCCESS == ret) {
+            ret = mca_common_ompio_file_read_pipelined (fh, buf, count, datatype, status);
+        }
     } else {
-        return mca_common_ompio_file_read_default (fh, buf, count, datatype, status);
+        ret = mca_common_ompio_readahead_read (fh, buf, count, datatype, true, false, status);
+        if (OMPI_ERR_NOT_AVAILABLE == ret) {
+            ret = mca_common_ompio_file_read_default (fh, buf, count, datatype, status);
+        }
     }
+    mca_common_ompio_trace_end (fh, OMPIO_TRACE_READ, false, count, datatype);
 
-    return OMPI_SUCCESS; //silence compiler
+    return ret;
 }
 
 int mca_common_ompio_file_read_default (ompio_file_t *fh, void *buf,
@@ -149,6 +158,12 @@ int mca_common_ompio_file_read_default (ompio_file_t *fh, void *buf,
 	    goto exit;
 	}
 
+        /* write out cached data that this read would otherwise miss */
+        ret_code = mca_common_ompio_write_cache_check (fh);
+        if (OMPI_SUCCESS != ret_code) {
+            goto exit;
+        }
+
 	ret_code = fh->f_fbtl->fbtl_preadv (fh);
 	if (0 <= ret_code) {
 	    real_bytes_read += (size_t)ret_code;
@@ -419,6 +434,11 @@ int mca_common_ompio_file_iread (ompio_file_t *fh,
         return ret;
     }
 
+    ret = mca_common_ompio_write_cache_flush (fh);
+    if (OMPI_SUCCESS != ret) {
+        return ret;
+    }
+
     mca_common_ompio_request_alloc (&ompio_req, MCA_OMPIO_REQUEST_READ);
 
     if (0 == count || 0 == fh->f_fview.f_iov_count) {
@@ -430,6 +450,8 @@ int mca_common_ompio_file_iread (ompio_file_t *fh,
         return OMPI_SUCCESS;
     }
 
+    /* only the submission of non-blocking operations is timed */
+    mca_common_ompio_trace_begin (fh);
     if (NULL != fh->f_fbtl->fbtl_ipreadv) {
         // This fbtl has support for non-blocking operations
         uint32_t iov_count = 0;
@@ -474,10 +496,12 @@ int mca_common_ompio_file_iread (ompio_file_t *fh,
 	    ompio_req->req_fview = (struct ompio_fview_t *) malloc(sizeof(struct ompio_fview_t));
 	    if (NULL == ompio_req->req_fview) {
 		opal_output(1, "common_ompio: error allocating memory\n");
+                mca_common_ompio_trace_end (fh, OMPIO_TRACE_READ, false, 0, datatype);
 		return OMPI_ERR_OUT_OF_RESOURCE;
 	    }
             ret = mca_common_ompio_fview_duplicate(ompio_req->req_fview, &fh->f_fview);
             if (OMPI_SUCCESS != ret) {
+                mca_common_ompio_trace_end (fh, OMPIO_TRACE_READ, false, 0, datatype);
                 return ret;
             }
             mca_common_ompio_file_get_position (fh, &prev_offset );
@@ -521,6 +545,7 @@ int mca_common_ompio_file_iread (ompio_file_t *fh,
         ompio_req->req_ompi.req_status._ucount = status._ucount;
         ompi_request_complete (&ompio_req->req_ompi, false);
     }
+    mca_common_ompio_trace_end (fh, OMPIO_TRACE_READ, false, count, datatype);
 
     fh->f_num_of_io_entries = 0;
     free (fh->f_io_array);
@@ -633,7 +658,26 @@ int mca_common_ompio_file_read_all (ompio_file_t *fh,
                                     ompi_status_public_t * status)
 {
     int ret = OMPI_SUCCESS;
+    int is_gpu, is_managed;
+    bool eligible;
 
+    ret = mca_common_ompio_write_cache_flush (fh);
+    if (OMPI_SUCCESS != ret) {
+        return ret;
+    }
+
+    mca_common_ompio_trace_begin (fh);
+    /* All processes have to take part in the read-ahead lookup, even
+       those that cannot be served from their window. */
+    mca_common_ompio_check_gpu_buf (fh, buf, &is_gpu, &is_managed);
+    eligible = !(is_gpu && !is_managed) &&
+        (( fh->f_flags & OMPIO_DATAREP_NATIVE ) ||
+         datatype == &ompi_mpi_byte.dt || datatype == &ompi_mpi_char.dt);
+    ret = mca_common_ompio_readahead_read (fh, buf, count, datatype, eligible, true, status);
+    if (OMPI_ERR_NOT_AVAILABLE != ret) {
+        mca_common_ompio_trace_end (fh, OMPIO_TRACE_READ, true, count, datatype);
+        return ret;
+    }
 
     if ( !( fh->f_flags & OMPIO_DATAREP_NATIVE ) &&
          !(datatype == &ompi_mpi_byte.dt  ||
@@ -676,6 +720,7 @@ int mca_common_ompio_file_read_all (ompio_file_t *fh,
                                                 datatype,
                                                 status);
     }
+    mca_common_ompio_trace_end (fh, OMPIO_TRACE_READ, true, count, datatype);
     return ret;
 }
 
@@ -709,6 +754,12 @@ int mca_common_ompio_file_iread_all (ompio_file_t *fp,
 {
     int ret = OMPI_SUCCESS;
 
+    ret = mca_common_ompio_write_cache_flush (fp);
+    if (OMPI_SUCCESS != ret) {
+        return ret;
+    }
+
+    mca_common_ompio_trace_begin (fp);
     if ( NULL != fp->f_fcoll->fcoll_file_iread_all ) {
 	ret = fp->f_fcoll->fcoll_file_iread_all (fp,
 						 buf,
@@ -722,6 +773,7 @@ int mca_common_ompio_file_iread_all (ompio_file_t *fp,
 	   individual non-blocking I/O operations. */
 	ret = mca_common_ompio_file_iread ( fp, buf, count, datatype, request );
     }
+    mca_common_ompio_trace_end (fp, OMPIO_TRACE_READ, true, count, datatype);
 
     return ret;
 }
@@ -84,13 +84,28 @@ int mca_common_ompio_file_write (ompio_file_t *fh,
         need_to_copy = true;
     }         
 
+    mca_common_ompio_readahead_invalidate (fh);
+    mca_common_ompio_trace_begin (fh);
+    if (!need_to_copy) {
+        ret = mca_common_ompio_write_cache_write (fh, buf, count, datatype, status);
+        if (OMPI_ERR_NOT_AVAILABLE != ret) {
+            goto exit;
+        }
+    }
+    ret = mca_common_ompio_write_cache_flush (fh);
+    if (OMPI_SUCCESS != ret) {
+        goto exit;
+    }
+
     if (need_to_copy) {
-        return mca_common_ompio_file_write_pipelined (fh, buf, count, datatype, status);
+        ret = mca_common_ompio_file_write_pipelined (fh, buf, count, datatype, status);
     } else {
-        return mca_common_ompio_file_write_default (fh, buf, count, datatype, status);
+        ret = mca_common_ompio_file_write_default (fh, buf, count, datatype, status);
     }
 
-    return OMPI_SUCCESS; //silence compiler
+ exit:
+    mca_common_ompio_trace_end (fh, OMPIO_TRACE_WRITE, false, count, datatype);
+    return ret;
 }
 
 int mca_common_ompio_file_write_default (ompio_file_t *fh,
@@ -363,6 +378,12 @@ int mca_common_ompio_file_iwrite (ompio_file_t *fh,
         return ret;
     }
 
+    ret = mca_common_ompio_write_cache_flush (fh);
+    if (OMPI_SUCCESS != ret) {
+        return ret;
+    }
+    mca_common_ompio_readahead_invalidate (fh);
+
     mca_common_ompio_request_alloc (&ompio_req, MCA_OMPIO_REQUEST_WRITE);
 
     if (0 == count || 0 == fh->f_fview.f_iov_count) {
@@ -374,6 +395,8 @@ int mca_common_ompio_file_iwrite (ompio_file_t *fh,
         return OMPI_SUCCESS;
     }
 
+    /* only the submission of non-blocking operations is timed */
+    mca_common_ompio_trace_begin (fh);
     if (NULL != fh->f_fbtl->fbtl_ipwritev) {
         /* This fbtl has support for non-blocking operations */
         uint32_t iov_count = 0;
@@ -419,10 +442,12 @@ int mca_common_ompio_file_iwrite (ompio_file_t *fh,
 	    ompio_req->req_fview = (struct ompio_fview_t *) malloc(sizeof(struct ompio_fview_t));
 	    if (NULL == ompio_req->req_fview) {
 		opal_output(1, "common_ompio: error allocating memory\n");
+                mca_common_ompio_trace_end (fh, OMPIO_TRACE_WRITE, false, 0, datatype);
 		return OMPI_ERR_OUT_OF_RESOURCE;
 	    }
             ret = mca_common_ompio_fview_duplicate(ompio_req->req_fview, &fh->f_fview);
             if (OMPI_SUCCESS != ret) {
+                mca_common_ompio_trace_end (fh, OMPIO_TRACE_WRITE, false, 0, datatype);
                 return ret;
             }
             mca_common_ompio_file_get_position (fh, &prev_offset );
@@ -464,6 +489,7 @@ int mca_common_ompio_file_iwrite (ompio_file_t *fh,
         ompio_req->req_ompi.req_status._ucount = status._ucount;
         ompi_request_complete (&ompio_req->req_ompi, false);
     }
+    mca_common_ompio_trace_end (fh, OMPIO_TRACE_WRITE, false, count, datatype);
 
     fh->f_num_of_io_entries = 0;
     free (fh->f_io_array);
@@ -580,6 +606,13 @@ int mca_common_ompio_file_write_all (ompio_file_t *fh,
                                      ompi_status_public_t *status)
 {
     int ret = OMPI_SUCCESS;
+
+    ret = mca_common_ompio_write_cache_flush (fh);
+    if (OMPI_SUCCESS != ret) {
+        return ret;
+    }
+    mca_common_ompio_readahead_invalidate (fh);
+    mca_common_ompio_trace_begin (fh);
     
     if ( !( fh->f_flags & OMPIO_DATAREP_NATIVE ) &&
          !(datatype == &ompi_mpi_byte.dt  ||
@@ -624,6 +657,7 @@ int mca_common_ompio_file_write_all (ompio_file_t *fh,
                                                  datatype,
                                                  status);
     }
+    mca_common_ompio_trace_end (fh, OMPIO_TRACE_WRITE, true, count, datatype);
     return ret;
 }
 
@@ -657,6 +691,13 @@ int mca_common_ompio_file_iwrite_all (ompio_file_t *fp,
 {
     int ret = OMPI_SUCCESS;
 
+    ret = mca_common_ompio_write_cache_flush (fp);
+    if (OMPI_SUCCESS != ret) {
+        return ret;
+    }
+    mca_common_ompio_readahead_invalidate (fp);
+    mca_common_ompio_trace_begin (fp);
+
     if ( NULL != fp->f_fcoll->fcoll_file_iwrite_all ) {
 	ret = fp->f_fcoll->fcoll_file_iwrite_all (fp,
 						  buf,
@@ -670,6 +711,7 @@ int mca_common_ompio_file_iwrite_all (ompio_file_t *fp,
 	   individual non-blocking I/O operations. */
 	ret = mca_common_ompio_file_iwrite ( fp, buf, count, datatype, request );
     }
+    mca_common_ompio_trace_end (fp, OMPIO_TRACE_WRITE, true, count, datatype);
 
     return ret;
 }
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+/*
+ * Read-ahead for sequential and strided read patterns.
+ *
+ * Every read served through this file records the extent of the file it
+ * accesses. Once two consecutive reads either continue each other or are
+ * separated by the same stride, the next window of the file is prefetched
+ * with fbtl_ipreadv into a per-file buffer of readahead_size bytes. A read
+ * that lies entirely within the prefetched window is then copied from the
+ * buffer without accessing the file.
+ *
+ * For collective reads, the processes agree with an allreduce on whether
+ * all of them can be served from their window. If any cannot, all of them
+ * go through the fcoll component as usual.
+ *
+ * The window is dropped on any write to the file through this handle, on
+ * sync, and on changes of the size or the atomicity of the file.
+ * Read-ahead is not used in atomic mode.
+ */
+
+#include "ompi_config.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ompi/communicator/communicator.h"
+#include "ompi/mca/fs/fs.h"
+#include "ompi/mca/fbtl/fbtl.h"
+#include "ompi/op/op.h"
+#include "opal/datatype/opal_datatype.h"
+
+#include "common_ompio.h"
+#include "common_ompio_request.h"
+#include "common_ompio_buffer.h"
+
+struct mca_common_ompio_readahead_t {
+    /* access pattern detection */
+    OMPI_MPI_OFFSET_TYPE last_lo;
+    OMPI_MPI_OFFSET_TYPE last_hi;
+    OMPI_MPI_OFFSET_TYPE stride;
+    bool                 detected;
+    /* prefetched window */
+    char                *buf;
+    size_t               size;
+    OMPI_MPI_OFFSET_TYPE win_lo;
+    OMPI_MPI_OFFSET_TYPE win_hi;
+    ompi_request_t      *req;
+};
+
+unsigned long mca_common_ompio_readahead_hits = 0;
+unsigned long mca_common_ompio_readahead_misses = 0;
+unsigned long mca_common_ompio_readahead_bytes = 0;
+
+static int readahead_wait (mca_common_ompio_readahead_t *ra)
+{
+    int ret;
+
+    if (NULL == ra->req) {
+        return OMPI_SUCCESS;
+    }
+    ret = ompi_request_wait (&ra->req, MPI_STATUS_IGNORE);
+    ra->req = NULL;
+    if (OMPI_SUCCESS != ret) {
+        ra->win_lo = ra->win_hi = 0;
+    }
+    return ret;
+}
+
+void mca_common_ompio_readahead_invalidate (ompio_file_t *fh)
+{
+    mca_common_ompio_readahead_t *ra = fh->f_readahead;
+
+    if (NULL == ra) {
+        return;
+    }
+    /* a pending prefetch cannot be cancelled, and owns the buffer */
+    (void) readahead_wait (ra);
+    ra->win_lo = ra->win_hi = 0;
+    ra->detected = false;
+}
+
+void mca_common_ompio_readahead_free (ompio_file_t *fh)
+{
+    mca_common_ompio_readahead_t *ra = fh->f_readahead;
+
+    if (NULL == ra) {
+        return;
+    }
+    (void) readahead_wait (ra);
+    free (ra->buf);
+    free (ra);
+    fh->f_readahead = NULL;
+}
+
+static void readahead_prefetch (ompio_file_t *fh, mca_common_ompio_readahead_t *ra,
+                                OMPI_MPI_OFFSET_TYPE lo)
+{
+    mca_common_ompio_io_array_t entry, *io_array;
+    mca_ompio_request_t *req = NULL;
+    OMPI_MPI_OFFSET_TYPE file_size = 0;
+    int num_io_entries, ret;
+
+    if (OMPI_SUCCESS != readahead_wait (ra)) {
+        return;
+    }
+    ra->win_lo = ra->win_hi = 0;
+
+    /* Data past the end of the file must not be served from the window,
+     * and cached writes have to be visible to the prefetch. */
+    if (OMPI_SUCCESS != mca_common_ompio_write_cache_flush (fh) ||
+        OMPI_SUCCESS != fh->f_fs->fs_file_get_size (fh, &file_size) ||
+        lo >= file_size) {
+        return;
+    }
+
+    entry.memory_address = ra->buf;
+    entry.offset         = (IOVBASE_TYPE *) (intptr_t) lo;
+    entry.length         = ra->size;
+    if (lo + (OMPI_MPI_OFFSET_TYPE) ra->size > file_size) {
+        entry.length = (size_t) (file_size - lo);
+    }
+
+    mca_common_ompio_request_alloc (&req, MCA_OMPIO_REQUEST_READ);
+    io_array       = fh->f_io_array;
+    num_io_entries = fh->f_num_of_io_entries;
+    fh->f_io_array          = &entry;
+    fh->f_num_of_io_entries = 1;
+    ret = fh->f_fbtl->fbtl_ipreadv (fh, (ompi_request_t *) req);
+    fh->f_io_array          = io_array;
+    fh->f_num_of_io_entries = num_io_entries;
+
+    /* Some fbtl error paths report success but leave the request without a
+     * progress function, it would never complete. The window stays empty
+     * and the read is done without the prefetch. */
+    if (OMPI_SUCCESS != ret || NULL == req->req_progress_fn) {
+        ompi_request_free ((ompi_request_t **) &req);
+        return;
+    }
+
+    mca_common_ompio_register_progress ();
+    ra->req    = (ompi_request_t *) req;
+    ra->win_lo = lo;
+    ra->win_hi = lo + (OMPI_MPI_OFFSET_TYPE) entry.length;
+    mca_common_ompio_readahead_bytes += entry.length;
+}
+
+int mca_common_ompio_readahead_read (ompio_file_t *fh, void *buf, size_t count,
+                                     struct ompi_datatype_t *datatype, bool eligible,
+                                     bool collective, ompi_status_public_t *status)
+{
+    mca_common_ompio_readahead_t *ra = fh->f_readahead;
+    int readahead_size = OMPIO_MCA_GET(fh, readahead_size);
+    mca_common_ompio_io_array_t *io_array = NULL;
+    struct iovec *decoded_iov = NULL;
+    uint32_t iov_count = 0;
+    size_t max_data = 0, tbr = 0, spc = 0;
+    int num_io_entries = 0, i = 0, k, hit = 0, ret = OMPI_SUCCESS;
+    OMPI_MPI_OFFSET_TYPE lo = 0, hi = 0;
+    ompio_fview_t fview;
+
+    if (0 >= readahead_size || fh->f_atomicity || NULL == fh->f_fbtl->fbtl_ipreadv) {
+        return OMPI_ERR_NOT_AVAILABLE;
+    }
+
+    if (NULL == ra) {
+        ra = (mca_common_ompio_readahead_t *) calloc (1, sizeof(mca_common_ompio_readahead_t));
+        if (NULL != ra) {
+            ra->buf  = (char *) malloc (readahead_size);
+            ra->size = readahead_size;
+            if (NULL == ra->buf) {
+                free (ra);
+                ra = NULL;
+            }
+        }
+        fh->f_readahead = ra;
+    }
+    if (NULL == ra) {
+        eligible = false;
+    }
+
+    if (eligible) {
+        size_t type_size;
+
+        opal_datatype_type_size (&datatype->super, &type_size);
+        eligible = (0 < type_size * count && type_size * count <= ra->size);
+    }
+
+    /* Build the file extents of the request, keeping the file view
+     * untouched until we know whether the read is served here. */
+    fview = fh->f_fview;
+    if (eligible) {
+        ret = mca_common_ompio_decode_datatype (fh, datatype, count, buf, &max_data,
+                                                fh->f_mem_convertor, &decoded_iov, &iov_count);
+        if (OMPI_SUCCESS == ret && 0 < max_data) {
+            ret = mca_common_ompio_build_io_array (&fh->f_fview, 0, 1, max_data, max_data,
+                                                   iov_count, decoded_iov, &i, &tbr, &spc,
+                                                   &io_array, &num_io_entries);
+        }
+        if (OMPI_SUCCESS != ret || 0 == num_io_entries) {
+            eligible = false;
+            ret = OMPI_SUCCESS;
+        }
+    }
+
+    if (eligible) {
+        lo = (OMPI_MPI_OFFSET_TYPE) (intptr_t) io_array[0].offset;
+        hi = lo;
+        for (k = 0; k < num_io_entries; k++) {
+            OMPI_MPI_OFFSET_TYPE start = (OMPI_MPI_OFFSET_TYPE) (intptr_t) io_array[k].offset;
+
+            if (start < lo) {
+                lo = start;
+            }
+            if (start + (OMPI_MPI_OFFSET_TYPE) io_array[k].length > hi) {
+                hi = start + (OMPI_MPI_OFFSET_TYPE) io_array[k].length;
+            }
+        }
+        hit = (ra->win_lo <= lo && hi <= ra->win_hi);
+    }
+
+    if (collective) {
+        ret = fh->f_comm->c_coll->coll_allreduce (MPI_IN_PLACE, &hit, 1, MPI_INT, MPI_MIN,
+                                                  fh->f_comm, fh->f_comm->c_coll->coll_allreduce_module);
+        if (OMPI_SUCCESS != ret) {
+            hit = 0;
+        }
+    }
+
+    if (hit) {
+        ret = readahead_wait (ra);
+        if (OMPI_SUCCESS != ret) {
+            goto exit;
+        }
+        for (k = 0; k < num_io_entries; k++) {
+            memcpy (io_array[k].memory_address,
+                    ra->buf + ((OMPI_MPI_OFFSET_TYPE) (intptr_t) io_array[k].offset - ra->win_lo),
+                    io_array[k].length);
+        }
+        mca_common_ompio_readahead_hits++;
+    } else {
+        fh->f_fview = fview;
+        if (eligible) {
+            mca_common_ompio_readahead_misses++;
+        }
+    }
+
+    /* Update the access pattern and prefetch the next window if needed */
+    if (eligible) {
+        OMPI_MPI_OFFSET_TYPE stride = lo - ra->last_lo;
+        OMPI_MPI_OFFSET_TYPE next_lo, next_hi;
+        bool sequential = (lo == ra->last_hi);
+
+        ra->detected = sequential || (0 < stride && stride == ra->stride);
+        ra->stride   = stride;
+        ra->last_lo  = lo;
+        ra->last_hi  = hi;
+
+        /* sequential reads of varying sizes continue at the end of this one */
+        next_lo = sequential ? hi : lo + stride;
+        next_hi = next_lo + (hi - lo);
+        if (ra->detected && 0 < stride && stride < (OMPI_MPI_OFFSET_TYPE) ra->size &&
+            !(ra->win_lo <= next_lo && next_hi <= ra->win_hi)) {
+            readahead_prefetch (fh, ra, next_lo);
+        }
+    } else if (NULL != ra) {
+        ra->detected = false;
+    }
+
+ exit:
+    free (io_array);
+    free (decoded_iov);
+    if (OMPI_SUCCESS != ret) {
+        return ret;
+    }
+    if (!hit) {
+        return OMPI_ERR_NOT_AVAILABLE;
+    }
+    if (MPI_STATUS_IGNORE != status) {
+        status->_ucount = max_data;
+    }
+    return OMPI_SUCCESS;
+}
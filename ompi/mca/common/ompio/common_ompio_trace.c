@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+/*
+ * Lightweight per-file I/O tracing.
+ *
+ * When the io_ompio_trace_filename parameter is set, every file handle
+ * records the number of operations and bytes accessed by the application,
+ * a histogram of the request sizes, the number and total distance of
+ * non-contiguous accesses, and the time spent in the fbtl compared to the
+ * total time of the operations. The fbtl calls are timed by installing a
+ * copy of the selected fbtl module whose data transfer functions wrap the
+ * original ones, so that the accesses issued by the fcoll components on
+ * behalf of other processes are accounted for as well. For collective
+ * operations, the time not spent in the fbtl is mostly communication and
+ * synchronization of the fcoll component.
+ *
+ * The counters of a file are appended to <trace_filename>.<rank>.iotrace
+ * when the file is closed, where rank is the rank in MPI_COMM_WORLD. The
+ * ompio_trace2summary.pl script aggregates the logs of all processes.
+ */
+
+#include "ompi_config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "opal/mca/base/mca_base_var.h"
+#include "opal/util/output.h"
+#include "opal/util/printf.h"
+#include "ompi/communicator/communicator.h"
+#include "ompi/mca/fbtl/fbtl.h"
+#include "opal/datatype/opal_datatype.h"
+
+#include "common_ompio.h"
+
+#define OMPIO_TRACE_HISTOGRAM_SIZE 32
+
+typedef struct mca_common_ompio_trace_counters_t {
+    size_t ops[2];          /* independent, collective */
+    size_t bytes[2];
+    double time[2];
+    double fbtl_time_in_coll;
+    size_t histogram[OMPIO_TRACE_HISTOGRAM_SIZE];
+    size_t seeks;
+    size_t seek_distance;
+    size_t fbtl_ops;
+    size_t fbtl_bytes;
+    double fbtl_time;
+} mca_common_ompio_trace_counters_t;
+
+struct mca_common_ompio_trace_t {
+    /* copy of the selected fbtl module, with the wrappers installed */
+    mca_fbtl_base_module_t fbtl;
+    mca_fbtl_base_module_t *orig_fbtl;
+    mca_common_ompio_trace_counters_t counters[2];
+    /* operation in progress */
+    int depth;
+    double op_start;
+    double op_fbtl_time;
+    OMPI_MPI_OFFSET_TYPE op_offset;
+    OMPI_MPI_OFFSET_TYPE last_end;
+};
+
+static bool trace_file_truncated = false;
+
+static OMPI_MPI_OFFSET_TYPE trace_file_offset (ompio_fview_t *fview)
+{
+    if (NULL == fview->f_decoded_iov || 0 == fview->f_iov_count) {
+        return fview->f_offset;
+    }
+    return fview->f_offset + (ptrdiff_t) fview->f_decoded_iov[fview->f_index_in_file_view].iov_base +
+        (fview->f_total_bytes - fview->f_position_in_file_view);
+}
+
+static double trace_fbtl_time (mca_common_ompio_trace_t *trace)
+{
+    return trace->counters[OMPIO_TRACE_READ].fbtl_time + trace->counters[OMPIO_TRACE_WRITE].fbtl_time;
+}
+
+static void trace_fbtl_account (ompio_file_t *fh, int type, double start)
+{
+    mca_common_ompio_trace_counters_t *c = &fh->f_trace->counters[type];
+    int i;
+
+    c->fbtl_time += MPI_Wtime() - start;
+    c->fbtl_ops++;
+    for (i = 0; i < fh->f_num_of_io_entries; i++) {
+        c->fbtl_bytes += fh->f_io_array[i].length;
+    }
+}
+
+static ssize_t trace_fbtl_preadv (ompio_file_t *fh)
+{
+    double start = MPI_Wtime();
+    ssize_t ret = fh->f_trace->orig_fbtl->fbtl_preadv (fh);
+
+    trace_fbtl_account (fh, OMPIO_TRACE_READ, start);
+    return ret;
+}
+
+static ssize_t trace_fbtl_pwritev (ompio_file_t *fh)
+{
+    double start = MPI_Wtime();
+    ssize_t ret = fh->f_trace->orig_fbtl->fbtl_pwritev (fh);
+
+    trace_fbtl_account (fh, OMPIO_TRACE_WRITE, start);
+    return ret;
+}
+
+/* only the submission is timed for non-blocking operations */
+static ssize_t trace_fbtl_ipreadv (ompio_file_t *fh, ompi_request_t *request)
+{
+    double start = MPI_Wtime();
+    ssize_t ret = fh->f_trace->orig_fbtl->fbtl_ipreadv (fh, request);
+
+    trace_fbtl_account (fh, OMPIO_TRACE_READ, start);
+    return ret;
+}
+
+static ssize_t trace_fbtl_ipwritev (ompio_file_t *fh, ompi_request_t *request)
+{
+    double start = MPI_Wtime();
+    ssize_t ret = fh->f_trace->orig_fbtl->fbtl_ipwritev (fh, request);
+
+    trace_fbtl_account (fh, OMPIO_TRACE_WRITE, start);
+    return ret;
+}
+
+static const char *trace_filename (void)
+{
+    const char **value = NULL;
+    int idx;
+
+    idx = mca_base_var_find ("ompi", "io", "ompio", "trace_filename");
+    if (0 > idx || OPAL_SUCCESS != mca_base_var_get_value (idx, &value, NULL, NULL) ||
+        NULL == value || NULL == *value || '\0' == (*value)[0]) {
+        return NULL;
+    }
+    return *value;
+}
+
+int mca_common_ompio_trace_init (ompio_file_t *fh)
+{
+    mca_common_ompio_trace_t *trace;
+
+    fh->f_trace = NULL;
+    if (NULL == trace_filename () || NULL == fh->f_fbtl) {
+        return OMPI_SUCCESS;
+    }
+
+    trace = (mca_common_ompio_trace_t *) calloc (1, sizeof(mca_common_ompio_trace_t));
+    if (NULL == trace) {
+        return OMPI_ERR_OUT_OF_RESOURCE;
+    }
+    trace->orig_fbtl = fh->f_fbtl;
+    trace->fbtl      = *fh->f_fbtl;
+    trace->fbtl.fbtl_preadv  = trace_fbtl_preadv;
+    trace->fbtl.fbtl_pwritev = trace_fbtl_pwritev;
+    if (NULL != trace->orig_fbtl->fbtl_ipreadv) {
+        trace->fbtl.fbtl_ipreadv = trace_fbtl_ipreadv;
+    }
+    if (NULL != trace->orig_fbtl->fbtl_ipwritev) {
+        trace->fbtl.fbtl_ipwritev = trace_fbtl_ipwritev;
+    }
+
+    fh->f_trace = trace;
+    fh->f_fbtl  = &trace->fbtl;
+    return OMPI_SUCCESS;
+}
+
+void mca_common_ompio_trace_begin (ompio_file_t *fh)
+{
+    mca_common_ompio_trace_t *trace = fh->f_trace;
+
+    /* operations issued internally, e.g. by the individual fcoll
+     * component, are part of the operation that issued them */
+    if (NULL == trace || 0 < trace->depth++) {
+        return;
+    }
+    trace->op_start     = MPI_Wtime();
+    trace->op_fbtl_time = trace_fbtl_time (trace);
+    trace->op_offset    = trace_file_offset (&fh->f_fview);
+}
+
+void mca_common_ompio_trace_end (ompio_file_t *fh, int type, bool collective,
+                                 size_t count, struct ompi_datatype_t *datatype)
+{
+    mca_common_ompio_trace_t *trace = fh->f_trace;
+    mca_common_ompio_trace_counters_t *c;
+    size_t type_size, bytes;
+    int bucket = 0;
+
+    if (NULL == trace || 0 < --trace->depth) {
+        return;
+    }
+
+    c = &trace->counters[type];
+    opal_datatype_type_size (&datatype->super, &type_size);
+    bytes = type_size * count;
+
+    c->ops[collective]++;
+    c->bytes[collective] += bytes;
+    c->time[collective]  += MPI_Wtime() - trace->op_start;
+    if (collective) {
+        c->fbtl_time_in_coll += trace_fbtl_time (trace) - trace->op_fbtl_time;
+    }
+
+    while (bytes >> (bucket + 1) && bucket < OMPIO_TRACE_HISTOGRAM_SIZE - 1) {
+        bucket++;
+    }
+    c->histogram[bucket]++;
+
+    if (trace->op_offset != trace->last_end) {
+        c->seeks++;
+        c->seek_distance += (trace->op_offset > trace->last_end) ?
+            (size_t) (trace->op_offset - trace->last_end) :
+            (size_t) (trace->last_end - trace->op_offset);
+    }
+    trace->last_end = trace_file_offset (&fh->f_fview);
+}
+
+void mca_common_ompio_trace_finalize (ompio_file_t *fh)
+{
+    static const char *type_names[2] = {"read", "write"};
+    mca_common_ompio_trace_t *trace = fh->f_trace;
+    const char *prefix = trace_filename ();
+    char *filename = NULL;
+    FILE *pf;
+    int rank, type, i;
+
+    if (NULL == trace) {
+        return;
+    }
+    fh->f_fbtl  = trace->orig_fbtl;
+    fh->f_trace = NULL;
+
+    if (NULL == prefix) {
+        free (trace);
+        return;
+    }
+
+    rank = ompi_comm_rank (&ompi_mpi_comm_world.comm);
+    opal_asprintf (&filename, "%s.%d.iotrace", prefix, rank);
+    if (NULL == filename) {
+        free (trace);
+        return;
+    }
+    /* the log of a process collects all the files it closed */
+    pf = fopen (filename, trace_file_truncated ? "a" : "w");
+    if (NULL == pf) {
+        opal_output (1, "common_ompio: unable to open the trace file %s\n", filename);
+        free (filename);
+        free (trace);
+        return;
+    }
+    trace_file_truncated = true;
+
+    fprintf (pf, "F\t%d\t%s\t%d procs\t%d aggregators\n", rank, fh->f_filename,
+             fh->f_size, fh->f_num_aggrs);
+    for (type = 0; type < 2; type++) {
+        mca_common_ompio_trace_counters_t *c = &trace->counters[type];
+
+        if (0 == c->ops[0] + c->ops[1] + c->fbtl_ops) {
+            continue;
+        }
+        fprintf (pf, "O\t%d\t%s\t%zu indep ops\t%zu bytes\t%f s\t%zu coll ops\t%zu bytes\t%f s\n",
+                 rank, type_names[type], c->ops[0], c->bytes[0], c->time[0],
+                 c->ops[1], c->bytes[1], c->time[1]);
+        fprintf (pf, "B\t%d\t%s\t%zu fbtl ops\t%zu bytes\t%f s\t%f s coll fbtl\t%f s coll other\n",
+                 rank, type_names[type], c->fbtl_ops, c->fbtl_bytes, c->fbtl_time,
+                 c->fbtl_time_in_coll, c->time[1] - c->fbtl_time_in_coll);
+        fprintf (pf, "S\t%d\t%s\t%zu seeks\t%zu bytes\n", rank, type_names[type],
+                 c->seeks, c->seek_distance);
+        fprintf (pf, "H\t%d\t%s\t", rank, type_names[type]);
+        for (i = 0; i < OMPIO_TRACE_HISTOGRAM_SIZE; i++) {
+            fprintf (pf, "%zu%s", c->histogram[i], (i < OMPIO_TRACE_HISTOGRAM_SIZE - 1) ? "," : "\n");
+        }
+    }
+    fclose (pf);
+    free (filename);
+    free (trace);
+}
@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+/*
+ * Write-behind cache for small independent writes.
+ *
+ * Small independent writes are copied into a per-file staging buffer
+ * instead of being handed to the fbtl one by one. Writes that continue
+ * the previous one in the file are merged into a single extent, and all
+ * extents are written with one fbtl_pwritev call, sorted by offset, when
+ * the cache is flushed.
+ *
+ * The cache is only used when atomic mode is off. In that case, the MPI
+ * consistency semantics only guarantee that the data written by a process
+ * is visible to other processes after a sync or a close, and to the
+ * process itself in subsequent operations. The cache is therefore flushed
+ * on sync, close, file size queries and modifications, by any access that
+ * is not itself cached, by independent reads that overlap cached data,
+ * and when it runs out of space.
+ */
+
+#include "ompi_config.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ompi/mca/fbtl/fbtl.h"
+#include "opal/datatype/opal_datatype.h"
+
+#include "common_ompio.h"
+
+#define OMPIO_WRITE_CACHE_INITIAL_EXTENTS 64
+
+struct mca_common_ompio_write_cache_t {
+    char *buf;
+    size_t size;
+    size_t used;
+    mca_common_ompio_io_array_t *extents;
+    int num_extents;
+    int max_extents;
+    /* range of the file covered by the extents */
+    OMPI_MPI_OFFSET_TYPE lo;
+    OMPI_MPI_OFFSET_TYPE hi;
+};
+
+static int write_cache_extent_cmp (const void *a, const void *b)
+{
+    const mca_common_ompio_io_array_t *ea = (const mca_common_ompio_io_array_t *) a;
+    const mca_common_ompio_io_array_t *eb = (const mca_common_ompio_io_array_t *) b;
+    OMPI_MPI_OFFSET_TYPE oa = (OMPI_MPI_OFFSET_TYPE) (intptr_t) ea->offset;
+    OMPI_MPI_OFFSET_TYPE ob = (OMPI_MPI_OFFSET_TYPE) (intptr_t) eb->offset;
+
+    return (oa < ob) ? -1 : ((oa > ob) ? 1 : 0);
+}
+
+static bool write_cache_overlaps (mca_common_ompio_write_cache_t *cache,
+                                  OMPI_MPI_OFFSET_TYPE offset, size_t length)
+{
+    int i;
+
+    if (offset >= cache->hi || offset + (OMPI_MPI_OFFSET_TYPE) length <= cache->lo) {
+        return false;
+    }
+    for (i = 0; i < cache->num_extents; i++) {
+        OMPI_MPI_OFFSET_TYPE start = (OMPI_MPI_OFFSET_TYPE) (intptr_t) cache->extents[i].offset;
+
+        if (offset < start + (OMPI_MPI_OFFSET_TYPE) cache->extents[i].length &&
+            start < offset + (OMPI_MPI_OFFSET_TYPE) length) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int mca_common_ompio_write_cache_flush (ompio_file_t *fh)
+{
+    mca_common_ompio_write_cache_t *cache = fh->f_write_cache;
+    mca_common_ompio_io_array_t *io_array;
+    int num_io_entries;
+    ssize_t ret_code;
+
+    if (NULL == cache || 0 == cache->num_extents) {
+        return OMPI_SUCCESS;
+    }
+
+    /* Extents never overlap, so their order does not matter. Sorting them
+     * lets the fbtl combine neighbouring extents in a single call. */
+    qsort (cache->extents, cache->num_extents, sizeof(mca_common_ompio_io_array_t),
+           write_cache_extent_cmp);
+
+    io_array       = fh->f_io_array;
+    num_io_entries = fh->f_num_of_io_entries;
+    fh->f_io_array          = cache->extents;
+    fh->f_num_of_io_entries = cache->num_extents;
+    ret_code = fh->f_fbtl->fbtl_pwritev (fh);
+    fh->f_io_array          = io_array;
+    fh->f_num_of_io_entries = num_io_entries;
+
+    cache->num_extents = 0;
+    cache->used        = 0;
+    cache->lo          = 0;
+    cache->hi          = 0;
+
+    if (0 > ret_code) {
+        opal_output (1, "common_ompio: error %d flushing the write-behind cache\n", (int) ret_code);
+        return (int) ret_code;
+    }
+    return OMPI_SUCCESS;
+}
+
+int mca_common_ompio_write_cache_check (ompio_file_t *fh)
+{
+    mca_common_ompio_write_cache_t *cache = fh->f_write_cache;
+    int i;
+
+    if (NULL == cache || 0 == cache->num_extents) {
+        return OMPI_SUCCESS;
+    }
+    for (i = 0; i < fh->f_num_of_io_entries; i++) {
+        if (write_cache_overlaps (cache, (OMPI_MPI_OFFSET_TYPE) (intptr_t) fh->f_io_array[i].offset,
+                                  fh->f_io_array[i].length)) {
+            return mca_common_ompio_write_cache_flush (fh);
+        }
+    }
+    return OMPI_SUCCESS;
+}
+
+void mca_common_ompio_write_cache_free (ompio_file_t *fh)
+{
+    mca_common_ompio_write_cache_t *cache = fh->f_write_cache;
+
+    if (NULL == cache) {
+        return;
+    }
+    free (cache->buf);
+    free (cache->extents);
+    free (cache);
+    fh->f_write_cache = NULL;
+}
+
+static int write_cache_add (mca_common_ompio_write_cache_t *cache,
+                            const mca_common_ompio_io_array_t *entry)
+{
+    OMPI_MPI_OFFSET_TYPE offset = (OMPI_MPI_OFFSET_TYPE) (intptr_t) entry->offset;
+    char *dst = cache->buf + cache->used;
+
+    memcpy (dst, entry->memory_address, entry->length);
+
+    if (0 < cache->num_extents) {
+        mca_common_ompio_io_array_t *last = &cache->extents[cache->num_extents - 1];
+
+        if ((OMPI_MPI_OFFSET_TYPE) (intptr_t) last->offset + (OMPI_MPI_OFFSET_TYPE) last->length == offset &&
+            (char *) last->memory_address + last->length == dst) {
+            last->length += entry->length;
+            goto done;
+        }
+    }
+
+    if (cache->num_extents == cache->max_extents) {
+        mca_common_ompio_io_array_t *tmp;
+
+        tmp = (mca_common_ompio_io_array_t *) realloc (cache->extents, 2 * cache->max_extents *
+                                                       sizeof(mca_common_ompio_io_array_t));
+        if (NULL == tmp) {
+            return OMPI_ERR_OUT_OF_RESOURCE;
+        }
+        cache->extents      = tmp;
+        cache->max_extents *= 2;
+    }
+    cache->extents[cache->num_extents].memory_address = dst;
+    cache->extents[cache->num_extents].offset         = entry->offset;
+    cache->extents[cache->num_extents].length         = entry->length;
+    cache->num_extents++;
+
+ done:
+    if (0 == cache->used || offset < cache->lo) {
+        cache->lo = offset;
+    }
+    if (offset + (OMPI_MPI_OFFSET_TYPE) entry->length > cache->hi) {
+        cache->hi = offset + (OMPI_MPI_OFFSET_TYPE) entry->length;
+    }
+    cache->used += entry->length;
+    return OMPI_SUCCESS;
+}
+
+int mca_common_ompio_write_cache_write (ompio_file_t *fh,
+                                        const void *buf,
+                                        size_t count,
+                                        struct ompi_datatype_t *datatype,
+                                        ompi_status_public_t *status)
+{
+    mca_common_ompio_write_cache_t *cache = fh->f_write_cache;
+    int cache_size = OMPIO_MCA_GET(fh, write_behind_size);
+    int threshold = OMPIO_MCA_GET(fh, write_behind_threshold);
+    mca_common_ompio_io_array_t *io_array = NULL;
+    struct iovec *decoded_iov = NULL;
+    uint32_t iov_count = 0;
+    size_t type_size, max_data = 0, tbw = 0, spc = 0;
+    int num_io_entries = 0, i = 0, k, ret;
+
+    if (0 >= cache_size || fh->f_atomicity) {
+        return OMPI_ERR_NOT_AVAILABLE;
+    }
+
+    opal_datatype_type_size (&datatype->super, &type_size);
+    if (type_size * count > (size_t) threshold || type_size * count > (size_t) cache_size) {
+        return OMPI_ERR_NOT_AVAILABLE;
+    }
+
+    if (NULL == cache) {
+        cache = (mca_common_ompio_write_cache_t *) calloc (1, sizeof(mca_common_ompio_write_cache_t));
+        if (NULL == cache) {
+            return OMPI_ERR_NOT_AVAILABLE;
+        }
+        cache->buf     = (char *) malloc (cache_size);
+        cache->extents = (mca_common_ompio_io_array_t *) malloc (OMPIO_WRITE_CACHE_INITIAL_EXTENTS *
+                                                                 sizeof(mca_common_ompio_io_array_t));
+        if (NULL == cache->buf || NULL == cache->extents) {
+            free (cache->buf);
+            free (cache->extents);
+            free (cache);
+            return OMPI_ERR_NOT_AVAILABLE;
+        }
+        cache->size        = cache_size;
+        cache->max_extents = OMPIO_WRITE_CACHE_INITIAL_EXTENTS;
+        fh->f_write_cache  = cache;
+    }
+
+    if (cache->used + type_size * count > cache->size) {
+        ret = mca_common_ompio_write_cache_flush (fh);
+        if (OMPI_SUCCESS != ret) {
+            return ret;
+        }
+    }
+
+    ret = mca_common_ompio_decode_datatype (fh, datatype, count, buf, &max_data,
+                                            fh->f_mem_convertor, &decoded_iov, &iov_count);
+    if (OMPI_SUCCESS != ret) {
+        return ret;
+    }
+    if (0 == max_data) {
+        goto exit;
+    }
+
+    ret = mca_common_ompio_build_io_array (&(fh->f_fview), 0, 1, max_data, max_data,
+                                           iov_count, decoded_iov, &i, &tbw, &spc,
+                                           &io_array, &num_io_entries);
+    if (OMPI_SUCCESS != ret) {
+        goto exit;
+    }
+
+    for (k = 0; k < num_io_entries; k++) {
+        /* the new data has to reach the file after the data it overwrites */
+        if (write_cache_overlaps (cache, (OMPI_MPI_OFFSET_TYPE) (intptr_t) io_array[k].offset,
+                                  io_array[k].length)) {
+            ret = mca_common_ompio_write_cache_flush (fh);
+            if (OMPI_SUCCESS != ret) {
+                goto exit;
+            }
+        }
+        ret = write_cache_add (cache, &io_array[k]);
+        if (OMPI_SUCCESS != ret) {
+            goto exit;
+        }
+    }
+
+ exit:
+    free (io_array);
+    free (decoded_iov);
+    if (MPI_STATUS_IGNORE != status) {
+        status->_ucount = (OMPI_SUCCESS == ret) ? max_data : 0;
+    }
+    return ret;
+}
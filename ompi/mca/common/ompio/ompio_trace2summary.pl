@@ -0,0 +1,129 @@
+#!/usr/bin/perl -w
+
+#
+# Copyright (c) 2026      The University of Tennessee and The University
+#                         of Tennessee Research Foundation.  All rights
+#                         reserved.
+# $COPYRIGHT$
+#
+# Additional copyrights may follow
+#
+# $HEADER$
+#
+
+#
+# Aggregate the I/O statistics recorded by ompio when the
+# io_ompio_trace_filename parameter is set. Every process writes the
+# statistics of the files it closed to <trace_filename>.<rank>.iotrace.
+#
+# For every file and every direction (read/write), this script prints the
+# total number of operations and bytes accessed by the application, the
+# time spent in the fbtl and, for collective operations, the time spent
+# outside of it (mostly communication in the fcoll component), the number
+# of non-contiguous accesses, and the request size histogram. The balance
+# of the bytes accessed through the fbtl across processes shows how evenly
+# the aggregators were loaded.
+#
+# ensure that this script as the executable right: chmod +x ...
+#
+
+if($#ARGV < 0){
+   die("Usage: $0 <trace_filename> | <\".iotrace\" files>\n");
+}
+
+@files=();
+foreach $arg (@ARGV){
+   if ( -f $arg ){
+      push @files, $arg;
+   }else{
+      push @files, glob("$arg.*.iotrace");
+   }
+}
+if($#files < 0){
+   die("No .iotrace file found\n");
+}
+
+%stats=();
+%names=();
+foreach $filename (@files){
+   open IN,"<$filename" or die("Cannot open $filename\n");
+   $file="";
+   while (<IN>) {
+      chomp;
+      @f=split(/\t/);
+      if ($f[0] eq "F") {
+         $file=$f[2];
+         $names{$file}=1;
+         ($stats{$file}{procs})=($f[3]=~/(\d+)/);
+         ($stats{$file}{aggrs})=($f[4]=~/(\d+)/);
+         next;
+      }
+      next if ($file eq "" || $#f < 3);
+      $rank=$f[1];
+      $s=\%{$stats{$file}{$f[2]}};
+      if ($f[0] eq "O") {
+         @v=map { /([\d.]+)/; $1 } @f[3..8];
+         $s->{indep_ops}+=$v[0];
+         $s->{indep_bytes}+=$v[1];
+         $s->{indep_time}+=$v[2];
+         $s->{coll_ops}+=$v[3];
+         $s->{coll_bytes}+=$v[4];
+         $s->{coll_time}+=$v[5];
+      } elsif ($f[0] eq "B") {
+         @v=map { /([\d.]+)/; $1 } @f[3..7];
+         $s->{fbtl_ops}+=$v[0];
+         $s->{fbtl_bytes}+=$v[1];
+         $s->{fbtl_time}+=$v[2];
+         $s->{coll_fbtl}+=$v[3];
+         $s->{coll_other}+=$v[4];
+         $s->{rank_bytes}{$rank}+=$v[1];
+      } elsif ($f[0] eq "S") {
+         @v=map { /([\d.]+)/; $1 } @f[3..4];
+         $s->{seeks}+=$v[0];
+         $s->{seek_distance}+=$v[1];
+      } elsif ($f[0] eq "H") {
+         @v=split(/,/,$f[3]);
+         for ($i=0; $i<=$#v; $i++) {
+            $s->{hist}[$i]+=$v[$i];
+         }
+      }
+   }
+   close IN;
+}
+
+foreach $file (sort keys %names){
+   printf("%s: %d processes, %d aggregators\n", $file,
+          $stats{$file}{procs}, $stats{$file}{aggrs});
+   foreach $type ("read","write"){
+      next if (!exists($stats{$file}{$type}));
+      $s=$stats{$file}{$type};
+      printf("  %s\n", $type);
+      printf("    independent: %d ops, %d bytes, %.6f s\n",
+             $s->{indep_ops} || 0, $s->{indep_bytes} || 0, $s->{indep_time} || 0);
+      printf("    collective:  %d ops, %d bytes, %.6f s (fbtl %.6f s, other %.6f s)\n",
+             $s->{coll_ops} || 0, $s->{coll_bytes} || 0, $s->{coll_time} || 0,
+             $s->{coll_fbtl} || 0, $s->{coll_other} || 0);
+      printf("    fbtl:        %d ops, %d bytes, %.6f s\n",
+             $s->{fbtl_ops} || 0, $s->{fbtl_bytes} || 0, $s->{fbtl_time} || 0);
+      printf("    seeks:       %d, %d bytes\n", $s->{seeks} || 0, $s->{seek_distance} || 0);
+
+      # only the processes that accessed the file through the fbtl
+      @b=grep { $_ > 0 } values %{$s->{rank_bytes}};
+      if ($#b >= 0) {
+         $min=$b[0]; $max=$b[0]; $sum=0;
+         foreach $v (@b){
+            $min=$v if ($v<$min);
+            $max=$v if ($v>$max);
+            $sum+=$v;
+         }
+         printf("    fbtl bytes per process: %d processes, min %d, avg %.0f, max %d\n",
+                $#b+1, $min, $sum/($#b+1), $max);
+      }
+
+      print "    request sizes:\n";
+      for ($i=0; $i<=$#{$s->{hist}}; $i++) {
+         next if (!$s->{hist}[$i]);
+         printf("      %12d - %12d bytes: %d\n", ($i ? 2**$i : 0), 2**($i+1)-1, $s->{hist}[$i]);
+      }
+   }
+}
@@ -35,7 +35,23 @@ AC_DEFUN([MCA_ompi_fbtl_posix_CONFIG],[
     AC_CHECK_FUNCS([pwritev],[],[])
     AC_CHECK_FUNCS([preadv],[],[])
 
+    # Optional io_uring backend for the non-blocking operations
+    fbtl_posix_have_io_uring=0
+    fbtl_posix_io_uring_summary=no
+    OMPI_CHECK_LIBURING([fbtl_posix],
+                        [fbtl_posix_have_io_uring=1
+                         fbtl_posix_io_uring_summary=yes],
+                        [])
+    AC_DEFINE_UNQUOTED([FBTL_POSIX_HAVE_IO_URING], [$fbtl_posix_have_io_uring],
+                       [Whether the posix fbtl can use io_uring for non-blocking operations])
+    OPAL_SUMMARY_ADD([OMPIO File Systems], [io_uring (fbtl posix)], [], [$fbtl_posix_io_uring_summary])
+
     AS_IF([test "$fbtl_posix_happy" = "yes"],
           [$1],
           [$2])
+
+    # substitute in the things needed to build posix
+    AC_SUBST([fbtl_posix_CPPFLAGS])
+    AC_SUBST([fbtl_posix_LDFLAGS])
+    AC_SUBST([fbtl_posix_LIBS])
 ])dnl
@@ -35,6 +35,12 @@ extern bool mca_fbtl_posix_write_datasieving;
 extern size_t mca_fbtl_posix_max_block_size;
 extern size_t mca_fbtl_posix_max_gap_size;
 extern size_t mca_fbtl_posix_max_tmpbuf_size;
+#if FBTL_POSIX_HAVE_IO_URING
+extern bool mca_fbtl_posix_io_uring;
+extern int mca_fbtl_posix_io_uring_depth;
+extern bool mca_fbtl_posix_io_uring_fixed_files;
+extern bool mca_fbtl_posix_io_uring_direct;
+#endif
 
 BEGIN_C_DECLS
 
@@ -75,6 +81,30 @@ void  mca_fbtl_posix_unlock ( struct flock *lock, ompio_file_t *fh, int *lock_co
 /* Right now statically defined, will become a configure check */
 #define FBTL_POSIX_HAVE_AIO 1
 
+#if FBTL_POSIX_HAVE_IO_URING
+struct mca_fbtl_posix_uring_t;
+struct mca_fbtl_posix_request_data_t;
+
+/* One entry of the io array, as seen by the io_uring backend */
+struct mca_fbtl_posix_uring_op_t {
+    struct mca_fbtl_posix_request_data_t *op_data; /* request the entry belongs to */
+    char          *op_buf;               /* remaining part of the entry */
+    off_t          op_offset;
+    size_t         op_len;
+    int            op_status;            /* FBTL_POSIX_URING_OP_* */
+};
+typedef struct mca_fbtl_posix_uring_op_t mca_fbtl_posix_uring_op_t;
+
+#define FBTL_POSIX_URING_OP_PENDING  0
+#define FBTL_POSIX_URING_OP_INFLIGHT 1
+#define FBTL_POSIX_URING_OP_DONE     2
+
+ssize_t mca_fbtl_posix_uring_ipost (ompio_file_t *file, ompi_request_t *request, int type);
+bool mca_fbtl_posix_uring_progress ( mca_ompio_request_t *req);
+void mca_fbtl_posix_uring_request_free ( mca_ompio_request_t *req);
+void mca_fbtl_posix_uring_file_finalize ( ompio_file_t *file);
+#endif
+
 struct mca_fbtl_posix_request_data_t {
     int            prd_req_count;        /* total number of sub reqs */
     int            prd_open_reqs;        /* number of unfinished reqs */
@@ -92,6 +122,14 @@ struct mca_fbtl_posix_request_data_t {
           struct aiocb  *aio_reqs;            /* pointer array of req structures */
           int           *aio_req_status;      /* array of statuses */
       } prd_aio;
+#endif
+#if FBTL_POSIX_HAVE_IO_URING
+        struct {
+          mca_fbtl_posix_uring_op_t     *uring_ops;      /* one per io array entry */
+          struct mca_fbtl_posix_uring_t *uring;          /* ring of the file */
+          int                            uring_inflight; /* entries submitted, not reaped yet */
+          int                            uring_error;    /* first error seen */
+      } prd_uring;
 #endif
     };
 
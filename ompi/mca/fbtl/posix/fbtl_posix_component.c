@@ -42,6 +42,12 @@ bool mca_fbtl_posix_write_datasieving = true;
 size_t mca_fbtl_posix_max_block_size  = 1048576;  // 1MB
 size_t mca_fbtl_posix_max_gap_size    = 4096;     // Size of a block in many linux fs
 size_t mca_fbtl_posix_max_tmpbuf_size = 67108864; // 64 MB
+#if FBTL_POSIX_HAVE_IO_URING
+bool mca_fbtl_posix_io_uring = false;
+int mca_fbtl_posix_io_uring_depth = 64;
+bool mca_fbtl_posix_io_uring_fixed_files = true;
+bool mca_fbtl_posix_io_uring_direct = false;
+#endif
 /*
  * Private functions
  */
@@ -130,6 +136,47 @@ static int register_component(void)
                                            MCA_BASE_VAR_SCOPE_READONLY,
                                            &mca_fbtl_posix_write_datasieving );
 
+#if FBTL_POSIX_HAVE_IO_URING
+    mca_fbtl_posix_io_uring = false;
+    (void) mca_base_component_var_register(&mca_fbtl_posix_component.fbtlm_version,
+                                           "io_uring", "Use io_uring instead of POSIX AIO for the non-blocking operations. "
+                                           "Falls back to POSIX AIO if the kernel does not support io_uring. Default: false.",
+                                           MCA_BASE_VAR_TYPE_BOOL, NULL, 0, 0,
+                                           OPAL_INFO_LVL_9,
+                                           MCA_BASE_VAR_SCOPE_READONLY,
+                                           &mca_fbtl_posix_io_uring );
+
+    mca_fbtl_posix_io_uring_depth = 64;
+    (void) mca_base_component_var_register(&mca_fbtl_posix_component.fbtlm_version,
+                                           "io_uring_depth", "Maximum number of operations in flight on the io_uring of a file. "
+                                           "Default: 64.",
+                                           MCA_BASE_VAR_TYPE_INT, NULL, 0, 0,
+                                           OPAL_INFO_LVL_9,
+                                           MCA_BASE_VAR_SCOPE_READONLY,
+                                           &mca_fbtl_posix_io_uring_depth );
+
+    mca_fbtl_posix_io_uring_fixed_files = true;
+    (void) mca_base_component_var_register(&mca_fbtl_posix_component.fbtlm_version,
+                                           "io_uring_fixed_files", "Register the file descriptors with the io_uring of the file. "
+                                           "Default: true.",
+                                           MCA_BASE_VAR_TYPE_BOOL, NULL, 0, 0,
+                                           OPAL_INFO_LVL_9,
+                                           MCA_BASE_VAR_SCOPE_READONLY,
+                                           &mca_fbtl_posix_io_uring_fixed_files );
+
+    mca_fbtl_posix_io_uring_direct = false;
+    (void) mca_base_component_var_register(&mca_fbtl_posix_component.fbtlm_version,
+                                           "io_uring_direct", "Use O_DIRECT for the io_uring operations whose buffer, offset and "
+                                           "length are 4096 bytes aligned. Default: false.",
+                                           MCA_BASE_VAR_TYPE_BOOL, NULL, 0, 0,
+                                           OPAL_INFO_LVL_9,
+                                           MCA_BASE_VAR_SCOPE_READONLY,
+                                           &mca_fbtl_posix_io_uring_direct );
+    if ( 0 >= mca_fbtl_posix_io_uring_depth ) {
+        mca_fbtl_posix_io_uring_depth = 64;
+    }
+#endif
+
     
     return OMPI_SUCCESS;
 }
@@ -45,6 +45,16 @@ ssize_t mca_fbtl_posix_ipreadv (ompio_file_t *fh,
     int i=0, ret;
     off_t start_offset, end_offset, total_length;
 
+#if FBTL_POSIX_HAVE_IO_URING
+    if ( mca_fbtl_posix_io_uring ) {
+        ret = mca_fbtl_posix_uring_ipost (fh, request, FBTL_POSIX_AIO_READ);
+        if ( OMPI_ERR_NOT_AVAILABLE != ret ) {
+            return ret;
+        }
+        /* io_uring is not usable on this system, fall back to POSIX AIO */
+    }
+#endif
+
     data = (mca_fbtl_posix_request_data_t *) malloc ( sizeof (mca_fbtl_posix_request_data_t));
     if ( NULL == data ) {
         opal_output (1,"mca_fbtl_posix_ipreadv: could not allocate memory\n");
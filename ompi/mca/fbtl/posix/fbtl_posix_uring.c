@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) 2026      University of Houston. All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+/*
+ * io_uring backend for the non-blocking operations of the posix fbtl.
+ *
+ * Every file gets its own ring, created at the first non-blocking
+ * operation. The entries of the io array are submitted as individual
+ * read/write operations, up to the configured queue depth across all
+ * the pending requests of the file, and the completions are reaped
+ * from the ompio progress function. Optionally, the file descriptors
+ * are registered with the ring, and entries that satisfy the alignment
+ * constraints go through a second descriptor opened with O_DIRECT.
+ */
+
+#include "ompi_config.h"
+#include "fbtl_posix.h"
+
+#if FBTL_POSIX_HAVE_IO_URING
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <liburing.h>
+
+#include "mpi.h"
+#include "opal/mca/threads/mutex.h"
+#include "opal/util/output.h"
+#include "ompi/constants.h"
+#include "ompi/mca/fbtl/fbtl.h"
+#include "ompi/mca/fbtl/base/base.h"
+
+/* Largest single operation submitted to the ring, longer entries are
+ * completed in several steps */
+#define FBTL_POSIX_URING_MAX_OP (1UL << 30)
+
+/* Alignment required for the O_DIRECT descriptor */
+#define FBTL_POSIX_URING_DIRECT_ALIGN 4096
+
+struct mca_fbtl_posix_uring_t {
+    struct io_uring ring;
+    opal_mutex_t    lock;         /* the ring is shared by all requests on the file */
+    int             fds[2];       /* regular and O_DIRECT descriptors, -1 if unused */
+    bool            fixed_files;  /* fds are registered with the ring */
+    int             inflight;     /* operations submitted and not reaped, all requests */
+};
+typedef struct mca_fbtl_posix_uring_t mca_fbtl_posix_uring_t;
+
+/* Set once the ring could not be created, e.g. because the kernel lacks
+ * io_uring support: the AIO path is used from then on. */
+static bool mca_fbtl_posix_uring_unavailable = false;
+
+static mca_fbtl_posix_uring_t *fbtl_posix_uring_get (ompio_file_t *fh)
+{
+    mca_fbtl_posix_uring_t *uring = (mca_fbtl_posix_uring_t *) fh->f_fbtl_data;
+    int ret;
+
+    if ( NULL != uring ) {
+        return uring;
+    }
+    if ( mca_fbtl_posix_uring_unavailable ) {
+        return NULL;
+    }
+
+    uring = (mca_fbtl_posix_uring_t *) calloc (1, sizeof(mca_fbtl_posix_uring_t));
+    if ( NULL == uring ) {
+        return NULL;
+    }
+    ret = io_uring_queue_init (mca_fbtl_posix_io_uring_depth, &uring->ring, 0);
+    if ( 0 > ret ) {
+        opal_output_verbose(10, ompi_fbtl_base_framework.framework_output,
+                            "fbtl_posix: io_uring_queue_init failed: %s, using POSIX AIO",
+                            strerror(-ret));
+        mca_fbtl_posix_uring_unavailable = true;
+        free (uring);
+        return NULL;
+    }
+    OBJ_CONSTRUCT(&uring->lock, opal_mutex_t);
+
+    uring->fds[0] = fh->fd;
+    uring->fds[1] = -1;
+    if ( mca_fbtl_posix_io_uring_direct ) {
+        int flags = O_RDWR;
+
+        if ( fh->f_amode & MPI_MODE_RDONLY ) {
+            flags = O_RDONLY;
+        }
+        else if ( fh->f_amode & MPI_MODE_WRONLY ) {
+            flags = O_WRONLY;
+        }
+        /* Not all file systems support O_DIRECT, the regular descriptor
+         * is used for everything in that case */
+        uring->fds[1] = open (fh->f_fullfilename, flags | O_DIRECT);
+    }
+
+    uring->fixed_files = false;
+    if ( mca_fbtl_posix_io_uring_fixed_files ) {
+        int nfds = (-1 == uring->fds[1]) ? 1 : 2;
+        uring->fixed_files = (0 == io_uring_register_files (&uring->ring, uring->fds, nfds));
+    }
+
+    fh->f_fbtl_data = uring;
+    return uring;
+}
+
+void mca_fbtl_posix_uring_file_finalize (ompio_file_t *fh)
+{
+    mca_fbtl_posix_uring_t *uring = (mca_fbtl_posix_uring_t *) fh->f_fbtl_data;
+
+    if ( NULL == uring ) {
+        return;
+    }
+    if ( uring->fixed_files ) {
+        io_uring_unregister_files (&uring->ring);
+    }
+    io_uring_queue_exit (&uring->ring);
+    if ( -1 != uring->fds[1] ) {
+        close (uring->fds[1]);
+    }
+    OBJ_DESTRUCT(&uring->lock);
+    free (uring);
+    fh->f_fbtl_data = NULL;
+}
+
+static inline bool fbtl_posix_uring_is_aligned (mca_fbtl_posix_uring_op_t *op, size_t len)
+{
+    return 0 == ((uintptr_t) op->op_buf % FBTL_POSIX_URING_DIRECT_ALIGN) &&
+           0 == ((uint64_t) op->op_offset % FBTL_POSIX_URING_DIRECT_ALIGN) &&
+           0 == (len % FBTL_POSIX_URING_DIRECT_ALIGN);
+}
+
+/* Hand as many pending entries of a request to the ring as the queue depth allows.
+ * The ring lock has to be held. */
+static int fbtl_posix_uring_submit (mca_fbtl_posix_request_data_t *data)
+{
+    mca_fbtl_posix_uring_t *uring = data->prd_uring.uring;
+    int i, ret;
+
+    /* Skip the leading entries that are completed */
+    while ( data->prd_first_active_req < data->prd_req_count &&
+            FBTL_POSIX_URING_OP_DONE == data->prd_uring.uring_ops[data->prd_first_active_req].op_status ) {
+        data->prd_first_active_req++;
+    }
+
+    for ( i = data->prd_first_active_req; i < data->prd_req_count; i++ ) {
+        mca_fbtl_posix_uring_op_t *op = &data->prd_uring.uring_ops[i];
+        struct io_uring_sqe *sqe;
+        size_t len;
+        int idx;
+
+        if ( uring->inflight >= mca_fbtl_posix_io_uring_depth ) {
+            break;
+        }
+        if ( FBTL_POSIX_URING_OP_PENDING != op->op_status ) {
+            continue;
+        }
+        sqe = io_uring_get_sqe (&uring->ring);
+        if ( NULL == sqe ) {
+            break;
+        }
+
+        len = (op->op_len > FBTL_POSIX_URING_MAX_OP) ? FBTL_POSIX_URING_MAX_OP : op->op_len;
+        idx = (-1 != uring->fds[1] && fbtl_posix_uring_is_aligned (op, len)) ? 1 : 0;
+        if ( FBTL_POSIX_AIO_WRITE == data->prd_req_type ) {
+            io_uring_prep_write (sqe, uring->fixed_files ? idx : uring->fds[idx],
+                                 op->op_buf, (unsigned) len, (uint64_t) op->op_offset);
+        }
+        else {
+            io_uring_prep_read (sqe, uring->fixed_files ? idx : uring->fds[idx],
+                                op->op_buf, (unsigned) len, (uint64_t) op->op_offset);
+        }
+        if ( uring->fixed_files ) {
+            io_uring_sqe_set_flags (sqe, IOSQE_FIXED_FILE);
+        }
+        io_uring_sqe_set_data (sqe, op);
+
+        op->op_status = FBTL_POSIX_URING_OP_INFLIGHT;
+        data->prd_uring.uring_inflight++;
+        uring->inflight++;
+    }
+
+    /* This also flushes the entries left over by an earlier busy ring */
+    if ( 0 < io_uring_sq_ready (&uring->ring) ) {
+        ret = io_uring_submit (&uring->ring);
+        if ( 0 > ret && -EAGAIN != ret && -EBUSY != ret && -EINTR != ret ) {
+            opal_output(1, "mca_fbtl_posix_uring_submit: error in io_uring_submit(): %s", strerror(-ret));
+            return OMPI_ERROR;
+        }
+    }
+    return OMPI_SUCCESS;
+}
+
+/* Process all the available completions, whatever request they belong to.
+ * The ring lock has to be held. */
+static void fbtl_posix_uring_reap (mca_fbtl_posix_uring_t *uring)
+{
+    struct io_uring_cqe *cqe;
+
+    while ( 0 == io_uring_peek_cqe (&uring->ring, &cqe) ) {
+        mca_fbtl_posix_uring_op_t *op = (mca_fbtl_posix_uring_op_t *) io_uring_cqe_get_data (cqe);
+        mca_fbtl_posix_request_data_t *data = op->op_data;
+        int res = cqe->res;
+
+        io_uring_cqe_seen (&uring->ring, cqe);
+        uring->inflight--;
+        data->prd_uring.uring_inflight--;
+
+        if ( 0 > res ) {
+            if ( -EAGAIN == res || -EINTR == res ) {
+                op->op_status = FBTL_POSIX_URING_OP_PENDING;
+            }
+            else {
+                if ( 0 == data->prd_uring.uring_error ) {
+                    data->prd_uring.uring_error = -res;
+                }
+                op->op_status = FBTL_POSIX_URING_OP_DONE;
+            }
+            continue;
+        }
+
+        data->prd_total_len += res;
+        if ( (size_t) res < op->op_len && 0 < res ) {
+            /* Partial completion, submit the remainder */
+            op->op_buf    += res;
+            op->op_offset += res;
+            op->op_len    -= res;
+            op->op_status  = FBTL_POSIX_URING_OP_PENDING;
+        }
+        else {
+            /* Done, or end of file for a read */
+            op->op_status = FBTL_POSIX_URING_OP_DONE;
+            data->prd_open_reqs--;
+        }
+    }
+}
+
+ssize_t mca_fbtl_posix_uring_ipost (ompio_file_t *fh, ompi_request_t *request, int type)
+{
+    mca_fbtl_posix_request_data_t *data;
+    mca_ompio_request_t *req = (mca_ompio_request_t *) request;
+    mca_fbtl_posix_uring_t *uring;
+    off_t start_offset, end_offset;
+    int i, ret;
+
+    uring = fbtl_posix_uring_get (fh);
+    if ( NULL == uring ) {
+        return OMPI_ERR_NOT_AVAILABLE;
+    }
+
+    data = (mca_fbtl_posix_request_data_t *) malloc ( sizeof (mca_fbtl_posix_request_data_t));
+    if ( NULL == data ) {
+        opal_output (1,"mca_fbtl_posix_uring_ipost: could not allocate memory\n");
+        return OMPI_ERR_OUT_OF_RESOURCE;
+    }
+
+    data->prd_req_count = fh->f_num_of_io_entries;
+    data->prd_open_reqs = fh->f_num_of_io_entries;
+    data->prd_req_type  = type;
+    data->prd_req_chunks = mca_fbtl_posix_io_uring_depth;
+    data->prd_first_active_req = 0;
+    data->prd_last_active_req = fh->f_num_of_io_entries;
+    data->prd_total_len = 0;
+    data->prd_lock_counter = 0;
+    data->prd_fh = fh;
+    data->prd_uring.uring = uring;
+    data->prd_uring.uring_inflight = 0;
+    data->prd_uring.uring_error = 0;
+    data->prd_uring.uring_ops = (mca_fbtl_posix_uring_op_t *) malloc (fh->f_num_of_io_entries *
+                                                                     sizeof(mca_fbtl_posix_uring_op_t));
+    if ( NULL == data->prd_uring.uring_ops ) {
+        opal_output (1,"mca_fbtl_posix_uring_ipost: could not allocate memory\n");
+        free (data);
+        return OMPI_ERR_OUT_OF_RESOURCE;
+    }
+
+    for ( i=0; i<fh->f_num_of_io_entries; i++ ) {
+        data->prd_uring.uring_ops[i].op_data   = data;
+        data->prd_uring.uring_ops[i].op_buf    = (char *) fh->f_io_array[i].memory_address;
+        data->prd_uring.uring_ops[i].op_offset = (off_t)(intptr_t) fh->f_io_array[i].offset;
+        data->prd_uring.uring_ops[i].op_len    = fh->f_io_array[i].length;
+        data->prd_uring.uring_ops[i].op_status = FBTL_POSIX_URING_OP_PENDING;
+    }
+
+    if ( fh->f_atomicity ) {
+        OMPIO_SET_ATOMICITY_LOCK(fh, data->prd_lock, data->prd_lock_counter,
+                                 (FBTL_POSIX_AIO_WRITE == type) ? F_WRLCK : F_RDLCK);
+    }
+
+    /* Unlike the AIO path, all the entries may be in flight at the same
+     * time, so the lock covers the whole request */
+    start_offset = data->prd_uring.uring_ops[0].op_offset;
+    end_offset   = data->prd_uring.uring_ops[fh->f_num_of_io_entries-1].op_offset +
+                   data->prd_uring.uring_ops[fh->f_num_of_io_entries-1].op_len;
+    ret = mca_fbtl_posix_lock( &data->prd_lock, fh, (FBTL_POSIX_AIO_WRITE == type) ? F_WRLCK : F_RDLCK,
+                               start_offset, end_offset - start_offset,
+                               OMPIO_LOCK_ENTIRE_REGION, &data->prd_lock_counter );
+    if ( 0 < ret ) {
+        opal_output(1, "mca_fbtl_posix_uring_ipost: error in mca_fbtl_posix_lock() error ret=%d %s", ret, strerror(errno));
+        mca_fbtl_posix_unlock ( &data->prd_lock, fh, &data->prd_lock_counter);
+        free (data->prd_uring.uring_ops);
+        free (data);
+        return OMPI_ERROR;
+    }
+
+    OPAL_THREAD_LOCK(&uring->lock);
+    ret = fbtl_posix_uring_submit (data);
+    OPAL_THREAD_UNLOCK(&uring->lock);
+    if ( OMPI_SUCCESS != ret ) {
+        /* The ring might still hold entries that point to data, so it
+         * can not be released */
+        mca_fbtl_posix_unlock ( &data->prd_lock, fh, &data->prd_lock_counter);
+        return ret;
+    }
+
+    req->req_data = data;
+    req->req_progress_fn = mca_fbtl_posix_uring_progress;
+    req->req_free_fn     = mca_fbtl_posix_uring_request_free;
+    return OMPI_SUCCESS;
+}
+
+bool mca_fbtl_posix_uring_progress ( mca_ompio_request_t *req)
+{
+    mca_fbtl_posix_request_data_t *data=(mca_fbtl_posix_request_data_t *)req->req_data;
+    mca_fbtl_posix_uring_t *uring = data->prd_uring.uring;
+    bool done;
+
+    OPAL_THREAD_LOCK(&uring->lock);
+    fbtl_posix_uring_reap (uring);
+    if ( 0 == data->prd_uring.uring_error && 0 != data->prd_open_reqs ) {
+        if ( OMPI_SUCCESS != fbtl_posix_uring_submit (data) ) {
+            data->prd_uring.uring_error = EIO;
+        }
+    }
+    /* On error, wait for the entries still owned by the kernel before
+     * letting go of the request */
+    done = (0 == data->prd_open_reqs) ||
+           (0 != data->prd_uring.uring_error && 0 == data->prd_uring.uring_inflight);
+    OPAL_THREAD_UNLOCK(&uring->lock);
+
+    if ( !done ) {
+        return false;
+    }
+
+    req->req_ompi.req_status.MPI_ERROR = (0 == data->prd_uring.uring_error) ? OMPI_SUCCESS : OMPI_ERROR;
+    req->req_ompi.req_status._ucount = data->prd_total_len;
+    mca_fbtl_posix_unlock ( &data->prd_lock, data->prd_fh, &data->prd_lock_counter );
+    if ( data->prd_fh->f_atomicity ) {
+        mca_fbtl_posix_unlock ( &data->prd_lock, data->prd_fh, &data->prd_lock_counter );
+    }
+    return true;
+}
+
+void mca_fbtl_posix_uring_request_free ( mca_ompio_request_t *req)
+{
+    mca_fbtl_posix_request_data_t *data=(mca_fbtl_posix_request_data_t *)req->req_data;
+
+    if ( NULL != data ) {
+        free (data->prd_uring.uring_ops);
+        free (data);
+        req->req_data = NULL;
+    }
+}
+
+#endif /* FBTL_POSIX_HAVE_IO_URING */
@@ -42,6 +42,8 @@ BEGIN_C_DECLS
 
 extern int mca_fcoll_vulcan_priority;
 extern int mca_fcoll_vulcan_async_io;
+extern int mca_fcoll_vulcan_pipeline_depth;
+extern bool mca_fcoll_vulcan_adaptive_cycles;
 extern int mca_fcoll_vulcan_use_accelerator_buffers;
 
 OMPI_DECLSPEC extern mca_fcoll_base_component_3_0_0_t mca_fcoll_vulcan_component;
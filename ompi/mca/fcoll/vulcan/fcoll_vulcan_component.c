@@ -45,6 +45,8 @@ const char *mca_fcoll_vulcan_component_version_string =
  */
 int mca_fcoll_vulcan_priority = 10;
 int mca_fcoll_vulcan_async_io = 0;
+int mca_fcoll_vulcan_pipeline_depth = 2;
+bool mca_fcoll_vulcan_adaptive_cycles = false;
 
 /*
  * Local function
@@ -99,5 +101,23 @@ vulcan_register(void)
                                            OPAL_INFO_LVL_9,
                                            MCA_BASE_VAR_SCOPE_READONLY, &mca_fcoll_vulcan_async_io);
 
+    mca_fcoll_vulcan_pipeline_depth = 2;
+    (void) mca_base_component_var_register(&mca_fcoll_vulcan_component.fcollm_version,
+                                           "pipeline_depth", "Number of cycles of a collective write that an "
+                                           "aggregator keeps in flight at the same time. The collective buffer "
+                                           "is split among them. Values below 2 are treated as 2 (default: 2)",
+                                           MCA_BASE_VAR_TYPE_INT, NULL, 0, 0,
+                                           OPAL_INFO_LVL_9,
+                                           MCA_BASE_VAR_SCOPE_READONLY, &mca_fcoll_vulcan_pipeline_depth);
+
+    mca_fcoll_vulcan_adaptive_cycles = false;
+    (void) mca_base_component_var_register(&mca_fcoll_vulcan_component.fcollm_version,
+                                           "adaptive_cycles", "Adjust the size of the cycles of collective writes "
+                                           "from the write and shuffle bandwidth measured by the aggregators in "
+                                           "previous operations. Has to be set on all processes (default: false)",
+                                           MCA_BASE_VAR_TYPE_BOOL, NULL, 0, 0,
+                                           OPAL_INFO_LVL_9,
+                                           MCA_BASE_VAR_SCOPE_READONLY, &mca_fcoll_vulcan_adaptive_cycles);
+
     return OMPI_SUCCESS;
 }
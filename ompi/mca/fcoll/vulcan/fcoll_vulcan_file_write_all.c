@@ -55,6 +55,8 @@ static int write_init (ompio_file_t *fh, int aggregator, mca_io_ompio_aggregator
 static int local_heap_sort (mca_io_ompio_local_io_array *io_array,
 			    int num_entries, int *sorted);
 
+int mca_fcoll_vulcan_cycle_divisor = 1;
+
 int mca_fcoll_vulcan_file_write_all (struct ompio_file_t *fh,
                                       const void *buf,
                                       size_t count,
@@ -70,7 +72,9 @@ int mca_fcoll_vulcan_file_write_all (struct ompio_file_t *fh,
     uint32_t total_fview_count = 0;
     int local_count = 0;
     ompi_request_t **reqs = NULL;
-    ompi_request_t *req_iwrite = MPI_REQUEST_NULL;
+    ompi_request_t **write_reqs = NULL;
+    char **pipeline_bufs = NULL;
+    int depth = 2, slot;
     mca_io_ompio_aggregator_data **aggr_data=NULL;
     
     ptrdiff_t *displs = NULL;
@@ -91,6 +95,8 @@ int mca_fcoll_vulcan_file_write_all (struct ompio_file_t *fh,
     ompi_disp_array_t displs_desc;
     int is_gpu, is_managed;
     bool use_accelerator_buffer = false;
+    int base_bytes_per_cycle, num_lengths;
+    double shuffle_time = 0.0, io_time = 0.0, start_time;
 
 #if OMPIO_FCOLL_WANT_TIME_BREAKDOWN
     double write_time = 0.0, start_write_time = 0.0, end_write_time = 0.0;
@@ -121,9 +127,11 @@ int mca_fcoll_vulcan_file_write_all (struct ompio_file_t *fh,
         fh->f_get_mca_parameter_value ("use_accelerator_buffers", strlen("use_accelerator_buffers"))) {
         use_accelerator_buffer = true;
     }
-    /* since we want to overlap 2 iterations, define the bytes_per_cycle to be half of what
-       the user requested */
-    bytes_per_cycle =bytes_per_cycle/2;
+    /* the aggregation buffer requested by the user is split among the
+       cycles that can be in flight at the same time */
+    depth = mca_fcoll_vulcan_pipeline_depth < 2 ? 2 : mca_fcoll_vulcan_pipeline_depth;
+    bytes_per_cycle = bytes_per_cycle/depth;
+    base_bytes_per_cycle = bytes_per_cycle;
     
     ret =   mca_common_ompio_decode_datatype ((struct ompio_file_t *) fh,
                                               datatype,
@@ -193,7 +201,31 @@ int mca_fcoll_vulcan_file_write_all (struct ompio_file_t *fh,
                                               &broken_iov_arrays, &broken_counts, 
                                               &broken_total_lengths,
                                               fh->f_num_aggrs, domain_size); 
+    if (OMPI_SUCCESS != ret) {
+        goto exit;
+    }
 
+    /* With adaptive cycles, the aggregators piggyback their preferred
+       cycle size divisor on the allreduce below, so that all processes
+       agree on the same bytes_per_cycle. */
+    num_lengths = fh->f_num_aggrs;
+    if (mca_fcoll_vulcan_adaptive_cycles) {
+        MPI_Aint *tmp = (MPI_Aint *) realloc (broken_total_lengths,
+                                              (fh->f_num_aggrs + 2) * sizeof(MPI_Aint));
+        if (NULL == tmp) {
+            opal_output (1, "OUT OF MEMORY\n");
+            ret = OMPI_ERR_OUT_OF_RESOURCE;
+            goto exit;
+        }
+        broken_total_lengths = tmp;
+        num_lengths += 2;
+        broken_total_lengths[fh->f_num_aggrs]     = 0;
+        broken_total_lengths[fh->f_num_aggrs + 1] = 0;
+        if (NOT_AGGR_INDEX != aggr_index) {
+            broken_total_lengths[fh->f_num_aggrs]     = mca_fcoll_vulcan_cycle_divisor;
+            broken_total_lengths[fh->f_num_aggrs + 1] = 1;
+        }
+    }
 
     /**************************************************************************
      ** 3. Determine the total amount of data to be written and no. of cycles
@@ -203,7 +235,7 @@ int mca_fcoll_vulcan_file_write_all (struct ompio_file_t *fh,
 #endif
     ret = fh->f_comm->c_coll->coll_allreduce (MPI_IN_PLACE,
                                               broken_total_lengths,
-                                              fh->f_num_aggrs,
+                                              num_lengths,
                                               MPI_LONG,
                                               MPI_SUM,
                                               fh->f_comm,
@@ -217,6 +249,21 @@ int mca_fcoll_vulcan_file_write_all (struct ompio_file_t *fh,
     comm_time += (end_comm_time - start_comm_time);
 #endif
     
+    if (mca_fcoll_vulcan_adaptive_cycles && 0 < broken_total_lengths[fh->f_num_aggrs + 1]) {
+        long divisor = (broken_total_lengths[fh->f_num_aggrs] +
+                        broken_total_lengths[fh->f_num_aggrs + 1] / 2) /
+                       broken_total_lengths[fh->f_num_aggrs + 1];
+        if (divisor < 1) {
+            divisor = 1;
+        } else if (divisor > FCOLL_VULCAN_MAX_CYCLE_DIVISOR) {
+            divisor = FCOLL_VULCAN_MAX_CYCLE_DIVISOR;
+        }
+        bytes_per_cycle = base_bytes_per_cycle / divisor;
+        if (0 >= bytes_per_cycle) {
+            bytes_per_cycle = base_bytes_per_cycle;
+        }
+    }
+
     cycles=0;
     for ( i=0; i<fh->f_num_aggrs; i++ ) {
 #if DEBUG_ON
@@ -403,45 +450,54 @@ int mca_fcoll_vulcan_file_write_all (struct ompio_file_t *fh,
                 goto exit;
             }
         
+            /* One aggregation buffer and one write request per pipeline
+               slot. The buffer of a slot is reused only once the write
+               issued from it depth cycles earlier has completed. */
+            pipeline_bufs = (char **) calloc (depth, sizeof(char *));
+            write_reqs = (ompi_request_t **) malloc (depth * sizeof(ompi_request_t *));
+            if (NULL == pipeline_bufs || NULL == write_reqs) {
+                opal_output (1, "OUT OF MEMORY\n");
+                ret = OMPI_ERR_OUT_OF_RESOURCE;
+                goto exit;
+            }
+            for (slot = 0; slot < depth; slot++) {
+                write_reqs[slot] = MPI_REQUEST_NULL;
+            }
+
             if (use_accelerator_buffer) {
                 opal_output_verbose(10, ompi_fcoll_base_framework.framework_output,
                                     "Allocating GPU device buffer for aggregation\n");
-                ret = opal_accelerator.mem_alloc(MCA_ACCELERATOR_NO_DEVICE_ID, (void**)&aggr_data[i]->global_buf,
-                                                 bytes_per_cycle);
-                if (OPAL_SUCCESS != ret) {
-                    opal_output(1, "Could not allocate accelerator memory");
-                    ret = OMPI_ERR_OUT_OF_RESOURCE;
-                    goto exit;
-                }
-                ret = opal_accelerator.mem_alloc(MCA_ACCELERATOR_NO_DEVICE_ID, (void**)&aggr_data[i]->prev_global_buf,
-                                                 bytes_per_cycle);
-                if (OPAL_SUCCESS != ret) {
-                    opal_output(1, "Could not allocate accelerator memory");
-                    ret = OMPI_ERR_OUT_OF_RESOURCE;
-                    goto exit;
+                for (slot = 0; slot < depth; slot++) {
+                    ret = opal_accelerator.mem_alloc(MCA_ACCELERATOR_NO_DEVICE_ID, (void**)&pipeline_bufs[slot],
+                                                     bytes_per_cycle);
+                    if (OPAL_SUCCESS != ret) {
+                        pipeline_bufs[slot] = NULL;
+                        opal_output(1, "Could not allocate accelerator memory");
+                        ret = OMPI_ERR_OUT_OF_RESOURCE;
+                        goto exit;
+                    }
                 }
             } else {
-                aggr_data[i]->global_buf       = (char *) malloc (bytes_per_cycle);
-                aggr_data[i]->prev_global_buf  = (char *) malloc (bytes_per_cycle);
-                if (NULL == aggr_data[i]->global_buf || NULL == aggr_data[i]->prev_global_buf){
-                    opal_output(1, "OUT OF MEMORY");
-                    ret = OMPI_ERR_OUT_OF_RESOURCE;
-                    goto exit;
+                for (slot = 0; slot < depth; slot++) {
+                    pipeline_bufs[slot] = (char *) malloc (bytes_per_cycle);
+                    if (NULL == pipeline_bufs[slot]) {
+                        opal_output(1, "OUT OF MEMORY");
+                        ret = OMPI_ERR_OUT_OF_RESOURCE;
+                        goto exit;
+                    }
                 }
             }
+            aggr_data[i]->global_buf = pipeline_bufs[0];
         
             aggr_data[i]->recvtype = (ompi_datatype_t **) malloc (fh->f_procs_per_group  * 
                                                                   sizeof(ompi_datatype_t *));
-            aggr_data[i]->prev_recvtype = (ompi_datatype_t **) malloc (fh->f_procs_per_group  * 
-                                                                       sizeof(ompi_datatype_t *));
-            if (NULL == aggr_data[i]->recvtype || NULL == aggr_data[i]->prev_recvtype) {
+            if (NULL == aggr_data[i]->recvtype) {
                 opal_output (1, "OUT OF MEMORY\n");
                 ret = OMPI_ERR_OUT_OF_RESOURCE;
                 goto exit;
             }
             for(l=0;l<fh->f_procs_per_group;l++){
                 aggr_data[i]->recvtype[l]      = MPI_DATATYPE_NULL;
-                aggr_data[i]->prev_recvtype[l] = MPI_DATATYPE_NULL;
             }
         }
     
@@ -471,86 +527,117 @@ int mca_fcoll_vulcan_file_write_all (struct ompio_file_t *fh,
         write_synch_type = 1;
     }
 
-    if ( cycles > 0 ) {
+    /*
+     * Pipelined two-phase write: in cycle 'index' the aggregator receives
+     * into the buffer of slot index%depth while the writes of up to
+     * depth-1 previous cycles are still in flight. The write of a cycle is
+     * issued right after the shuffle of the next cycle has been posted, so
+     * that the network and the file system are kept busy at the same time.
+     */
+    if (NOT_AGGR_INDEX != aggr_index && cycles > 0) {
+        // Register progress function that should be used by ompi_request_wait
+        mca_common_ompio_register_progress ();
+    }
+
+    for (index = 0; index < cycles; index++) {
+        slot = index % depth;
+
+        if (NOT_AGGR_INDEX != aggr_index) {
+            /* wait until the write that used this buffer has completed */
+            start_time = MPI_Wtime();
+            ret = ompi_request_wait(&write_reqs[slot], MPI_STATUS_IGNORE);
+            if (OMPI_SUCCESS != ret){
+                goto exit;
+            }
+            io_time += MPI_Wtime() - start_time;
+            aggr_data[aggr_index]->global_buf = pipeline_bufs[slot];
+        }
+
+        start_time = MPI_Wtime();
         for ( i=0; i<fh->f_num_aggrs; i++ ) {
-            ret = shuffle_init ( 0, cycles, fh->f_aggr_list[i], fh->f_rank, aggr_data[i],
+            ret = shuffle_init ( index, cycles, fh->f_aggr_list[i], fh->f_rank, aggr_data[i],
                                  &reqs[i*(fh->f_procs_per_group + 1)] );
             if ( OMPI_SUCCESS != ret ) {
                 goto exit;
             }
         }
-        // Register progress function that should be used by ompi_request_wait
-        if (NOT_AGGR_INDEX != aggr_index)  {
-            mca_common_ompio_register_progress ();
-        }
-    }
+        shuffle_time += MPI_Wtime() - start_time;
 
-    ret = ompi_request_wait_all ( (fh->f_procs_per_group + 1 )*fh->f_num_aggrs,
-                                  reqs, MPI_STATUS_IGNORE);
-
-    for (index = 1; index < cycles; index++) {
-        SWAP_AGGR_POINTERS(aggr_data, fh->f_num_aggrs);
-
-        if(NOT_AGGR_INDEX != aggr_index) {
+        if (NOT_AGGR_INDEX != aggr_index && index > 0) {
 #if OMPIO_FCOLL_WANT_TIME_BREAKDOWN
             start_write_time = MPI_Wtime();
 #endif
+            start_time = MPI_Wtime();
             ret = write_init (fh, fh->f_aggr_list[aggr_index], aggr_data[aggr_index],
-                              write_synch_type, &req_iwrite, use_accelerator_buffer);
+                              write_synch_type, &write_reqs[(index - 1) % depth],
+                              use_accelerator_buffer);
             if (OMPI_SUCCESS != ret){
                 goto exit;
             }
+            io_time += MPI_Wtime() - start_time;
 #if OMPIO_FCOLL_WANT_TIME_BREAKDOWN
             end_write_time = MPI_Wtime();
             write_time += end_write_time - start_write_time;
 #endif
         }
 
-        for ( i=0; i<fh->f_num_aggrs; i++ ) {
-            ret = shuffle_init ( index, cycles, fh->f_aggr_list[i], fh->f_rank, aggr_data[i],
-                                 &reqs[i*(fh->f_procs_per_group + 1)] );
-            if ( OMPI_SUCCESS != ret ) {
-                goto exit;
-            }
-        }
-
+        start_time = MPI_Wtime();
         ret = ompi_request_wait_all ( (fh->f_procs_per_group + 1 )*fh->f_num_aggrs,
                                       reqs, MPI_STATUS_IGNORE);
         if (OMPI_SUCCESS != ret){
             goto exit;
         }
+        shuffle_time += MPI_Wtime() - start_time;
 
-        if(NOT_AGGR_INDEX != aggr_index) {
-            ret = ompi_request_wait(&req_iwrite, MPI_STATUS_IGNORE);
-            if (OMPI_SUCCESS != ret){
-                goto exit;
-            }
+        /* the data of this cycle is now ready to be written */
+        for ( i=0; i<fh->f_num_aggrs; i++ ) {
+            aggr_data[i]->prev_io_array       = aggr_data[i]->io_array;
+            aggr_data[i]->prev_num_io_entries = aggr_data[i]->num_io_entries;
+            aggr_data[i]->prev_bytes_sent     = aggr_data[i]->bytes_sent;
+            aggr_data[i]->prev_bytes_to_write = aggr_data[i]->bytes_to_write;
+            aggr_data[i]->io_array            = NULL;
         }
     } /* end  for (index = 0; index < cycles; index++) */
 
-    if ( cycles > 0 ) {
-        SWAP_AGGR_POINTERS(aggr_data,fh->f_num_aggrs);
-
-        if(NOT_AGGR_INDEX != aggr_index) {
+    if (NOT_AGGR_INDEX != aggr_index && cycles > 0) {
 #if OMPIO_FCOLL_WANT_TIME_BREAKDOWN
-            start_write_time = MPI_Wtime();
+        start_write_time = MPI_Wtime();
 #endif
-            ret = write_init (fh, fh->f_aggr_list[aggr_index], aggr_data[aggr_index],
-                              write_synch_type, &req_iwrite, use_accelerator_buffer);
-            if (OMPI_SUCCESS != ret){
-                goto exit;
-            }
+        start_time = MPI_Wtime();
+        ret = write_init (fh, fh->f_aggr_list[aggr_index], aggr_data[aggr_index],
+                          write_synch_type, &write_reqs[(cycles - 1) % depth],
+                          use_accelerator_buffer);
+        if (OMPI_SUCCESS != ret){
+            goto exit;
+        }
 #if OMPIO_FCOLL_WANT_TIME_BREAKDOWN
-            end_write_time = MPI_Wtime();
-            write_time += end_write_time - start_write_time;
+        end_write_time = MPI_Wtime();
+        write_time += end_write_time - start_write_time;
 #endif
-        }
 
-        if(NOT_AGGR_INDEX != aggr_index) {
-            ret = ompi_request_wait(&req_iwrite, MPI_STATUS_IGNORE);
-            if (OMPI_SUCCESS != ret){
-                goto exit;
+        ret = ompi_request_wait_all (depth, write_reqs, MPI_STATUSES_IGNORE);
+        if (OMPI_SUCCESS != ret){
+            goto exit;
+        }
+        io_time += MPI_Wtime() - start_time;
+
+        /* Both times were measured for the same amount of data, i.e. this
+           compares the write bandwidth seen by the pipeline with the shuffle
+           bandwidth. Larger cycles help a file system that cannot keep up,
+           smaller ones shorten the part of the pipeline that does not
+           overlap when the writes are cheap. Only pipelines that ran long
+           enough to be in steady state are taken into account. */
+        if (mca_fcoll_vulcan_adaptive_cycles && cycles > depth) {
+            if (io_time > shuffle_time && mca_fcoll_vulcan_cycle_divisor > 1) {
+                mca_fcoll_vulcan_cycle_divisor /= 2;
+            } else if (2 * io_time < shuffle_time &&
+                       mca_fcoll_vulcan_cycle_divisor < FCOLL_VULCAN_MAX_CYCLE_DIVISOR) {
+                mca_fcoll_vulcan_cycle_divisor *= 2;
             }
+            opal_output_verbose(10, ompi_fcoll_base_framework.framework_output,
+                                "vulcan_write_all: %d cycles of %d bytes, shuffle %lf s write %lf s, "
+                                "next cycle divisor %d\n", cycles, bytes_per_cycle, shuffle_time,
+                                io_time, mca_fcoll_vulcan_cycle_divisor);
         }
     }
         
@@ -574,6 +661,24 @@ int mca_fcoll_vulcan_file_write_all (struct ompio_file_t *fh,
 
 exit :
 
+    if ( NULL != write_reqs ) {
+        /* writes might still be in flight out of the buffers after an error */
+        (void) ompi_request_wait_all (depth, write_reqs, MPI_STATUSES_IGNORE);
+        free (write_reqs);
+    }
+    if ( NULL != pipeline_bufs ) {
+        for (slot = 0; slot < depth; slot++) {
+            if (use_accelerator_buffer) {
+                if (NULL != pipeline_bufs[slot]) {
+                    opal_accelerator.mem_release(MCA_ACCELERATOR_NO_DEVICE_ID, pipeline_bufs[slot]);
+                }
+            } else {
+                free (pipeline_bufs[slot]);
+            }
+        }
+        free (pipeline_bufs);
+    }
+
     if ( NULL != aggr_data ) {
         for ( i=0; i< fh->f_num_aggrs; i++ ) {
             if (fh->f_aggr_list[i] == fh->f_rank) {
@@ -582,23 +687,14 @@ exit :
                         if ( MPI_DATATYPE_NULL != aggr_data[i]->recvtype[j] ) {
                             ompi_datatype_destroy(&aggr_data[i]->recvtype[j]);
                         }
-                        if ( MPI_DATATYPE_NULL != aggr_data[i]->prev_recvtype[j] ) {
-                            ompi_datatype_destroy(&aggr_data[i]->prev_recvtype[j]);
-                        }
                     }
                     free(aggr_data[i]->recvtype);
-                    free(aggr_data[i]->prev_recvtype);
                 }
 
                 free (aggr_data[i]->disp_index);
                 free (aggr_data[i]->max_disp_index);
-                if (use_accelerator_buffer) {
-                    opal_accelerator.mem_release(MCA_ACCELERATOR_NO_DEVICE_ID, aggr_data[i]->global_buf);
-                    opal_accelerator.mem_release(MCA_ACCELERATOR_NO_DEVICE_ID, aggr_data[i]->prev_global_buf);
-                } else {
-                    free (aggr_data[i]->global_buf);
-                    free (aggr_data[i]->prev_global_buf);
-                }
+                free (aggr_data[i]->io_array);
+                free (aggr_data[i]->prev_io_array);
                 for(l=0;l<aggr_data[i]->procs_per_group;l++){
                     free (aggr_data[i]->blocklen_per_process[l]);
                     free (aggr_data[i]->displs_per_process[l]);
@@ -701,6 +797,7 @@ static int write_init (ompio_file_t *fh,
 
         free(fh->f_io_array);
         free(aggr_data->prev_io_array);
+        aggr_data->prev_io_array = NULL;
     }
     else {
         ompio_req->req_ompi.req_status.MPI_ERROR = OMPI_SUCCESS;
@@ -982,6 +1079,7 @@ int mca_fcoll_vulcan_minmax (ompio_file_t *fh, struct iovec *iov, int iov_count,
     if ( (globalmax - globalmin) % num_aggregators ) {
       stripe_size++;
     }
+    stripe_size = mca_common_ompio_stripe_aligned_domain (fh, num_aggregators, stripe_size);
 
     *new_stripe_size  = stripe_size;
 
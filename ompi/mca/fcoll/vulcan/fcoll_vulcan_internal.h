@@ -42,6 +42,13 @@ typedef struct mca_io_ompio_aggregator_data {
 } mca_io_ompio_aggregator_data;
 
 
+/* Largest factor by which adaptive cycles shrink the cycle size */
+#define FCOLL_VULCAN_MAX_CYCLE_DIVISOR 8
+
+/* Cycle size divisor learned by the aggregators of this process from the
+   previous collective writes (adaptive_cycles) */
+extern int mca_fcoll_vulcan_cycle_divisor;
+
 #define SWAP_REQUESTS(_r1,_r2) { \
     ompi_request_t **_t=_r1;     \
     _r1=_r2;                     \
@@ -550,6 +550,21 @@ int mca_io_ompio_get_mca_parameter_value ( char *mca_parameter_name, int name_le
     else if ( !strncmp ( mca_parameter_name, "aggregators_cutoff_threshold", name_length )) {
         return mca_io_ompio_aggregators_cutoff_threshold;
     }
+    else if ( !strncmp ( mca_parameter_name, "aggregator_placement", name_length )) {
+        return mca_io_ompio_aggregator_placement;
+    }
+    else if ( !strncmp ( mca_parameter_name, "stripe_aware_aggregators", name_length )) {
+        return mca_io_ompio_stripe_aware_aggregators;
+    }
+    else if ( !strncmp ( mca_parameter_name, "write_behind_size", name_length )) {
+        return mca_io_ompio_write_behind_size;
+    }
+    else if ( !strncmp ( mca_parameter_name, "write_behind_threshold", name_length )) {
+        return mca_io_ompio_write_behind_threshold;
+    }
+    else if ( !strncmp ( mca_parameter_name, "readahead_size", name_length )) {
+        return mca_io_ompio_readahead_size;
+    }
     else if ( !strncmp ( mca_parameter_name, "grouping_option", name_length )) {
         return mca_io_ompio_grouping_option;
     }
@@ -55,6 +55,12 @@ extern int mca_io_ompio_record_offset_info;
 extern int mca_io_ompio_grouping_option;
 extern int mca_io_ompio_max_aggregators_ratio;
 extern int mca_io_ompio_aggregators_cutoff_threshold;
+extern int mca_io_ompio_aggregator_placement;
+extern int mca_io_ompio_stripe_aware_aggregators;
+extern int mca_io_ompio_write_behind_size;
+extern int mca_io_ompio_write_behind_threshold;
+extern int mca_io_ompio_readahead_size;
+extern char *mca_io_ompio_trace_filename;
 extern int mca_io_ompio_overwrite_amode;
 extern int mca_io_ompio_verbose_info_parsing;
 extern int mca_io_ompio_use_accelerator_buffers;
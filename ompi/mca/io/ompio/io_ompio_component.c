@@ -33,6 +33,7 @@
 #include "opal/class/opal_list.h"
 #include "opal/mca/threads/mutex.h"
 #include "opal/mca/base/base.h"
+#include "opal/mca/base/mca_base_pvar.h"
 #include "ompi/mca/io/io.h"
 #include "ompi/mca/fs/base/base.h"
 #include "io_ompio.h"
@@ -47,6 +48,12 @@ int mca_io_ompio_record_offset_info = 0;
 int mca_io_ompio_coll_timing_info = 0;
 int mca_io_ompio_max_aggregators_ratio=8;
 int mca_io_ompio_aggregators_cutoff_threshold=3;
+int mca_io_ompio_aggregator_placement=0;
+int mca_io_ompio_stripe_aware_aggregators=0;
+int mca_io_ompio_write_behind_size=0;
+int mca_io_ompio_write_behind_threshold=65536;
+int mca_io_ompio_readahead_size=0;
+char *mca_io_ompio_trace_filename=NULL;
 int mca_io_ompio_overwrite_amode = 1;
 int mca_io_ompio_verbose_info_parsing = 0;
 int mca_io_ompio_use_accelerator_buffers = 0;
@@ -241,6 +248,101 @@ static int register_component(void)
                                            MCA_BASE_VAR_SCOPE_READONLY,
                                            &mca_io_ompio_aggregators_cutoff_threshold);
 
+    mca_io_ompio_aggregator_placement = 0;
+    (void) mca_base_component_var_register(&mca_io_ompio_component.io_version,
+                                           "aggregator_placement",
+                                           "Placement of the aggregators chosen for collective I/O operations "
+                                           "0: rank order (default) "
+                                           "1: spread evenly across nodes and NUMA domains",
+                                           MCA_BASE_VAR_TYPE_INT, NULL, 0, 0,
+                                           OPAL_INFO_LVL_9,
+                                           MCA_BASE_VAR_SCOPE_READONLY,
+                                           &mca_io_ompio_aggregator_placement);
+
+    mca_io_ompio_stripe_aware_aggregators = 0;
+    (void) mca_base_component_var_register(&mca_io_ompio_component.io_version,
+                                           "stripe_aware_aggregators",
+                                           "On striped file systems, match the number of aggregators chosen "
+                                           "by the simple aggregator selection algorithm (5) to the stripe count, "
+                                           "and align the file domains of the aggregators to stripe boundaries "
+                                           "so that each storage target has a single writer "
+                                           "0: disabled (default) 1: enabled",
+                                           MCA_BASE_VAR_TYPE_INT, NULL, 0, 0,
+                                           OPAL_INFO_LVL_9,
+                                           MCA_BASE_VAR_SCOPE_READONLY,
+                                           &mca_io_ompio_stripe_aware_aggregators);
+
+    mca_io_ompio_write_behind_size = 0;
+    (void) mca_base_component_var_register(&mca_io_ompio_component.io_version,
+                                           "write_behind_size",
+                                           "Size of the per file buffer used to coalesce small independent "
+                                           "writes when atomic mode is off. The buffer is written to the file "
+                                           "on sync, close, when it is full, or when a conflicting operation "
+                                           "occurs. 0: disabled (default)",
+                                           MCA_BASE_VAR_TYPE_INT, NULL, 0, 0,
+                                           OPAL_INFO_LVL_9,
+                                           MCA_BASE_VAR_SCOPE_READONLY,
+                                           &mca_io_ompio_write_behind_size);
+
+    mca_io_ompio_write_behind_threshold = 65536;
+    (void) mca_base_component_var_register(&mca_io_ompio_component.io_version,
+                                           "write_behind_threshold",
+                                           "Largest independent write, in bytes, that goes through "
+                                           "the write-behind buffer",
+                                           MCA_BASE_VAR_TYPE_INT, NULL, 0, 0,
+                                           OPAL_INFO_LVL_9,
+                                           MCA_BASE_VAR_SCOPE_READONLY,
+                                           &mca_io_ompio_write_behind_threshold);
+
+    mca_io_ompio_readahead_size = 0;
+    (void) mca_base_component_var_register(&mca_io_ompio_component.io_version,
+                                           "readahead_size",
+                                           "Size of the per file buffer used to prefetch the next window "
+                                           "of the file once a sequential or strided read pattern has been "
+                                           "detected. Also the largest read that can be served from it. "
+                                           "0: disabled (default)",
+                                           MCA_BASE_VAR_TYPE_INT, NULL, 0, 0,
+                                           OPAL_INFO_LVL_9,
+                                           MCA_BASE_VAR_SCOPE_READONLY,
+                                           &mca_io_ompio_readahead_size);
+
+    (void) mca_base_component_pvar_register(&mca_io_ompio_component.io_version,
+                                            "readahead_hits",
+                                            "Number of reads served from the read-ahead buffer",
+                                            OPAL_INFO_LVL_4, MCA_BASE_PVAR_CLASS_COUNTER,
+                                            MCA_BASE_VAR_TYPE_UNSIGNED_LONG, NULL,
+                                            MCA_BASE_VAR_BIND_NO_OBJECT,
+                                            MCA_BASE_PVAR_FLAG_READONLY | MCA_BASE_PVAR_FLAG_CONTINUOUS,
+                                            NULL, NULL, NULL, &mca_common_ompio_readahead_hits);
+    (void) mca_base_component_pvar_register(&mca_io_ompio_component.io_version,
+                                            "readahead_misses",
+                                            "Number of reads eligible for read-ahead that had to access the file",
+                                            OPAL_INFO_LVL_4, MCA_BASE_PVAR_CLASS_COUNTER,
+                                            MCA_BASE_VAR_TYPE_UNSIGNED_LONG, NULL,
+                                            MCA_BASE_VAR_BIND_NO_OBJECT,
+                                            MCA_BASE_PVAR_FLAG_READONLY | MCA_BASE_PVAR_FLAG_CONTINUOUS,
+                                            NULL, NULL, NULL, &mca_common_ompio_readahead_misses);
+    (void) mca_base_component_pvar_register(&mca_io_ompio_component.io_version,
+                                            "readahead_bytes",
+                                            "Number of bytes prefetched by the read-ahead",
+                                            OPAL_INFO_LVL_4, MCA_BASE_PVAR_CLASS_COUNTER,
+                                            MCA_BASE_VAR_TYPE_UNSIGNED_LONG, NULL,
+                                            MCA_BASE_VAR_BIND_NO_OBJECT,
+                                            MCA_BASE_PVAR_FLAG_READONLY | MCA_BASE_PVAR_FLAG_CONTINUOUS,
+                                            NULL, NULL, NULL, &mca_common_ompio_readahead_bytes);
+
+    mca_io_ompio_trace_filename = NULL;
+    (void) mca_base_component_var_register(&mca_io_ompio_component.io_version,
+                                           "trace_filename",
+                                           "Collect I/O statistics for every file, and append them to "
+                                           "<trace_filename>.<rank>.iotrace when the file is closed. "
+                                           "Use ompio_trace2summary.pl to aggregate the logs of all "
+                                           "processes. Empty: disabled (default)",
+                                           MCA_BASE_VAR_TYPE_STRING, NULL, 0, 0,
+                                           OPAL_INFO_LVL_9,
+                                           MCA_BASE_VAR_SCOPE_READONLY,
+                                           &mca_io_ompio_trace_filename);
+
     mca_io_ompio_overwrite_amode = 1;
     (void) mca_base_component_var_register(&mca_io_ompio_component.io_version,
                                            "overwrite_amode",
@@ -24,6 +24,7 @@
 #include "ompi/op/op.h"
 #include "ompi/mca/op/op.h"
 #include "ompi/mca/op/base/base.h"
+#include "ompi/mca/op/base/functions.h"
 #include "ompi/mca/op/aarch64/op_aarch64.h"
 
 /**
@@ -449,6 +450,160 @@ static void OP_CONCAT(ompi_op_aarch64_3buff_##name##_##type##type_size##_t, APPE
     OP_AARCH64_FUNC_3BUFF(bxor, s, 64,  2,  int, eor)
     OP_AARCH64_FUNC_3BUFF(bxor, u, 64,  2, uint, eor)
 
+/*************************************************************************
+ * Half precision: MPIX_SHORT_FLOAT (when it is an IEEE binary16) and
+ * MPIX_BFLOAT16, for max, min, sum and prod.
+ *
+ * The elements are widened to fp32, the operation is done in fp32 and the
+ * result is rounded back to nearest-even. This does not need the optional
+ * FP16 arithmetic extension, and fp32 has more than twice the precision of
+ * both formats so the single rounding matches the native operation.
+ *************************************************************************/
+#if (defined(HAVE_SHORT_FLOAT) && (2 == SIZEOF_SHORT_FLOAT)) || \
+    (!defined(HAVE_SHORT_FLOAT) && defined(HAVE_OPAL_SHORT_FLOAT_T))
+#define OP_AARCH64_HAS_BINARY16_SHORT_FLOAT 1
+#endif
+
+static inline float ompi_op_aarch64_short_float_to_float(uint16_t value)
+{
+    __fp16 h;
+    memcpy(&h, &value, sizeof(h));
+    return (float) h;
+}
+
+static inline uint16_t ompi_op_aarch64_float_to_short_float(float value)
+{
+    __fp16 h = (__fp16) value;
+    uint16_t bits;
+    memcpy(&bits, &h, sizeof(bits));
+    return bits;
+}
+
+#define OP_AARCH64_short_float_TO_FLOAT(h)   ompi_op_aarch64_short_float_to_float(h)
+#define OP_AARCH64_short_float_FROM_FLOAT(f) ompi_op_aarch64_float_to_short_float(f)
+#define OP_AARCH64_bfloat16_TO_FLOAT(h)      ompi_op_base_bfloat16_to_float(h)
+#define OP_AARCH64_bfloat16_FROM_FLOAT(f)    ompi_op_base_float_to_bfloat16(f)
+
+#define OP_AARCH64_HALF_max(a, b)  ((a) > (b) ? (a) : (b))
+#define OP_AARCH64_HALF_min(a, b)  ((a) < (b) ? (a) : (b))
+#define OP_AARCH64_HALF_sum(a, b)  ((a) + (b))
+#define OP_AARCH64_HALF_prod(a, b) ((a) * (b))
+
+#if GENERATE_NEON_CODE
+#define OP_AARCH64_HALF_ATTR
+#define OP_AARCH64_short_float_LOAD(lo, hi, p)                                    \
+    do {                                                                          \
+        float16x8_t h = vreinterpretq_f16_u16(vld1q_u16(p));                      \
+        (lo) = vcvt_f32_f16(vget_low_f16(h));                                     \
+        (hi) = vcvt_high_f32_f16(h);                                              \
+    } while (0)
+#define OP_AARCH64_short_float_STORE(p, lo, hi)                                   \
+    vst1q_u16((p), vreinterpretq_u16_f16(vcvt_high_f16_f32(vcvt_f16_f32(lo), (hi))))
+#define OP_AARCH64_bfloat16_LOAD(lo, hi, p)                                       \
+    do {                                                                          \
+        uint16x8_t h = vld1q_u16(p);                                              \
+        (lo) = vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(h), 16));           \
+        (hi) = vreinterpretq_f32_u32(vshll_high_n_u16(h, 16));                    \
+    } while (0)
+/* Round to nearest-even on the integer representation, and keep the NaNs quiet */
+#define OP_AARCH64_bfloat16_ROUND(v)                                              \
+    __extension__({                                                               \
+        uint32x4_t bits = vreinterpretq_u32_f32(v);                               \
+        uint32x4_t lsb = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));        \
+        uint32x4_t rnd = vaddq_u32(bits, vaddq_u32(lsb, vdupq_n_u32(0x7fff)));    \
+        vbslq_u32(vceqq_f32((v), (v)), rnd, vorrq_u32(bits, vdupq_n_u32(0x00400000))); \
+    })
+#define OP_AARCH64_bfloat16_STORE(p, lo, hi)                                      \
+    vst1q_u16((p), vshrn_high_n_u32(vshrn_n_u32(OP_AARCH64_bfloat16_ROUND(lo), 16), \
+                                    OP_AARCH64_bfloat16_ROUND(hi), 16))
+
+#define OP_AARCH64_HALF_LOOP(name, type_name, op)                                 \
+    for (; left_over >= 8; left_over -= 8) {                                      \
+        float32x4_t a_lo, a_hi, b_lo, b_hi;                                       \
+        OP_AARCH64_##type_name##_LOAD(a_lo, a_hi, in1);                           \
+        OP_AARCH64_##type_name##_LOAD(b_lo, b_hi, in2);                           \
+        in1 += 8;                                                                 \
+        in2 += 8;                                                                 \
+        OP_AARCH64_##type_name##_STORE(out, v##op##q_f32(a_lo, b_lo),             \
+                                       v##op##q_f32(a_hi, b_hi));                 \
+        out += 8;                                                                 \
+    }                                                                             \
+    for (; left_over > 0; left_over--, in1++, in2++, out++) {                     \
+        *out = OP_AARCH64_##type_name##_FROM_FLOAT(                               \
+            OP_AARCH64_HALF_##name(OP_AARCH64_##type_name##_TO_FLOAT(*in1),       \
+                                   OP_AARCH64_##type_name##_TO_FLOAT(*in2)));     \
+    }
+#elif GENERATE_SVE_CODE
+#define OP_AARCH64_HALF_ATTR OMPI_SVE_ATTR
+#define OP_AARCH64_short_float_LOAD(pred, p)                                      \
+    svcvt_f32_f16_x((pred), svreinterpret_f16_u32(svld1uh_u32((pred), (p))))
+#define OP_AARCH64_short_float_STORE(pred, p, v)                                  \
+    svst1h_u32((pred), (p), svreinterpret_u32_f16(svcvt_f16_f32_x((pred), (v))))
+#define OP_AARCH64_bfloat16_LOAD(pred, p)                                         \
+    svreinterpret_f32_u32(svlsl_n_u32_x((pred), svld1uh_u32((pred), (p)), 16))
+/* Round to nearest-even on the integer representation, and keep the NaNs quiet */
+#define OP_AARCH64_bfloat16_STORE(pred, p, v)                                     \
+    do {                                                                          \
+        svuint32_t bits = svreinterpret_u32_f32(v);                               \
+        svuint32_t lsb = svand_n_u32_x((pred), svlsr_n_u32_x((pred), bits, 16), 1); \
+        svuint32_t rnd = svadd_u32_x((pred), bits, svadd_n_u32_x((pred), lsb, 0x7fff)); \
+        rnd = svsel_u32(svcmpuo_f32((pred), (v), (v)),                            \
+                        svorr_n_u32_x((pred), bits, 0x00400000), rnd);            \
+        svst1h_u32((pred), (p), svlsr_n_u32_x((pred), rnd, 16));                  \
+    } while (0)
+
+#define OP_AARCH64_HALF_LOOP(name, type_name, op)                                 \
+    const int types_per_step = svcntw();                                          \
+    const int cnt = left_over;                                                    \
+    for (int idx = 0; idx < cnt; idx += types_per_step) {                         \
+        svbool_t pred = svwhilelt_b32(idx, cnt);                                  \
+        svfloat32_t va = OP_AARCH64_##type_name##_LOAD(pred, &in1[idx]);          \
+        svfloat32_t vb = OP_AARCH64_##type_name##_LOAD(pred, &in2[idx]);          \
+        OP_AARCH64_##type_name##_STORE(pred, &out[idx], sv##op##_f32_x(pred, va, vb)); \
+    }
+#endif  /* GENERATE_SVE_CODE */
+
+/*
+ * The first operand is the inout buffer for the 2 buffers version, which
+ * matches the operand order of the base implementation.
+ */
+#define OP_AARCH64_HALF_FUNC(name, type_name, op)                                 \
+    OP_AARCH64_HALF_ATTR                                                          \
+    static void OP_CONCAT(ompi_op_aarch64_2buff_##name##_##type_name, APPEND)     \
+                            (const void *_in, void *_out, int *count,             \
+                             struct ompi_datatype_t **dtype,                      \
+                             struct ompi_op_base_module_1_0_0_t *module)          \
+    {                                                                             \
+        int left_over = *count;                                                   \
+        const uint16_t *in1 = (const uint16_t *) _out,                            \
+                       *in2 = (const uint16_t *) _in;                             \
+        uint16_t *out = (uint16_t *) _out;                                        \
+        OP_AARCH64_HALF_LOOP(name, type_name, op)                                 \
+    }                                                                             \
+    OP_AARCH64_HALF_ATTR                                                          \
+    static void OP_CONCAT(ompi_op_aarch64_3buff_##name##_##type_name, APPEND)     \
+                            (const void *_in1, const void *_in2, void *_out, int *count, \
+                             struct ompi_datatype_t **dtype,                      \
+                             struct ompi_op_base_module_1_0_0_t *module)          \
+    {                                                                             \
+        int left_over = *count;                                                   \
+        const uint16_t *in1 = (const uint16_t *) _in1,                            \
+                       *in2 = (const uint16_t *) _in2;                            \
+        uint16_t *out = (uint16_t *) _out;                                        \
+        OP_AARCH64_HALF_LOOP(name, type_name, op)                                 \
+    }
+
+#if defined(OP_AARCH64_HAS_BINARY16_SHORT_FLOAT)
+    OP_AARCH64_HALF_FUNC(max, short_float, max)
+    OP_AARCH64_HALF_FUNC(min, short_float, min)
+    OP_AARCH64_HALF_FUNC(sum, short_float, add)
+    OP_AARCH64_HALF_FUNC(prod, short_float, mul)
+#endif  /* defined(OP_AARCH64_HAS_BINARY16_SHORT_FLOAT) */
+    OP_AARCH64_HALF_FUNC(max, bfloat16, max)
+    OP_AARCH64_HALF_FUNC(min, bfloat16, min)
+    OP_AARCH64_HALF_FUNC(sum, bfloat16, add)
+    OP_AARCH64_HALF_FUNC(prod, bfloat16, mul)
+
     /** C integer ***********************************************************/
 #define C_INTEGER_BASE(name, ftype)                                         \
     [OMPI_OP_BASE_TYPE_INT8_T]   = OP_CONCAT(ompi_op_aarch64_##ftype##_##name##_int8_t, APPEND), \
@@ -465,7 +620,16 @@ static void OP_CONCAT(ompi_op_aarch64_3buff_##name##_##type##type_size##_t, APPE
 #define FLOAT(name, ftype)  OP_CONCAT(ompi_op_aarch64_##ftype##_##name##_float32_t, APPEND)
 #define DOUBLE(name, ftype) OP_CONCAT(ompi_op_aarch64_##ftype##_##name##_float64_t, APPEND)
 
+#if defined(OP_AARCH64_HAS_BINARY16_SHORT_FLOAT)
+#define SHORT_FLOAT(name, ftype) OP_CONCAT(ompi_op_aarch64_##ftype##_##name##_short_float, APPEND)
+#else
+#define SHORT_FLOAT(name, ftype) NULL
+#endif  /* defined(OP_AARCH64_HAS_BINARY16_SHORT_FLOAT) */
+#define BFLOAT16(name, ftype) OP_CONCAT(ompi_op_aarch64_##ftype##_##name##_bfloat16, APPEND)
+
 #define FLOATING_POINT(name, ftype)                                    \
+    [OMPI_OP_BASE_TYPE_SHORT_FLOAT] = SHORT_FLOAT(name, ftype),        \
+    [OMPI_OP_BASE_TYPE_BFLOAT16] = BFLOAT16(name, ftype),              \
     [OMPI_OP_BASE_TYPE_FLOAT] = FLOAT(name, ftype),                    \
     [OMPI_OP_BASE_TYPE_DOUBLE] = DOUBLE(name, ftype)
 
@@ -45,6 +45,7 @@ static mca_base_var_enum_value_flag_t avx_support_flags[] = {
     { .flag = 0x020, .string = "AVX2" },
     { .flag = 0x100, .string = "AVX512F" },
     { .flag = 0x200, .string = "AVX512BW" },
+    { .flag = 0x400, .string = "F16C" },
     { .flag = 0,     .string = NULL },
 };
 
@@ -62,6 +63,7 @@ static uint32_t has_intel_AVX_features(void)
 
     flags |= _may_i_use_cpu_feature(_FEATURE_AVX512F)  ? OMPI_OP_AVX_HAS_AVX512F_FLAG   : 0;
     flags |= _may_i_use_cpu_feature(_FEATURE_AVX512BW) ? OMPI_OP_AVX_HAS_AVX512BW_FLAG : 0;
+    flags |= _may_i_use_cpu_feature(_FEATURE_F16C)     ? OMPI_OP_AVX_HAS_F16C_FLAG      : 0;
     flags |= _may_i_use_cpu_feature(_FEATURE_AVX2)     ? OMPI_OP_AVX_HAS_AVX2_FLAG      : 0;
     flags |= _may_i_use_cpu_feature(_FEATURE_AVX)      ? OMPI_OP_AVX_HAS_AVX_FLAG       : 0;
     flags |= _may_i_use_cpu_feature(_FEATURE_SSE4_1)   ? OMPI_OP_AVX_HAS_SSE4_1_FLAG    : 0;
@@ -100,6 +102,7 @@ static uint32_t has_intel_AVX_features(void)
     const uint32_t avx512f_mask   = (1U << 16);  // AVX512F   (EAX = 7, ECX = 0) : EBX
     const uint32_t avx512_bw_mask = (1U << 30);  // AVX512BW  (EAX = 7, ECX = 0) : EBX
     const uint32_t avx2_mask      = (1U << 5);   // AVX2      (EAX = 7, ECX = 0) : EBX
+    const uint32_t f16c_mask      = (1U << 29);  // F16C      (EAX = 1, ECX = 0) : ECX
     const uint32_t avx_mask       = (1U << 28);  // AVX       (EAX = 1, ECX = 0) : ECX
     const uint32_t sse4_1_mask    = (1U << 19);  // SSE4.1    (EAX = 1, ECX = 0) : ECX
     const uint32_t sse3_mask      = (1U << 0);   // SSE3      (EAX = 1, ECX = 0) : ECX
@@ -108,6 +111,7 @@ static uint32_t has_intel_AVX_features(void)
     uint32_t flags = 0, abcd[4];
 
     run_cpuid( 1, 0, abcd );
+    flags |= (abcd[2] & f16c_mask)      ? OMPI_OP_AVX_HAS_F16C_FLAG     : 0;
     flags |= (abcd[2] & avx_mask)       ? OMPI_OP_AVX_HAS_AVX_FLAG      : 0;
     flags |= (abcd[2] & sse4_1_mask)    ? OMPI_OP_AVX_HAS_SSE4_1_FLAG   : 0;
     flags |= (abcd[2] & sse3_mask)      ? OMPI_OP_AVX_HAS_SSE3_FLAG     : 0;
@@ -270,6 +274,8 @@ avx_component_op_query(struct ompi_op_t *op, int *priority)
     case OMPI_OP_BASE_FORTRAN_BOR:
     case OMPI_OP_BASE_FORTRAN_BAND:
     case OMPI_OP_BASE_FORTRAN_BXOR:
+    case OMPI_OP_BASE_FORTRAN_MAXLOC:
+    case OMPI_OP_BASE_FORTRAN_MINLOC:
         module = OBJ_NEW(ompi_op_base_module_t);
         for (int i = 0; i < OMPI_OP_BASE_TYPE_MAX; ++i) {
 #if OMPI_MCA_OP_HAVE_AVX512
@@ -299,12 +305,15 @@ avx_component_op_query(struct ompi_op_t *op, int *priority)
             }
 #endif
         }
+        /* The binary16 conversions of the scalar tail need F16C */
+        if( !(mca_op_avx_component.flags & OMPI_OP_AVX_HAS_F16C_FLAG) ) {
+            module->opm_fns[OMPI_OP_BASE_TYPE_SHORT_FLOAT] = NULL;
+            module->opm_3buff_fns[OMPI_OP_BASE_TYPE_SHORT_FLOAT] = NULL;
+        }
         break;
     case OMPI_OP_BASE_FORTRAN_LAND:
     case OMPI_OP_BASE_FORTRAN_LOR:
     case OMPI_OP_BASE_FORTRAN_LXOR:
-    case OMPI_OP_BASE_FORTRAN_MAXLOC:
-    case OMPI_OP_BASE_FORTRAN_MINLOC:
     case OMPI_OP_BASE_FORTRAN_REPLACE:
     default:
         break;
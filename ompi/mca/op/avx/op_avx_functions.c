@@ -21,6 +21,7 @@
 #include "ompi/op/op.h"
 #include "ompi/mca/op/op.h"
 #include "ompi/mca/op/base/base.h"
+#include "ompi/mca/op/base/functions.h"
 #include "ompi/mca/op/avx/op_avx.h"
 
 #include <immintrin.h>
@@ -1339,6 +1340,428 @@ static void OP_CONCAT(ompi_op_avx_3buff_##op##_double,PREPEND)(const void *_in1,
     // not defined - OP_AVX_FLOAT_FUNC_3(xor)
     // not defined - OP_AVX_DOUBLE_FUNC_3(xor)
 
+/*************************************************************************
+ * MINLOC / MAXLOC on the pair types (MPI_2INT, MPI_FLOAT_INT and
+ * MPI_DOUBLE_INT), for both the 2 and 3 buffers versions.
+ *
+ * The pairs are loaded as they are laid out in memory, the value and the
+ * index being interleaved. The comparison is done on the values, and the
+ * resulting mask is extended to the corresponding index before selecting
+ * the winning pair. On ties the smallest index is kept, exactly as in the
+ * base implementation. The padding of MPI_DOUBLE_INT is never loaded nor
+ * stored, the masked load/store instructions take care of skipping it.
+ *
+ * (a op b) selects a, so op is > for maxloc and < for minloc. When the
+ * values are equal the 2 buffers version keeps the value from the inout
+ * buffer (b) while the 3 buffers version takes it from the first input
+ * (a), as the base functions do.
+ *************************************************************************/
+typedef struct { int v; int k; } ompi_op_avx_2int_t;
+typedef struct { float v; int k; } ompi_op_avx_float_int_t;
+typedef struct { double v; int k; } ompi_op_avx_double_int_t;
+
+#define OP_AVX_LOC_maxloc_CMPGT(A, B) (A), (B)
+#define OP_AVX_LOC_minloc_CMPGT(A, B) (B), (A)
+#define OP_AVX_LOC_maxloc_PREDICATE _CMP_GT_OQ
+#define OP_AVX_LOC_minloc_PREDICATE _CMP_LT_OQ
+
+#if defined(GENERATE_AVX512_CODE) && defined(OMPI_MCA_OP_HAVE_AVX512) && (1 == OMPI_MCA_OP_HAVE_AVX512)
+#if __AVX512F__
+/* Spread the mask of the even 64-bits lanes onto the first 32-bits lane of each pair */
+#define OP_AVX_AVX512_SPREAD_MASK8(m)                                   \
+    ((__mmask16)(((m) & 0x01) | (((m) & 0x04) << 2) | (((m) & 0x10) << 4) | (((m) & 0x40) << 6)))
+
+#define OP_AVX_AVX512_2INT_LOC(name, tie_from_a)                        \
+    if( OMPI_OP_AVX_HAS_FLAGS(OMPI_OP_AVX_HAS_AVX512F_FLAG) ) {         \
+        types_per_step = (512 / 8) / sizeof(*out);                      \
+        for (; left_over >= types_per_step; left_over -= types_per_step) { \
+            __m512i vecA = _mm512_loadu_si512((__m512i*)in1);           \
+            __m512i vecB = _mm512_loadu_si512((__m512i*)in2);           \
+            in1 += types_per_step;                                      \
+            in2 += types_per_step;                                      \
+            __mmask16 win = _mm512_cmpgt_epi32_mask(OP_AVX_LOC_##name##_CMPGT(vecA, vecB)) & 0x5555; \
+            __mmask16 tie = _mm512_cmpeq_epi32_mask(vecA, vecB) & 0x5555; \
+            __mmask16 take_a = win | (win << 1) | ((tie_from_a) ? tie : 0); \
+            __m512i res = _mm512_mask_blend_epi32(take_a, vecB, vecA);  \
+            res = _mm512_mask_min_epi32(res, tie << 1, vecA, vecB);     \
+            _mm512_storeu_si512((__m512i*)out, res);                    \
+            out += types_per_step;                                      \
+        }                                                               \
+        if( 0 == left_over ) return;                                    \
+    }
+
+#define OP_AVX_AVX512_FLOAT_INT_LOC(name, tie_from_a)                   \
+    if( OMPI_OP_AVX_HAS_FLAGS(OMPI_OP_AVX_HAS_AVX512F_FLAG) ) {         \
+        types_per_step = (512 / 8) / sizeof(*out);                      \
+        for (; left_over >= types_per_step; left_over -= types_per_step) { \
+            __m512i vecA = _mm512_loadu_si512((__m512i*)in1);           \
+            __m512i vecB = _mm512_loadu_si512((__m512i*)in2);           \
+            in1 += types_per_step;                                      \
+            in2 += types_per_step;                                      \
+            __mmask16 win = _mm512_mask_cmp_ps_mask(0x5555, _mm512_castsi512_ps(vecA), \
+                                                    _mm512_castsi512_ps(vecB), \
+                                                    OP_AVX_LOC_##name##_PREDICATE); \
+            __mmask16 tie = _mm512_mask_cmp_ps_mask(0x5555, _mm512_castsi512_ps(vecA), \
+                                                    _mm512_castsi512_ps(vecB), _CMP_EQ_OQ); \
+            __mmask16 take_a = win | (win << 1) | ((tie_from_a) ? tie : 0); \
+            __m512i res = _mm512_mask_blend_epi32(take_a, vecB, vecA);  \
+            res = _mm512_mask_min_epi32(res, tie << 1, vecA, vecB);     \
+            _mm512_storeu_si512((__m512i*)out, res);                    \
+            out += types_per_step;                                      \
+        }                                                               \
+        if( 0 == left_over ) return;                                    \
+    }
+
+#define OP_AVX_AVX512_DOUBLE_INT_LOC(name, tie_from_a)                  \
+    if( OMPI_OP_AVX_HAS_FLAGS(OMPI_OP_AVX_HAS_AVX512F_FLAG) ) {         \
+        types_per_step = (512 / 8) / sizeof(*out);                      \
+        for (; left_over >= types_per_step; left_over -= types_per_step) { \
+            __m512i vecA = _mm512_maskz_loadu_epi32(0x7777, in1);       \
+            __m512i vecB = _mm512_maskz_loadu_epi32(0x7777, in2);       \
+            in1 += types_per_step;                                      \
+            in2 += types_per_step;                                      \
+            __mmask8 win8 = _mm512_mask_cmp_pd_mask(0x55, _mm512_castsi512_pd(vecA), \
+                                                    _mm512_castsi512_pd(vecB), \
+                                                    OP_AVX_LOC_##name##_PREDICATE); \
+            __mmask8 tie8 = _mm512_mask_cmp_pd_mask(0x55, _mm512_castsi512_pd(vecA), \
+                                                    _mm512_castsi512_pd(vecB), _CMP_EQ_OQ); \
+            __mmask16 win = OP_AVX_AVX512_SPREAD_MASK8(win8);           \
+            __mmask16 tie = OP_AVX_AVX512_SPREAD_MASK8(tie8);           \
+            __mmask16 take_a = (win * 7) | ((tie_from_a) ? (tie * 3) : 0); \
+            __m512i res = _mm512_mask_blend_epi32(take_a, vecB, vecA);  \
+            res = _mm512_mask_min_epi32(res, tie << 2, vecA, vecB);     \
+            _mm512_mask_storeu_epi32(out, 0x7777, res);                 \
+            out += types_per_step;                                      \
+        }                                                               \
+        if( 0 == left_over ) return;                                    \
+    }
+#else
+#error Target architecture lacks AVX512F support needed for _mm512_mask_blend_epi32 and _mm512_mask_min_epi32
+#endif  /* __AVX512F__ */
+#else
+#define OP_AVX_AVX512_2INT_LOC(name, tie_from_a) {}
+#define OP_AVX_AVX512_FLOAT_INT_LOC(name, tie_from_a) {}
+#define OP_AVX_AVX512_DOUBLE_INT_LOC(name, tie_from_a) {}
+#endif  /* defined(OMPI_MCA_OP_HAVE_AVX512) && (1 == OMPI_MCA_OP_HAVE_AVX512) */
+
+#if defined(GENERATE_AVX2_CODE) && defined(OMPI_MCA_OP_HAVE_AVX2) && (1 == OMPI_MCA_OP_HAVE_AVX2)
+#if __AVX2__
+/*
+ * The values are duplicated over the index lanes before the comparison, so
+ * that the resulting masks cover the entire pair.
+ */
+#define OP_AVX_AVX2_2INT_LOC(name, tie_from_a)                          \
+    if( OMPI_OP_AVX_HAS_FLAGS(OMPI_OP_AVX_HAS_AVX2_FLAG | OMPI_OP_AVX_HAS_AVX_FLAG) ) { \
+        const __m256i idx = _mm256_set_epi32(-1, 0, -1, 0, -1, 0, -1, 0); \
+        types_per_step = (256 / 8) / sizeof(*out);                      \
+        for( ; left_over >= types_per_step; left_over -= types_per_step ) { \
+            __m256i vecA = _mm256_loadu_si256((__m256i*)in1);           \
+            __m256i vecB = _mm256_loadu_si256((__m256i*)in2);           \
+            in1 += types_per_step;                                      \
+            in2 += types_per_step;                                      \
+            __m256i valA = _mm256_shuffle_epi32(vecA, _MM_SHUFFLE(2, 2, 0, 0)); \
+            __m256i valB = _mm256_shuffle_epi32(vecB, _MM_SHUFFLE(2, 2, 0, 0)); \
+            __m256i win = _mm256_cmpgt_epi32(OP_AVX_LOC_##name##_CMPGT(valA, valB)); \
+            __m256i tie = _mm256_cmpeq_epi32(valA, valB);               \
+            if( tie_from_a ) win = _mm256_or_si256(win, _mm256_andnot_si256(idx, tie)); \
+            __m256i res = _mm256_blendv_epi8(vecB, vecA, win);          \
+            res = _mm256_blendv_epi8(res, _mm256_min_epi32(vecA, vecB), _mm256_and_si256(tie, idx)); \
+            _mm256_storeu_si256((__m256i*)out, res);                    \
+            out += types_per_step;                                      \
+        }                                                               \
+        if( 0 == left_over ) return;                                    \
+    }
+
+#define OP_AVX_AVX2_FLOAT_INT_LOC(name, tie_from_a)                     \
+    if( OMPI_OP_AVX_HAS_FLAGS(OMPI_OP_AVX_HAS_AVX2_FLAG | OMPI_OP_AVX_HAS_AVX_FLAG) ) { \
+        const __m256i idx = _mm256_set_epi32(-1, 0, -1, 0, -1, 0, -1, 0); \
+        types_per_step = (256 / 8) / sizeof(*out);                      \
+        for( ; left_over >= types_per_step; left_over -= types_per_step ) { \
+            __m256i vecA = _mm256_loadu_si256((__m256i*)in1);           \
+            __m256i vecB = _mm256_loadu_si256((__m256i*)in2);           \
+            in1 += types_per_step;                                      \
+            in2 += types_per_step;                                      \
+            __m256 valA = _mm256_moveldup_ps(_mm256_castsi256_ps(vecA)); \
+            __m256 valB = _mm256_moveldup_ps(_mm256_castsi256_ps(vecB)); \
+            __m256i win = _mm256_castps_si256(_mm256_cmp_ps(valA, valB, OP_AVX_LOC_##name##_PREDICATE)); \
+            __m256i tie = _mm256_castps_si256(_mm256_cmp_ps(valA, valB, _CMP_EQ_OQ)); \
+            if( tie_from_a ) win = _mm256_or_si256(win, _mm256_andnot_si256(idx, tie)); \
+            __m256i res = _mm256_blendv_epi8(vecB, vecA, win);          \
+            res = _mm256_blendv_epi8(res, _mm256_min_epi32(vecA, vecB), _mm256_and_si256(tie, idx)); \
+            _mm256_storeu_si256((__m256i*)out, res);                    \
+            out += types_per_step;                                      \
+        }                                                               \
+        if( 0 == left_over ) return;                                    \
+    }
+
+#define OP_AVX_AVX2_DOUBLE_INT_LOC(name, tie_from_a)                    \
+    if( OMPI_OP_AVX_HAS_FLAGS(OMPI_OP_AVX_HAS_AVX2_FLAG | OMPI_OP_AVX_HAS_AVX_FLAG) ) { \
+        const __m256i data = _mm256_set_epi32(0, -1, -1, -1, 0, -1, -1, -1); \
+        const __m256i val = _mm256_set_epi32(0, 0, -1, -1, 0, 0, -1, -1); \
+        const __m256i idx = _mm256_set_epi32(0, -1, 0, 0, 0, -1, 0, 0); \
+        types_per_step = (256 / 8) / sizeof(*out);                      \
+        for( ; left_over >= types_per_step; left_over -= types_per_step ) { \
+            __m256i vecA = _mm256_maskload_epi32((const int*)in1, data); \
+            __m256i vecB = _mm256_maskload_epi32((const int*)in2, data); \
+            in1 += types_per_step;                                      \
+            in2 += types_per_step;                                      \
+            __m256d valA = _mm256_unpacklo_pd(_mm256_castsi256_pd(vecA), _mm256_castsi256_pd(vecA)); \
+            __m256d valB = _mm256_unpacklo_pd(_mm256_castsi256_pd(vecB), _mm256_castsi256_pd(vecB)); \
+            __m256i win = _mm256_castpd_si256(_mm256_cmp_pd(valA, valB, OP_AVX_LOC_##name##_PREDICATE)); \
+            __m256i tie = _mm256_castpd_si256(_mm256_cmp_pd(valA, valB, _CMP_EQ_OQ)); \
+            if( tie_from_a ) win = _mm256_or_si256(win, _mm256_and_si256(val, tie)); \
+            __m256i res = _mm256_blendv_epi8(vecB, vecA, win);          \
+            res = _mm256_blendv_epi8(res, _mm256_min_epi32(vecA, vecB), _mm256_and_si256(tie, idx)); \
+            _mm256_maskstore_epi32((int*)out, data, res);               \
+            out += types_per_step;                                      \
+        }                                                               \
+        if( 0 == left_over ) return;                                    \
+    }
+#else
+#error Target architecture lacks AVX2 support needed for _mm256_blendv_epi8 and _mm256_min_epi32
+#endif  /* __AVX2__ */
+#else
+#define OP_AVX_AVX2_2INT_LOC(name, tie_from_a) {}
+#define OP_AVX_AVX2_FLOAT_INT_LOC(name, tie_from_a) {}
+#define OP_AVX_AVX2_DOUBLE_INT_LOC(name, tie_from_a) {}
+#endif  /* defined(OMPI_MCA_OP_HAVE_AVX2) && (1 == OMPI_MCA_OP_HAVE_AVX2) */
+
+#if (defined(GENERATE_AVX512_CODE) && defined(OMPI_MCA_OP_HAVE_AVX512) && (1 == OMPI_MCA_OP_HAVE_AVX512)) || \
+    (defined(GENERATE_AVX2_CODE) && defined(OMPI_MCA_OP_HAVE_AVX2) && (1 == OMPI_MCA_OP_HAVE_AVX2))
+#define OP_AVX_HAS_LOC_FUNCTIONS 1
+
+#define OP_AVX_LOC_FUNC(name, type_name, TYPE_NAME, op)                 \
+static void OP_CONCAT(ompi_op_avx_2buff_##name##_##type_name,PREPEND)(const void *_in, void *_out, int *count, \
+                                                                      struct ompi_datatype_t **dtype, \
+                                                                      struct ompi_op_base_module_1_0_0_t *module) \
+{                                                                       \
+    int types_per_step, left_over = *count;                             \
+    const ompi_op_avx_##type_name##_t *in1 = (const ompi_op_avx_##type_name##_t*)_in; \
+    const ompi_op_avx_##type_name##_t *in2 = (const ompi_op_avx_##type_name##_t*)_out; \
+    ompi_op_avx_##type_name##_t *out = (ompi_op_avx_##type_name##_t*)_out; \
+    OP_AVX_AVX512_##TYPE_NAME##_LOC(name, 0);                           \
+    OP_AVX_AVX2_##TYPE_NAME##_LOC(name, 0);                             \
+    for( ; left_over > 0; left_over--, in1++, out++ ) {                 \
+        if( in1->v op out->v ) {                                        \
+            out->v = in1->v;                                            \
+            out->k = in1->k;                                            \
+        } else if( in1->v == out->v ) {                                 \
+            out->k = (out->k < in1->k ? out->k : in1->k);               \
+        }                                                               \
+    }                                                                   \
+    (void)in2;                                                          \
+}                                                                       \
+static void OP_CONCAT(ompi_op_avx_3buff_##name##_##type_name,PREPEND)(const void *_in1, const void *_in2, \
+                                                                      void *_out, int *count, \
+                                                                      struct ompi_datatype_t **dtype, \
+                                                                      struct ompi_op_base_module_1_0_0_t *module) \
+{                                                                       \
+    int types_per_step, left_over = *count;                             \
+    const ompi_op_avx_##type_name##_t *in1 = (const ompi_op_avx_##type_name##_t*)_in1; \
+    const ompi_op_avx_##type_name##_t *in2 = (const ompi_op_avx_##type_name##_t*)_in2; \
+    ompi_op_avx_##type_name##_t *out = (ompi_op_avx_##type_name##_t*)_out; \
+    OP_AVX_AVX512_##TYPE_NAME##_LOC(name, 1);                           \
+    OP_AVX_AVX2_##TYPE_NAME##_LOC(name, 1);                             \
+    for( ; left_over > 0; left_over--, in1++, in2++, out++ ) {          \
+        if( in1->v op in2->v ) {                                        \
+            out->v = in1->v;                                            \
+            out->k = in1->k;                                            \
+        } else if( in1->v == in2->v ) {                                 \
+            out->v = in1->v;                                            \
+            out->k = (in2->k < in1->k ? in2->k : in1->k);               \
+        } else {                                                        \
+            out->v = in2->v;                                            \
+            out->k = in2->k;                                            \
+        }                                                               \
+    }                                                                   \
+}
+
+    OP_AVX_LOC_FUNC(maxloc, 2int, 2INT, >)
+    OP_AVX_LOC_FUNC(maxloc, float_int, FLOAT_INT, >)
+    OP_AVX_LOC_FUNC(maxloc, double_int, DOUBLE_INT, >)
+    OP_AVX_LOC_FUNC(minloc, 2int, 2INT, <)
+    OP_AVX_LOC_FUNC(minloc, float_int, FLOAT_INT, <)
+    OP_AVX_LOC_FUNC(minloc, double_int, DOUBLE_INT, <)
+#endif  /* OP_AVX_HAS_LOC_FUNCTIONS */
+
+/*************************************************************************
+ * Half precision floating point: MPIX_SHORT_FLOAT (when it is an IEEE
+ * binary16) and MPIX_BFLOAT16, for MPI_MAX, MPI_MIN, MPI_SUM and MPI_PROD,
+ * for both the 2 and 3 buffers versions.
+ *
+ * There is no half precision arithmetic involved: the elements are widened
+ * to fp32 (F16C/AVX512F conversions for binary16, a 16 bits shift for
+ * bfloat16), the operation is done in fp32 and the result is rounded back
+ * to nearest-even. fp32 has more than twice the precision of both formats,
+ * so this single rounding gives the same result as the native operation.
+ *************************************************************************/
+#if (defined(HAVE_SHORT_FLOAT) && (2 == SIZEOF_SHORT_FLOAT)) || \
+    (!defined(HAVE_SHORT_FLOAT) && defined(HAVE_OPAL_SHORT_FLOAT_T))
+#define OP_AVX_HAS_BINARY16_SHORT_FLOAT 1
+#endif
+
+/* The scalar binary16 conversions need F16C, which is not implied by the
+ * AVX2 and AVX512F compiler flags. */
+#if defined(__F16C__)
+#define OP_AVX_short_float_ATTR
+#else
+#define OP_AVX_short_float_ATTR __attribute__((__target__("f16c")))
+#endif  /* defined(__F16C__) */
+#define OP_AVX_bfloat16_ATTR
+
+#define OP_AVX_short_float_FLAGS OMPI_OP_AVX_HAS_F16C_FLAG
+#define OP_AVX_bfloat16_FLAGS    0
+
+#define OP_AVX_short_float_TO_FLOAT(h)  _cvtsh_ss(h)
+#define OP_AVX_short_float_FROM_FLOAT(f) _cvtss_sh((f), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+#define OP_AVX_bfloat16_TO_FLOAT(h)     ompi_op_base_bfloat16_to_float(h)
+#define OP_AVX_bfloat16_FROM_FLOAT(f)   ompi_op_base_float_to_bfloat16(f)
+
+#define OP_AVX_HALF_max(A, B) ((A) > (B) ? (A) : (B))
+#define OP_AVX_HALF_min(A, B) ((A) < (B) ? (A) : (B))
+#define OP_AVX_HALF_add(A, B) ((A) + (B))
+#define OP_AVX_HALF_mul(A, B) ((A) * (B))
+
+#if defined(GENERATE_AVX512_CODE) && defined(OMPI_MCA_OP_HAVE_AVX512) && (1 == OMPI_MCA_OP_HAVE_AVX512)
+#if __AVX512F__
+#define OP_AVX_AVX512_short_float_LOAD(p) \
+    _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)(p)))
+#define OP_AVX_AVX512_short_float_STORE(p, v) \
+    _mm256_storeu_si256((__m256i*)(p), _mm512_cvtps_ph((v), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC))
+#define OP_AVX_AVX512_bfloat16_LOAD(p) \
+    _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*)(p))), 16))
+/* Round to nearest-even on the integer representation, and keep the NaNs quiet */
+#define OP_AVX_AVX512_bfloat16_STORE(p, v)                              \
+    do {                                                                \
+        __m512i bits = _mm512_castps_si512(v);                          \
+        __m512i lsb = _mm512_and_si512(_mm512_srli_epi32(bits, 16), _mm512_set1_epi32(1)); \
+        __m512i rnd = _mm512_add_epi32(bits, _mm512_add_epi32(lsb, _mm512_set1_epi32(0x7fff))); \
+        __mmask16 nan = _mm512_cmp_ps_mask((v), (v), _CMP_UNORD_Q);     \
+        rnd = _mm512_mask_or_epi32(rnd, nan, bits, _mm512_set1_epi32(0x00400000)); \
+        _mm256_storeu_si256((__m256i*)(p), _mm512_cvtepi32_epi16(_mm512_srli_epi32(rnd, 16))); \
+    } while (0)
+
+#define OP_AVX_AVX512_HALF_FUNC(type_name, op)                          \
+    if( OMPI_OP_AVX_HAS_FLAGS(OMPI_OP_AVX_HAS_AVX512F_FLAG) ) {         \
+        types_per_step = (512 / 8) / sizeof(float);                     \
+        for( ; left_over >= types_per_step; left_over -= types_per_step ) { \
+            __m512 vecA = OP_AVX_AVX512_##type_name##_LOAD(in1);        \
+            __m512 vecB = OP_AVX_AVX512_##type_name##_LOAD(in2);        \
+            in1 += types_per_step;                                      \
+            in2 += types_per_step;                                      \
+            __m512 res = _mm512_##op##_ps(vecA, vecB);                  \
+            OP_AVX_AVX512_##type_name##_STORE(out, res);                \
+            out += types_per_step;                                      \
+        }                                                               \
+        if( 0 == left_over ) return;                                    \
+    }
+#else
+#error Target architecture lacks AVX512F support needed for _mm512_cvtph_ps and _mm512_cvtepi32_epi16
+#endif  /* __AVX512F__ */
+#else
+#define OP_AVX_AVX512_HALF_FUNC(type_name, op) {}
+#endif  /* defined(OMPI_MCA_OP_HAVE_AVX512) && (1 == OMPI_MCA_OP_HAVE_AVX512) */
+
+#if defined(GENERATE_AVX2_CODE) && defined(OMPI_MCA_OP_HAVE_AVX2) && (1 == OMPI_MCA_OP_HAVE_AVX2)
+#if __AVX2__
+#define OP_AVX_AVX2_short_float_LOAD(p) \
+    _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(p)))
+#define OP_AVX_AVX2_short_float_STORE(p, v) \
+    _mm_storeu_si128((__m128i*)(p), _mm256_cvtps_ph((v), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC))
+#define OP_AVX_AVX2_bfloat16_LOAD(p) \
+    _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(p))), 16))
+/* Round to nearest-even on the integer representation, and keep the NaNs quiet */
+#define OP_AVX_AVX2_bfloat16_STORE(p, v)                                \
+    do {                                                                \
+        __m256i bits = _mm256_castps_si256(v);                          \
+        __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1)); \
+        __m256i rnd = _mm256_add_epi32(bits, _mm256_add_epi32(lsb, _mm256_set1_epi32(0x7fff))); \
+        __m256i nan = _mm256_castps_si256(_mm256_cmp_ps((v), (v), _CMP_UNORD_Q)); \
+        __m256i qnan = _mm256_or_si256(bits, _mm256_set1_epi32(0x00400000)); \
+        rnd = _mm256_srli_epi32(_mm256_blendv_epi8(rnd, qnan, nan), 16); \
+        _mm_storeu_si128((__m128i*)(p), _mm_packus_epi32(_mm256_castsi256_si128(rnd), \
+                                                         _mm256_extracti128_si256(rnd, 1))); \
+    } while (0)
+
+#define OP_AVX_AVX2_HALF_FUNC(type_name, op)                            \
+    if( OMPI_OP_AVX_HAS_FLAGS(OMPI_OP_AVX_HAS_AVX2_FLAG | OMPI_OP_AVX_HAS_AVX_FLAG | \
+                              OP_AVX_##type_name##_FLAGS) ) {           \
+        types_per_step = (256 / 8) / sizeof(float);                     \
+        for( ; left_over >= types_per_step; left_over -= types_per_step ) { \
+            __m256 vecA = OP_AVX_AVX2_##type_name##_LOAD(in1);          \
+            __m256 vecB = OP_AVX_AVX2_##type_name##_LOAD(in2);          \
+            in1 += types_per_step;                                      \
+            in2 += types_per_step;                                      \
+            __m256 res = _mm256_##op##_ps(vecA, vecB);                  \
+            OP_AVX_AVX2_##type_name##_STORE(out, res);                  \
+            out += types_per_step;                                      \
+        }                                                               \
+        if( 0 == left_over ) return;                                    \
+    }
+#else
+#error Target architecture lacks AVX2 support needed for _mm256_cvtepu16_epi32 and _mm256_extracti128_si256
+#endif  /* __AVX2__ */
+#else
+#define OP_AVX_AVX2_HALF_FUNC(type_name, op) {}
+#endif  /* defined(OMPI_MCA_OP_HAVE_AVX2) && (1 == OMPI_MCA_OP_HAVE_AVX2) */
+
+#if (defined(GENERATE_AVX512_CODE) && defined(OMPI_MCA_OP_HAVE_AVX512) && (1 == OMPI_MCA_OP_HAVE_AVX512)) || \
+    (defined(GENERATE_AVX2_CODE) && defined(OMPI_MCA_OP_HAVE_AVX2) && (1 == OMPI_MCA_OP_HAVE_AVX2))
+#define OP_AVX_HAS_HALF_FUNCTIONS 1
+
+/*
+ * The first operand is the inout buffer for the 2 buffers version, which
+ * matches the operand order of the base implementation for MPI_MAX and
+ * MPI_MIN (and thus which of the two values is kept for NaN and signed
+ * zeros).
+ */
+#define OP_AVX_HALF_FUNC(name, type_name)                               \
+static OP_AVX_##type_name##_ATTR                                        \
+void OP_CONCAT(ompi_op_avx_2buff_##name##_##type_name,PREPEND)(const void *_in, void *_out, int *count, \
+                                                               struct ompi_datatype_t **dtype, \
+                                                               struct ompi_op_base_module_1_0_0_t *module) \
+{                                                                       \
+    int types_per_step, left_over = *count;                             \
+    const uint16_t *in1 = (const uint16_t*)_out;                        \
+    const uint16_t *in2 = (const uint16_t*)_in;                         \
+    uint16_t *out = (uint16_t*)_out;                                    \
+    OP_AVX_AVX512_HALF_FUNC(type_name, name);                           \
+    OP_AVX_AVX2_HALF_FUNC(type_name, name);                             \
+    for( ; left_over > 0; left_over--, in1++, in2++, out++ ) {          \
+        *out = OP_AVX_##type_name##_FROM_FLOAT(OP_AVX_HALF_##name(OP_AVX_##type_name##_TO_FLOAT(*in1), \
+                                                                  OP_AVX_##type_name##_TO_FLOAT(*in2))); \
+    }                                                                   \
+}                                                                       \
+static OP_AVX_##type_name##_ATTR                                        \
+void OP_CONCAT(ompi_op_avx_3buff_##name##_##type_name,PREPEND)(const void *_in1, const void *_in2, \
+                                                               void *_out, int *count, \
+                                                               struct ompi_datatype_t **dtype, \
+                                                               struct ompi_op_base_module_1_0_0_t *module) \
+{                                                                       \
+    int types_per_step, left_over = *count;                             \
+    const uint16_t *in1 = (const uint16_t*)_in1;                        \
+    const uint16_t *in2 = (const uint16_t*)_in2;                        \
+    uint16_t *out = (uint16_t*)_out;                                    \
+    OP_AVX_AVX512_HALF_FUNC(type_name, name);                           \
+    OP_AVX_AVX2_HALF_FUNC(type_name, name);                             \
+    for( ; left_over > 0; left_over--, in1++, in2++, out++ ) {          \
+        *out = OP_AVX_##type_name##_FROM_FLOAT(OP_AVX_HALF_##name(OP_AVX_##type_name##_TO_FLOAT(*in1), \
+                                                                  OP_AVX_##type_name##_TO_FLOAT(*in2))); \
+    }                                                                   \
+}
+
+#if defined(OP_AVX_HAS_BINARY16_SHORT_FLOAT)
+    OP_AVX_HALF_FUNC(max, short_float)
+    OP_AVX_HALF_FUNC(min, short_float)
+    OP_AVX_HALF_FUNC(add, short_float)
+    OP_AVX_HALF_FUNC(mul, short_float)
+#endif  /* defined(OP_AVX_HAS_BINARY16_SHORT_FLOAT) */
+    OP_AVX_HALF_FUNC(max, bfloat16)
+    OP_AVX_HALF_FUNC(min, bfloat16)
+    OP_AVX_HALF_FUNC(add, bfloat16)
+    OP_AVX_HALF_FUNC(mul, bfloat16)
+#endif  /* OP_AVX_HAS_HALF_FUNCTIONS */
+
 /** C integer ***********************************************************/
 #define C_INTEGER_8_16_32(name, ftype)                                                         \
     [OMPI_OP_BASE_TYPE_INT8_T]   = OP_CONCAT(ompi_op_avx_##ftype##_##name##_int8_t,PREPEND),   \
@@ -1367,11 +1790,33 @@ static void OP_CONCAT(ompi_op_avx_3buff_##op##_double,PREPEND)(const void *_in1,
 #define FLOAT(name, ftype) OP_CONCAT(ompi_op_avx_##ftype##_##name##_float,PREPEND)
 #define DOUBLE(name, ftype) OP_CONCAT(ompi_op_avx_##ftype##_##name##_double,PREPEND)
 
+#if defined(OP_AVX_HAS_HALF_FUNCTIONS) && defined(OP_AVX_HAS_BINARY16_SHORT_FLOAT)
+#define SHORT_FLOAT(name, ftype) OP_CONCAT(ompi_op_avx_##ftype##_##name##_short_float,PREPEND)
+#else
+#define SHORT_FLOAT(name, ftype) NULL
+#endif  /* defined(OP_AVX_HAS_HALF_FUNCTIONS) && defined(OP_AVX_HAS_BINARY16_SHORT_FLOAT) */
+#if defined(OP_AVX_HAS_HALF_FUNCTIONS)
+#define BFLOAT16(name, ftype) OP_CONCAT(ompi_op_avx_##ftype##_##name##_bfloat16,PREPEND)
+#else
+#define BFLOAT16(name, ftype) NULL
+#endif  /* defined(OP_AVX_HAS_HALF_FUNCTIONS) */
+
 #define FLOATING_POINT(name, ftype)                                         \
-    [OMPI_OP_BASE_TYPE_SHORT_FLOAT] = NULL,                                 \
+    [OMPI_OP_BASE_TYPE_SHORT_FLOAT] = SHORT_FLOAT(name, ftype),             \
+    [OMPI_OP_BASE_TYPE_BFLOAT16] = BFLOAT16(name, ftype),                   \
     [OMPI_OP_BASE_TYPE_FLOAT] = FLOAT(name, ftype),                         \
     [OMPI_OP_BASE_TYPE_DOUBLE] = DOUBLE(name, ftype)
 
+/** MINLOC / MAXLOC pair types ******************************************/
+#if defined(OP_AVX_HAS_LOC_FUNCTIONS)
+#define LOC_PAIRS(name, ftype)                                                                    \
+    [OMPI_OP_BASE_TYPE_2INT]       = OP_CONCAT(ompi_op_avx_##ftype##_##name##_2int,PREPEND),       \
+    [OMPI_OP_BASE_TYPE_FLOAT_INT]  = OP_CONCAT(ompi_op_avx_##ftype##_##name##_float_int,PREPEND),  \
+    [OMPI_OP_BASE_TYPE_DOUBLE_INT] = OP_CONCAT(ompi_op_avx_##ftype##_##name##_double_int,PREPEND)
+#else
+#define LOC_PAIRS(name, ftype) NULL
+#endif  /* defined(OP_AVX_HAS_LOC_FUNCTIONS) */
+
 /*
  * MPI_OP_NULL
  * All types
@@ -1433,6 +1878,14 @@ ompi_op_base_handler_fn_t OP_CONCAT(ompi_op_avx_functions, PREPEND)[OMPI_OP_BASE
     [OMPI_OP_BASE_FORTRAN_BXOR] = {
         C_INTEGER(bxor, 2buff),
     },
+    /* Corresponds to MPI_MAXLOC */
+    [OMPI_OP_BASE_FORTRAN_MAXLOC] = {
+        LOC_PAIRS(maxloc, 2buff),
+    },
+    /* Corresponds to MPI_MINLOC */
+    [OMPI_OP_BASE_FORTRAN_MINLOC] = {
+        LOC_PAIRS(minloc, 2buff),
+    },
     /* Corresponds to MPI_REPLACE */
     [OMPI_OP_BASE_FORTRAN_REPLACE] = {
         /* (MPI_ACCUMULATE is handled differently than the other
@@ -1496,6 +1949,14 @@ ompi_op_base_3buff_handler_fn_t OP_CONCAT(ompi_op_avx_3buff_functions, PREPEND)[
     [OMPI_OP_BASE_FORTRAN_BXOR] = {
         C_INTEGER(xor, 3buff),
     },
+    /* Corresponds to MPI_MAXLOC */
+    [OMPI_OP_BASE_FORTRAN_MAXLOC] = {
+        LOC_PAIRS(maxloc, 3buff),
+    },
+    /* Corresponds to MPI_MINLOC */
+    [OMPI_OP_BASE_FORTRAN_MINLOC] = {
+        LOC_PAIRS(minloc, 3buff),
+    },
     /* Corresponds to MPI_REPLACE */
     [OMPI_OP_BASE_FORTRAN_REPLACE] = {
         /* MPI_ACCUMULATE is handled differently than the other
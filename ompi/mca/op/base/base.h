@@ -93,6 +93,24 @@ int ompi_op_base_op_select(struct ompi_op_t *op);
  */
 OMPI_DECLSPEC int ompi_op_base_op_unselect(struct ompi_op_t *op);
 
+/**
+ * Parallel execution of large intrinsic reductions.
+ *
+ * ompi_op_base_parallel_init() computes the size above which the
+ * reductions are split across the helper threads from the MCA
+ * parameters, and ompi_op_base_parallel_finalize() stops the helper
+ * threads (they are only started by the first large reduction).
+ */
+int ompi_op_base_parallel_init(void);
+void ompi_op_base_parallel_finalize(void);
+
+/** Number of helper threads (op_base_parallel_threads) */
+OMPI_DECLSPEC extern int ompi_op_base_parallel_threads;
+/** Smallest reduction, in bytes, executed in parallel (op_base_parallel_min_bytes) */
+OMPI_DECLSPEC extern size_t ompi_op_base_parallel_min_bytes;
+/** Smallest amount of work, in bytes, given to a thread (op_base_parallel_min_chunk) */
+OMPI_DECLSPEC extern size_t ompi_op_base_parallel_min_chunk;
+
 OMPI_DECLSPEC extern mca_base_framework_t ompi_op_base_framework;
 
 END_C_DECLS
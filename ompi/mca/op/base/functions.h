@@ -24,11 +24,44 @@
 #define OMPI_OP_BASE_FUNCTIONS_H
 
 #include "ompi_config.h"
+
+#include <stdint.h>
+#include <string.h>
+
 #include "ompi/mca/op/op.h"
 
 
 BEGIN_C_DECLS
 
+/**
+ * bfloat16 is the upper half of an IEEE single precision value, so
+ * widening it is a shift.
+ */
+static inline float ompi_op_base_bfloat16_to_float(uint16_t value)
+{
+    uint32_t bits = ((uint32_t) value) << 16;
+    float f;
+
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+/**
+ * Narrow a single precision value to bfloat16, rounding to the nearest
+ * even. NaNs are kept quiet instead of being rounded into infinities.
+ */
+static inline uint16_t ompi_op_base_float_to_bfloat16(float value)
+{
+    uint32_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+    if ((bits & 0x7fffffffu) > 0x7f800000u) {
+        return (uint16_t) ((bits >> 16) | 0x0040u);
+    }
+    bits += 0x7fffu + ((bits >> 16) & 1u);
+    return (uint16_t) (bits >> 16);
+}
+
 /**
  * Globals holding all the "base" function pointers, indexed by op and
  * datatype.
@@ -59,5 +59,60 @@ OBJ_CLASS_INSTANCE(ompi_op_base_module_t, opal_object_t,
 OBJ_CLASS_INSTANCE(ompi_op_base_module_1_0_0_t, opal_object_t,
                    module_constructor_1_0_0, NULL);
 
-MCA_BASE_FRAMEWORK_DECLARE(ompi, op, NULL, NULL, NULL, NULL,
-                           mca_op_base_static_components, 0);
+static int ompi_op_base_register(mca_base_register_flag_t flags)
+{
+    ompi_op_base_parallel_threads = 0;
+    (void) mca_base_framework_var_register(&ompi_op_base_framework, "parallel_threads",
+                                           "Number of helper threads used to execute large "
+                                           "reductions on intrinsic operations, in addition to "
+                                           "the calling thread (0 disables the parallel execution)",
+                                           MCA_BASE_VAR_TYPE_INT, NULL, 0, 0,
+                                           OPAL_INFO_LVL_5,
+                                           MCA_BASE_VAR_SCOPE_READONLY,
+                                           &ompi_op_base_parallel_threads);
+
+    ompi_op_base_parallel_min_bytes = 32 * 1024 * 1024;
+    (void) mca_base_framework_var_register(&ompi_op_base_framework, "parallel_min_bytes",
+                                           "Size in bytes above which a reduction is split "
+                                           "across the helper threads",
+                                           MCA_BASE_VAR_TYPE_SIZE_T, NULL, 0, 0,
+                                           OPAL_INFO_LVL_5,
+                                           MCA_BASE_VAR_SCOPE_READONLY,
+                                           &ompi_op_base_parallel_min_bytes);
+
+    ompi_op_base_parallel_min_chunk = 1024 * 1024;
+    (void) mca_base_framework_var_register(&ompi_op_base_framework, "parallel_min_chunk",
+                                           "Smallest amount of data in bytes reduced by each "
+                                           "thread taking part in a parallel reduction",
+                                           MCA_BASE_VAR_TYPE_SIZE_T, NULL, 0, 0,
+                                           OPAL_INFO_LVL_6,
+                                           MCA_BASE_VAR_SCOPE_READONLY,
+                                           &ompi_op_base_parallel_min_chunk);
+    if (0 == ompi_op_base_parallel_min_chunk) {
+        ompi_op_base_parallel_min_chunk = 1;
+    }
+
+    return OMPI_SUCCESS;
+}
+
+static int ompi_op_base_open(mca_base_open_flag_t flags)
+{
+    int ret;
+
+    ret = mca_base_framework_components_open(&ompi_op_base_framework, flags);
+    if (OMPI_SUCCESS != ret) {
+        return ret;
+    }
+
+    return ompi_op_base_parallel_init();
+}
+
+static int ompi_op_base_close(void)
+{
+    ompi_op_base_parallel_finalize();
+
+    return mca_base_framework_components_close(&ompi_op_base_framework, NULL);
+}
+
+MCA_BASE_FRAMEWORK_DECLARE(ompi, op, NULL, ompi_op_base_register, ompi_op_base_open,
+                           ompi_op_base_close, mca_op_base_static_components, 0);
@@ -28,6 +28,7 @@
 #endif
 
 #include "ompi/mca/op/op.h"
+#include "ompi/mca/op/base/functions.h"
 
 
 /*
@@ -146,6 +147,26 @@
       }                                                                  \
   }
 
+/*
+ * bfloat16 has no C type: the values are widened to float, combined
+ * with current_func and the result is rounded back to bfloat16.
+ *
+ * This macro is for (out = op(out, in))
+ */
+#define BFLOAT16_FUNC(name) \
+  static void ompi_op_base_2buff_##name##_bfloat16(const void *in, void *out, int *count, \
+                                                   struct ompi_datatype_t **dtype, \
+                                                   struct ompi_op_base_module_1_0_0_t *module) \
+  {                                                                      \
+      int i;                                                             \
+      const uint16_t *a = (const uint16_t *) in;                         \
+      uint16_t *b = (uint16_t *) out;                                    \
+      for (i = *count; i > 0; i--, ++a, ++b) {                           \
+          *b = ompi_op_base_float_to_bfloat16(current_func(ompi_op_base_bfloat16_to_float(*b), \
+                                                           ompi_op_base_bfloat16_to_float(*a))); \
+      }                                                                  \
+  }
+
 /*************************************************************************
  * Max
  *************************************************************************/
@@ -189,6 +210,7 @@ FUNC_FUNC(max, short_float, short float)
 #elif defined(HAVE_OPAL_SHORT_FLOAT_T)
 FUNC_FUNC(max, short_float, opal_short_float_t)
 #endif
+BFLOAT16_FUNC(max)
 FUNC_FUNC(max, float, float)
 FUNC_FUNC(max, double, double)
 FUNC_FUNC(max, long_double, long double)
@@ -255,6 +277,7 @@ FUNC_FUNC(min, short_float, short float)
 #elif defined(HAVE_OPAL_SHORT_FLOAT_T)
 FUNC_FUNC(min, short_float, opal_short_float_t)
 #endif
+BFLOAT16_FUNC(min)
 FUNC_FUNC(min, float, float)
 FUNC_FUNC(min, double, double)
 FUNC_FUNC(min, long_double, long double)
@@ -318,6 +341,9 @@ OP_FUNC(sum, short_float, short float, +=)
 #elif defined(HAVE_OPAL_SHORT_FLOAT_T)
 OP_FUNC(sum, short_float, opal_short_float_t, +=)
 #endif
+#undef current_func
+#define current_func(a, b) ((a) + (b))
+BFLOAT16_FUNC(sum)
 OP_FUNC(sum, float, float, +=)
 OP_FUNC(sum, double, double, +=)
 OP_FUNC(sum, long_double, long double, +=)
@@ -390,6 +416,9 @@ OP_FUNC(prod, short_float, short float, *=)
 #elif defined(HAVE_OPAL_SHORT_FLOAT_T)
 OP_FUNC(prod, short_float, opal_short_float_t, *=)
 #endif
+#undef current_func
+#define current_func(a, b) ((a) * (b))
+BFLOAT16_FUNC(prod)
 OP_FUNC(prod, float, float, *=)
 OP_FUNC(prod, double, double, *=)
 OP_FUNC(prod, long_double, long double, *=)
@@ -806,6 +835,26 @@ LOC_FUNC(minloc, long_double_int, <)
       }                                                                  \
   }
 
+/*
+ * bfloat16 has no C type: the values are widened to float, combined
+ * with current_func and the result is rounded back to bfloat16.
+ */
+#define BFLOAT16_FUNC_3BUF(name) \
+  static void ompi_op_base_3buff_##name##_bfloat16(const void * restrict in1, \
+                                                   const void * restrict in2, void * restrict out, int *count, \
+                                                   struct ompi_datatype_t **dtype, \
+                                                   struct ompi_op_base_module_1_0_0_t *module) \
+  {                                                                      \
+      int i;                                                             \
+      const uint16_t *a1 = (const uint16_t *) in1;                       \
+      const uint16_t *a2 = (const uint16_t *) in2;                       \
+      uint16_t *b = (uint16_t *) out;                                    \
+      for (i = *count; i > 0; i--, ++a1, ++a2, ++b) {                    \
+          *b = ompi_op_base_float_to_bfloat16(current_func(ompi_op_base_bfloat16_to_float(*a1), \
+                                                           ompi_op_base_bfloat16_to_float(*a2))); \
+      }                                                                  \
+  }
+
 /*************************************************************************
  * Max
  *************************************************************************/
@@ -849,6 +898,7 @@ FUNC_FUNC_3BUF(max, short_float, short float)
 #elif defined(HAVE_OPAL_SHORT_FLOAT_T)
 FUNC_FUNC_3BUF(max, short_float, opal_short_float_t)
 #endif
+BFLOAT16_FUNC_3BUF(max)
 FUNC_FUNC_3BUF(max, float, float)
 FUNC_FUNC_3BUF(max, double, double)
 FUNC_FUNC_3BUF(max, long_double, long double)
@@ -915,6 +965,7 @@ FUNC_FUNC_3BUF(min, short_float, short float)
 #elif defined(HAVE_OPAL_SHORT_FLOAT_T)
 FUNC_FUNC_3BUF(min, short_float, opal_short_float_t)
 #endif
+BFLOAT16_FUNC_3BUF(min)
 FUNC_FUNC_3BUF(min, float, float)
 FUNC_FUNC_3BUF(min, double, double)
 FUNC_FUNC_3BUF(min, long_double, long double)
@@ -978,6 +1029,9 @@ OP_FUNC_3BUF(sum, short_float, short float, +)
 #elif defined(HAVE_OPAL_SHORT_FLOAT_T)
 OP_FUNC_3BUF(sum, short_float, opal_short_float_t, +)
 #endif
+#undef current_func
+#define current_func(a, b) ((a) + (b))
+BFLOAT16_FUNC_3BUF(sum)
 OP_FUNC_3BUF(sum, float, float, +)
 OP_FUNC_3BUF(sum, double, double, +)
 OP_FUNC_3BUF(sum, long_double, long double, +)
@@ -1050,6 +1104,9 @@ OP_FUNC_3BUF(prod, short_float, short float, *)
 #elif defined(HAVE_OPAL_SHORT_FLOAT_T)
 OP_FUNC_3BUF(prod, short_float, opal_short_float_t, *)
 #endif
+#undef current_func
+#define current_func(a, b) ((a) * (b))
+BFLOAT16_FUNC_3BUF(prod)
 OP_FUNC_3BUF(prod, float, float, *)
 OP_FUNC_3BUF(prod, double, double, *)
 OP_FUNC_3BUF(prod, long_double, long double, *)
@@ -1463,6 +1520,7 @@ LOC_FUNC_3BUF(minloc, long_double_int, <)
 
 #define FLOATING_POINT(name, ftype)                                                            \
   [OMPI_OP_BASE_TYPE_SHORT_FLOAT] = SHORT_FLOAT(name, ftype),                                  \
+  [OMPI_OP_BASE_TYPE_BFLOAT16] = ompi_op_base_##ftype##_##name##_bfloat16,                     \
   [OMPI_OP_BASE_TYPE_FLOAT] = FLOAT(name, ftype),                                              \
   [OMPI_OP_BASE_TYPE_DOUBLE] = DOUBLE(name, ftype),                                            \
   FLOATING_POINT_FORTRAN_REAL(name, ftype),                                                    \
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+/**
+ * @file
+ *
+ * Parallel execution of large intrinsic reductions.
+ *
+ * A single core cannot saturate the memory bandwidth of a socket, so
+ * very large reductions (as seen in the reduce step of the segmented
+ * allreduce/reduce algorithms) are split in contiguous chunks, and the
+ * chunks are handed out to a small pool of persistent helper threads.
+ * The calling thread takes part in the work, and every chunk is
+ * reduced by the same (possibly vectorized) function the op selected
+ * for the datatype, so the result is bitwise identical to the serial
+ * execution.
+ *
+ * Only one reduction at a time uses the pool; concurrent callers fall
+ * back to the serial execution.
+ */
+
+#include "ompi_config.h"
+
+#include <stdint.h>
+
+#include "opal/mca/threads/threads.h"
+#include "opal/mca/threads/mutex.h"
+#include "opal/sys/atomic.h"
+#include "opal/util/output.h"
+
+#include "ompi/constants.h"
+#include "ompi/op/op.h"
+#include "ompi/mca/op/base/base.h"
+
+/* Chunks are rounded to a multiple of this many elements, to keep them
+ * on distinct cache lines for all the predefined types. */
+#define OMPI_OP_BASE_PARALLEL_CHUNK_ALIGN 64
+
+typedef struct ompi_op_base_parallel_job_t {
+    ompi_op_t *op;
+    const char *source1;  /* NULL for the 2 buffers flavor */
+    const char *source2;
+    char *target;
+    ompi_datatype_t *dtype;
+    int dtype_id;
+    ptrdiff_t extent;
+    size_t count;
+    size_t chunk;         /* elements per chunk */
+    int32_t nchunks;
+    opal_atomic_int32_t next;    /* next chunk to hand out */
+    opal_atomic_int32_t done;    /* number of completed chunks */
+    opal_atomic_int32_t active;  /* helpers still looking at this job */
+} ompi_op_base_parallel_job_t;
+
+static struct {
+    opal_thread_internal_mutex_t lock;  /* protects job, generation and shutdown */
+    opal_thread_internal_cond_t cond;
+    ompi_op_base_parallel_job_t *job;
+    uint64_t generation;
+    bool shutdown;
+    bool started;
+    int nthreads;
+    opal_thread_t *threads;
+} ompi_op_base_parallel_pool = {
+    .lock = OPAL_THREAD_INTERNAL_MUTEX_INITIALIZER,
+    .cond = OPAL_THREAD_INTERNAL_COND_INITIALIZER,
+};
+
+/* Serializes the users of the pool */
+static opal_mutex_t ompi_op_base_parallel_dispatch_lock = OPAL_MUTEX_STATIC_INIT;
+
+size_t ompi_op_base_parallel_threshold = SIZE_MAX;
+int ompi_op_base_parallel_threads = 0;
+size_t ompi_op_base_parallel_min_bytes = 32 * 1024 * 1024;
+size_t ompi_op_base_parallel_min_chunk = 1024 * 1024;
+
+static void op_parallel_run(ompi_op_base_parallel_job_t *job)
+{
+    ompi_datatype_t *dtype = job->dtype;
+    int32_t idx;
+
+    while ((idx = opal_atomic_fetch_add_32(&job->next, 1)) < job->nchunks) {
+        size_t first = (size_t) idx * job->chunk;
+        size_t shift = first * job->extent;
+        int count = (int) (job->count - first < job->chunk ? job->count - first : job->chunk);
+
+        if (NULL == job->source1) {
+            job->op->o_func.intrinsic.fns[job->dtype_id](job->source2 + shift,
+                                                         job->target + shift, &count, &dtype,
+                                                         job->op->o_func.intrinsic.modules[job->dtype_id]);
+        } else {
+            job->op->o_3buff_intrinsic.fns[job->dtype_id](job->source1 + shift,
+                                                          job->source2 + shift,
+                                                          job->target + shift, &count, &dtype,
+                                                          job->op->o_3buff_intrinsic.modules[job->dtype_id]);
+        }
+        opal_atomic_wmb();
+        (void) opal_atomic_add_fetch_32(&job->done, 1);
+    }
+}
+
+static void *op_parallel_worker(opal_object_t *obj)
+{
+    uint64_t seen = 0;
+
+    for (;;) {
+        ompi_op_base_parallel_job_t *job;
+
+        opal_thread_internal_mutex_lock(&ompi_op_base_parallel_pool.lock);
+        while (seen == ompi_op_base_parallel_pool.generation
+               && !ompi_op_base_parallel_pool.shutdown) {
+            opal_thread_internal_cond_wait(&ompi_op_base_parallel_pool.cond,
+                                           &ompi_op_base_parallel_pool.lock);
+        }
+        if (ompi_op_base_parallel_pool.shutdown) {
+            opal_thread_internal_mutex_unlock(&ompi_op_base_parallel_pool.lock);
+            return NULL;
+        }
+        seen = ompi_op_base_parallel_pool.generation;
+        /* The job is released by its owner once completed, so a late
+         * helper might find nothing to do. */
+        job = ompi_op_base_parallel_pool.job;
+        if (NULL != job) {
+            (void) opal_atomic_add_fetch_32(&job->active, 1);
+        }
+        opal_thread_internal_mutex_unlock(&ompi_op_base_parallel_pool.lock);
+
+        if (NULL != job) {
+            op_parallel_run(job);
+            (void) opal_atomic_add_fetch_32(&job->active, -1);
+        }
+    }
+}
+
+static int op_parallel_start(void)
+{
+    ompi_op_base_parallel_pool.threads = (opal_thread_t *) calloc(ompi_op_base_parallel_threads,
+                                                                  sizeof(opal_thread_t));
+    if (NULL == ompi_op_base_parallel_pool.threads) {
+        return OMPI_ERR_OUT_OF_RESOURCE;
+    }
+
+    for (int i = 0; i < ompi_op_base_parallel_threads; ++i) {
+        opal_thread_t *thread = &ompi_op_base_parallel_pool.threads[i];
+
+        OBJ_CONSTRUCT(thread, opal_thread_t);
+        thread->t_run = op_parallel_worker;
+        thread->t_arg = NULL;
+        if (OPAL_SUCCESS != opal_thread_start(thread)) {
+            OBJ_DESTRUCT(thread);
+            break;
+        }
+        ompi_op_base_parallel_pool.nthreads++;
+    }
+
+    opal_output_verbose(10, ompi_op_base_framework.framework_output,
+                        "op:base:parallel: started %d helper threads for reductions above %"
+                        PRIsize_t " bytes", ompi_op_base_parallel_pool.nthreads,
+                        ompi_op_base_parallel_threshold);
+
+    return (0 == ompi_op_base_parallel_pool.nthreads) ? OMPI_ERR_NOT_AVAILABLE : OMPI_SUCCESS;
+}
+
+int ompi_op_base_parallel_init(void)
+{
+    if (ompi_op_base_parallel_threads <= 0) {
+        ompi_op_base_parallel_threshold = SIZE_MAX;
+        return OMPI_SUCCESS;
+    }
+    /* Each participant must get at least one chunk */
+    ompi_op_base_parallel_threshold = ompi_op_base_parallel_min_bytes;
+    if (ompi_op_base_parallel_threshold < 2 * ompi_op_base_parallel_min_chunk) {
+        ompi_op_base_parallel_threshold = 2 * ompi_op_base_parallel_min_chunk;
+    }
+    return OMPI_SUCCESS;
+}
+
+void ompi_op_base_parallel_finalize(void)
+{
+    ompi_op_base_parallel_threshold = SIZE_MAX;
+    if (!ompi_op_base_parallel_pool.started) {
+        return;
+    }
+
+    opal_thread_internal_mutex_lock(&ompi_op_base_parallel_pool.lock);
+    ompi_op_base_parallel_pool.shutdown = true;
+    opal_thread_internal_cond_broadcast(&ompi_op_base_parallel_pool.cond);
+    opal_thread_internal_mutex_unlock(&ompi_op_base_parallel_pool.lock);
+
+    for (int i = 0; i < ompi_op_base_parallel_pool.nthreads; ++i) {
+        (void) opal_thread_join(&ompi_op_base_parallel_pool.threads[i], NULL);
+        OBJ_DESTRUCT(&ompi_op_base_parallel_pool.threads[i]);
+    }
+    free(ompi_op_base_parallel_pool.threads);
+    ompi_op_base_parallel_pool.threads = NULL;
+    ompi_op_base_parallel_pool.nthreads = 0;
+    ompi_op_base_parallel_pool.shutdown = false;
+    ompi_op_base_parallel_pool.started = false;
+}
+
+int ompi_op_base_parallel_reduce(ompi_op_t *op, const void *source1, const void *source2,
+                                 void *target, size_t count, ompi_datatype_t *dtype, int dtype_id)
+{
+    ompi_op_base_parallel_job_t job;
+    size_t bytes = count * dtype->super.size;
+    size_t nparts;
+    ptrdiff_t lb;
+
+    /* The pool is busy with another reduction: do not wait for it */
+    if (0 != opal_mutex_trylock(&ompi_op_base_parallel_dispatch_lock)) {
+        return OMPI_ERR_WOULD_BLOCK;
+    }
+
+    if (OPAL_UNLIKELY(!ompi_op_base_parallel_pool.started)) {
+        ompi_op_base_parallel_pool.started = true;
+        if (OMPI_SUCCESS != op_parallel_start()) {
+            /* Don't try again, run everything serially from now on */
+            ompi_op_base_parallel_threshold = SIZE_MAX;
+            opal_mutex_unlock(&ompi_op_base_parallel_dispatch_lock);
+            return OMPI_ERR_NOT_AVAILABLE;
+        }
+    }
+
+    nparts = bytes / ompi_op_base_parallel_min_chunk;
+    if (nparts > (size_t) ompi_op_base_parallel_pool.nthreads + 1) {
+        nparts = (size_t) ompi_op_base_parallel_pool.nthreads + 1;
+    }
+    if (nparts < 2) {
+        opal_mutex_unlock(&ompi_op_base_parallel_dispatch_lock);
+        return OMPI_ERR_NOT_SUPPORTED;
+    }
+
+    job.op = op;
+    job.source1 = (const char *) source1;
+    job.source2 = (const char *) source2;
+    job.target = (char *) target;
+    job.dtype = dtype;
+    job.dtype_id = dtype_id;
+    ompi_datatype_get_extent(dtype, &lb, &job.extent);
+    job.count = count;
+    job.chunk = (count + nparts - 1) / nparts;
+    job.chunk = (job.chunk + OMPI_OP_BASE_PARALLEL_CHUNK_ALIGN - 1)
+                / OMPI_OP_BASE_PARALLEL_CHUNK_ALIGN * OMPI_OP_BASE_PARALLEL_CHUNK_ALIGN;
+    job.nchunks = (int32_t) ((count + job.chunk - 1) / job.chunk);
+    job.next = 0;
+    job.done = 0;
+    job.active = 0;
+
+    opal_thread_internal_mutex_lock(&ompi_op_base_parallel_pool.lock);
+    ompi_op_base_parallel_pool.job = &job;
+    ompi_op_base_parallel_pool.generation++;
+    opal_thread_internal_cond_broadcast(&ompi_op_base_parallel_pool.cond);
+    opal_thread_internal_mutex_unlock(&ompi_op_base_parallel_pool.lock);
+
+    op_parallel_run(&job);
+    while (job.done < job.nchunks) {
+        opal_atomic_rmb();
+    }
+
+    /* Retire the job, and wait for the helpers that picked it up to let
+     * go of it before it goes out of scope. */
+    opal_thread_internal_mutex_lock(&ompi_op_base_parallel_pool.lock);
+    ompi_op_base_parallel_pool.job = NULL;
+    opal_thread_internal_mutex_unlock(&ompi_op_base_parallel_pool.lock);
+    while (0 != job.active) {
+        opal_atomic_rmb();
+    }
+    opal_atomic_rmb();
+
+    opal_mutex_unlock(&ompi_op_base_parallel_dispatch_lock);
+    return OMPI_SUCCESS;
+}
@@ -134,6 +134,8 @@ enum {
 
     /** Floating point: short float */
     OMPI_OP_BASE_TYPE_SHORT_FLOAT,
+    /** Floating point: bfloat16 (stored as uint16_t) */
+    OMPI_OP_BASE_TYPE_BFLOAT16,
     /** Floating point: float */
     OMPI_OP_BASE_TYPE_FLOAT,
     /** Floating point: double */
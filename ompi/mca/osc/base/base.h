@@ -44,6 +44,9 @@ int ompi_osc_base_find_available(bool enable_progress_threads,
 void ompi_osc_base_set_memory_alignment(struct opal_info_t *info,
                                         size_t *memory_alignment);
 
+void ompi_osc_base_set_acc_lock_stripes(struct opal_info_t *info,
+                                        unsigned int *acc_lock_stripes);
+
 int ompi_osc_base_select(ompi_win_t *win,
                          void **base,
                          size_t size,
@@ -65,6 +68,42 @@ static inline __opal_attribute_always_inline__ bool ompi_osc_base_is_atomic_size
             (sizeof(uint64_t) == size && !(remote_addr & 0x7)));
 }
 
+/* Striped accumulate locks: the memory of a target is split in chunks of
+ * stripe_size bytes, and chunk i is protected by lock i % stripes. This
+ * returns the locks protecting [offset, offset + length) as the range
+ * first .. first + count - 1, modulo stripes.
+ * Currently used with sm and rdma.
+ */
+static inline void ompi_osc_base_acc_lock_range(uint64_t offset, size_t length,
+                                                unsigned int stripe_size, unsigned int stripes,
+                                                unsigned int *first, unsigned int *count)
+{
+    uint64_t lo = offset / stripe_size;
+    uint64_t hi = (offset + (length ? length : 1) - 1) / stripe_size;
+
+    if (hi - lo + 1 >= stripes) {
+        *first = 0;
+        *count = stripes;
+    } else {
+        *first = (unsigned int) (lo % stripes);
+        *count = (unsigned int) (hi - lo + 1);
+    }
+}
+
+/* Index of the i-th lock of a range. Locks are returned in increasing
+ * order, so that processes taking overlapping ranges cannot deadlock. */
+static inline unsigned int ompi_osc_base_acc_lock_index(unsigned int first, unsigned int count,
+                                                        unsigned int stripes, unsigned int i)
+{
+    if (first + count > stripes) {
+        unsigned int wrapped = first + count - stripes;
+
+        return (i < wrapped) ? i : first + (i - wrapped);
+    }
+
+    return first + i;
+}
+
 END_C_DECLS
 
 #endif
@@ -56,6 +56,23 @@ ompi_osc_base_set_memory_alignment(struct opal_info_t *info,
     }
 }
 
+void
+ompi_osc_base_set_acc_lock_stripes(struct opal_info_t *info,
+                                   unsigned int *acc_lock_stripes)
+{
+    int flag;
+    opal_cstring_t *stripes_info_str;
+
+    opal_info_get(info, "acc_lock_stripes", &stripes_info_str, &flag);
+    if (flag) {
+        int tmp_stripes = atoi(stripes_info_str->string);
+        OBJ_RELEASE(stripes_info_str);
+        if (0 <= tmp_stripes) {
+            *acc_lock_stripes = tmp_stripes;
+        }
+    }
+}
+
 static int ompi_osc_base_finalize(void)
 {
     opal_list_item_t* item;
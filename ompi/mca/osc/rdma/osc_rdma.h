@@ -32,6 +32,7 @@
 #include "ompi_config.h"
 #include "opal/class/opal_free_list.h"
 #include "opal/class/opal_hash_table.h"
+#include "opal/class/opal_rb_tree.h"
 #include "opal/mca/threads/threads.h"
 #include "opal/util/output.h"
 
@@ -84,6 +85,9 @@ struct ompi_osc_rdma_component_t {
     /** Free list of requests */
     opal_free_list_t requests;
 
+    /** free list of ompi_osc_rdma_aggregation_t structures */
+    opal_free_list_t aggregations;
+
     /** RDMA component buffer size */
     unsigned int buffer_size;
 
@@ -108,6 +112,15 @@ struct ompi_osc_rdma_component_t {
     /** Use network AMOs when available */
     bool acc_use_amo;
 
+    /** Default number of striped accumulate locks per process (0: single lock) */
+    unsigned int acc_lock_stripes;
+
+    /** Size of the window chunks mapped to the striped accumulate locks */
+    unsigned int acc_lock_stripe_size;
+
+    /** Maximum size of a combined small put or get operation (0: disabled) */
+    unsigned int aggregation_limit;
+
     /** Priority of the osc/rdma component */
     unsigned int priority;
 
@@ -158,6 +171,19 @@ struct ompi_osc_rdma_module_t {
 
     bool acc_use_amo;
 
+    /** number of striped accumulate locks in the state of each peer (0: use
+     * the accumulate lock of the state structure) */
+    unsigned int acc_lock_stripes;
+
+    /** size of the memory chunks mapped to the striped accumulate locks */
+    unsigned int acc_lock_stripe_size;
+
+    /** offset of the striped accumulate locks in the state segment */
+    size_t acc_lock_offset;
+
+    /** acc_lock_stripes as reported in the window info */
+    char acc_lock_stripes_info[16];
+
     /** whether the group is located on a single node */
     bool single_node;
 
@@ -289,6 +315,11 @@ struct ompi_osc_rdma_module_t {
     size_t put_limit;
     size_t get_limit;
 
+    /** maximum size of combined small put and get operations. 0 when the
+     * operations can not be combined with the selected btl(s) */
+    size_t put_aggregation_limit;
+    size_t get_aggregation_limit;
+
     uint32_t atomic_flags;
 
     /** registered fragment used for locally buffered RDMA transfers */
@@ -298,6 +329,20 @@ struct ompi_osc_rdma_module_t {
      * in the state structure as it is entirely local. */
     ompi_osc_rdma_handle_t **dynamic_handles;
 
+    /** locally attached regions sorted by base address. the values are pointers to
+     * the slots of the region array in the state structure */
+    opal_rb_tree_t *dynamic_regions;
+
+    /** unused slots of the region array in the state structure */
+    int *dynamic_free_slots;
+
+    /** number of entries in dynamic_free_slots */
+    int dynamic_free_count;
+
+    /** incremented by synchronization calls. the cached region table of a peer
+     * is revalidated on the first access after a change of this value */
+    uint32_t dynamic_epoch;
+
     /** shared memory segment. this segment holds this node's portion of the rank -> node
      * mapping array, node communication data (node_comm_info), state for all local ranks,
      * and data for all local ranks (MPI_Win_allocate only) */
@@ -614,10 +659,17 @@ static inline void ompi_osc_rdma_sync_rdma_dec (ompi_osc_rdma_sync_t *rdma_sync)
 /**
  * @brief complete all outstanding rdma operations to all peers
  *
- * @param[in] module          osc rdma module
+ * @param[in] sync            synchronization object
+ *
+ * @returns OMPI_SUCCESS, or the error of a combined operation that failed
+ *          since the last completion of the sync
  */
-static inline void ompi_osc_rdma_sync_rdma_complete (ompi_osc_rdma_sync_t *sync)
+static inline int ompi_osc_rdma_sync_rdma_complete (ompi_osc_rdma_sync_t *sync)
 {
+    if (!opal_list_is_empty (&sync->aggregations)) {
+        ompi_osc_rdma_sync_aggregations_flush (sync);
+    }
+
 #if !defined(BTL_VERSION) || (BTL_VERSION < 310)
     do {
         opal_progress ();
@@ -633,6 +685,8 @@ static inline void ompi_osc_rdma_sync_rdma_complete (ompi_osc_rdma_sync_t *sync)
         }
     }  while (ompi_osc_rdma_sync_get_count (sync) || (sync->module->rdma_frag && (sync->module->rdma_frag->pending > 1)));
 #endif
+
+    return opal_atomic_swap_32 (&sync->aggregation_error, OMPI_SUCCESS);
 }
 
 /**
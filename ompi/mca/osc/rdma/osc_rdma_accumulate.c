@@ -33,10 +33,51 @@
 #include "ompi/mca/osc/base/base.h"
 #include "ompi/mca/osc/base/osc_base_obj_convert.h"
 
+/**
+ * @brief acquire the accumulate lock(s) protecting a range of the peer's memory
+ *
+ * With striped accumulate locks only the locks covering [address, address + length)
+ * are taken, in increasing order. The range is stored in the peer so it can be
+ * released by ompi_osc_rdma_peer_accumulate_cleanup().
+ */
+static inline void ompi_osc_rdma_peer_accumulate_lock (ompi_osc_rdma_module_t *module, ompi_osc_rdma_peer_t *peer,
+                                                       uint64_t address, size_t length)
+{
+    if (0 == module->acc_lock_stripes) {
+        (void) ompi_osc_rdma_lock_acquire_exclusive (module, peer, offsetof (ompi_osc_rdma_state_t, accumulate_lock));
+        return;
+    }
+
+    ompi_osc_base_acc_lock_range (address, length, module->acc_lock_stripe_size, module->acc_lock_stripes,
+                                  &peer->acc_lock_first, &peer->acc_lock_count);
+    for (unsigned int i = 0 ; i < peer->acc_lock_count ; ++i) {
+        unsigned int idx = ompi_osc_base_acc_lock_index (peer->acc_lock_first, peer->acc_lock_count,
+                                                         module->acc_lock_stripes, i);
+        (void) ompi_osc_rdma_lock_acquire_exclusive (module, peer, module->acc_lock_offset +
+                                                     idx * sizeof (ompi_osc_rdma_lock_t));
+    }
+}
+
+static inline void ompi_osc_rdma_peer_accumulate_unlock (ompi_osc_rdma_module_t *module, ompi_osc_rdma_peer_t *peer)
+{
+    if (0 == module->acc_lock_stripes) {
+        (void) ompi_osc_rdma_lock_release_exclusive (module, peer, offsetof (ompi_osc_rdma_state_t, accumulate_lock));
+        return;
+    }
+
+    for (unsigned int i = 0 ; i < peer->acc_lock_count ; ++i) {
+        unsigned int idx = ompi_osc_base_acc_lock_index (peer->acc_lock_first, peer->acc_lock_count,
+                                                         module->acc_lock_stripes, i);
+        (void) ompi_osc_rdma_lock_release_exclusive (module, peer, module->acc_lock_offset +
+                                                     idx * sizeof (ompi_osc_rdma_lock_t));
+    }
+    peer->acc_lock_count = 0;
+}
+
 static inline void ompi_osc_rdma_peer_accumulate_cleanup (ompi_osc_rdma_module_t *module, ompi_osc_rdma_peer_t *peer, bool lock_acquired)
 {
     if (lock_acquired) {
-        (void) ompi_osc_rdma_lock_release_exclusive (module, peer, offsetof (ompi_osc_rdma_state_t, accumulate_lock));
+        ompi_osc_rdma_peer_accumulate_unlock (module, peer);
     }
 
     /* clear out the accumulation flag */
@@ -983,7 +1024,7 @@ int ompi_osc_rdma_compare_and_swap (const void *origin_addr, const void *compare
 
     /* get an exclusive lock on the peer */
     if (!ompi_osc_rdma_peer_is_exclusive (peer) && !(module->acc_single_intrinsic || win->w_acc_ops <= OMPI_WIN_ACCUMULATE_OPS_SAME_OP)) {
-        (void) ompi_osc_rdma_lock_acquire_exclusive (module, peer, offsetof (ompi_osc_rdma_state_t, accumulate_lock));
+        ompi_osc_rdma_peer_accumulate_lock (module, peer, target_address + true_lb, true_extent);
         lock_acquired = true;
     }
 
@@ -1010,7 +1051,7 @@ int ompi_osc_rdma_compare_and_swap (const void *origin_addr, const void *compare
     }
 
     if (!(lock_acquired || ompi_osc_rdma_peer_is_exclusive (peer))) {
-        (void) ompi_osc_rdma_lock_acquire_exclusive (module, peer, offsetof (ompi_osc_rdma_state_t, accumulate_lock));
+        ompi_osc_rdma_peer_accumulate_lock (module, peer, target_address + true_lb, true_extent);
         lock_acquired = true;
     }
 
@@ -1087,13 +1128,13 @@ int ompi_osc_rdma_rget_accumulate_internal (ompi_win_t *win, const void *origin_
     /* get an exclusive lock on the peer if needed */
     if (!ompi_osc_rdma_peer_is_exclusive (peer) && !module->acc_single_intrinsic) {
         lock_acquired = true;
-        (void) ompi_osc_rdma_lock_acquire_exclusive (module, peer, offsetof (ompi_osc_rdma_state_t, accumulate_lock));
+        ompi_osc_rdma_peer_accumulate_lock (module, peer, target_address + target_lb, target_span);
     }
 
     /* could not use network atomics. acquire the lock if needed and continue. */
     if (!lock_acquired && !ompi_osc_rdma_peer_is_exclusive (peer)) {
         lock_acquired = true;
-        (void) ompi_osc_rdma_lock_acquire_exclusive (module, peer, offsetof (ompi_osc_rdma_state_t, accumulate_lock));
+        ompi_osc_rdma_peer_accumulate_lock (module, peer, target_address + target_lb, target_span);
     }
 
     if (ompi_osc_rdma_peer_cpu_atomics (peer)) {
@@ -30,6 +30,7 @@
 #include "osc_rdma.h"
 #include "osc_rdma_frag.h"
 #include "osc_rdma_active_target.h"
+#include "osc_rdma_dynamic.h"
 
 #include "mpi.h"
 #include "opal/mca/threads/mutex.h"
@@ -343,6 +344,8 @@ int ompi_osc_rdma_start_atomic (ompi_group_t *group, int mpi_assert, ompi_win_t
 
     OPAL_THREAD_LOCK(&module->lock);
 
+    ompi_osc_rdma_dynamic_invalidate (module);
+
     /* check if we are already in an access epoch */
     if (ompi_osc_rdma_access_epoch_active (module)) {
         OPAL_THREAD_UNLOCK(&module->lock);
@@ -424,7 +427,7 @@ int ompi_osc_rdma_complete_atomic (ompi_win_t *win)
     ompi_osc_rdma_peer_t **peers;
     ompi_group_t *group;
     int group_size;
-    int ret __opal_attribute_unused__;
+    int ret __opal_attribute_unused__, rc;
 
     OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_TRACE, "complete: %s", win->w_name);
 
@@ -457,7 +460,7 @@ int ompi_osc_rdma_complete_atomic (ompi_win_t *win)
 
     OPAL_THREAD_UNLOCK(&(module->lock));
 
-    ompi_osc_rdma_sync_rdma_complete (sync);
+    rc = ompi_osc_rdma_sync_rdma_complete (sync);
 
     /* for each process in the group increment their number of complete messages */
     for (int i = 0 ; i < group_size ; ++i) {
@@ -477,7 +480,7 @@ int ompi_osc_rdma_complete_atomic (ompi_win_t *win)
 
     OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_TRACE, "complete complete");
 
-    return OMPI_SUCCESS;
+    return rc;
 }
 
 int ompi_osc_rdma_wait_atomic (ompi_win_t *win)
@@ -566,7 +569,7 @@ int ompi_osc_rdma_test_atomic (ompi_win_t *win, int *flag)
 int ompi_osc_rdma_fence_atomic (int mpi_assert, ompi_win_t *win)
 {
     ompi_osc_rdma_module_t *module = GET_MODULE(win);
-    int ret = OMPI_SUCCESS;
+    int ret = OMPI_SUCCESS, rc;
 
     OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_TRACE, "fence: %d, %s", mpi_assert, win->w_name);
 
@@ -576,6 +579,8 @@ int ompi_osc_rdma_fence_atomic (int mpi_assert, ompi_win_t *win)
         return OMPI_ERR_RMA_SYNC;
     }
 
+    ompi_osc_rdma_dynamic_invalidate (module);
+
     /* NTH: locking here isn't really needed per-se but it may make user synchronization errors more
      * predictable. if the user is using RMA correctly then there will be no contention on this lock. */
     OPAL_THREAD_LOCK(&module->lock);
@@ -597,10 +602,13 @@ int ompi_osc_rdma_fence_atomic (int mpi_assert, ompi_win_t *win)
      * may be local stores that will not be visible as they should if we do not barrier. since that is the
      * case there is no optimization for NOPRECEDE */
 
-    ompi_osc_rdma_sync_rdma_complete (&module->all_sync);
+    rc = ompi_osc_rdma_sync_rdma_complete (&module->all_sync);
 
     /* ensure all writes to my memory are complete (both local stores, and RMA operations) */
     ret = module->comm->c_coll->coll_barrier(module->comm, module->comm->c_coll->coll_barrier_module);
+    if (OMPI_SUCCESS == ret) {
+        ret = rc;
+    }
 
     if (mpi_assert & MPI_MODE_NOSUCCEED) {
         /* as specified in MPI-3 p 438 3-5 the fence can end an epoch. it isn't explicitly
@@ -753,6 +753,233 @@ static int ompi_osc_rdma_get_contig (ompi_osc_rdma_sync_t *sync, ompi_osc_rdma_p
     return ret;
 }
 
+OBJ_CLASS_INSTANCE(ompi_osc_rdma_aggregation_t, opal_free_list_item_t, NULL, NULL);
+
+static void ompi_osc_rdma_aggregation_complete (struct mca_btl_base_module_t *btl, struct mca_btl_base_endpoint_t *endpoint,
+                                                void *local_address, mca_btl_base_registration_handle_t *local_handle,
+                                                void *context, void *data, int status)
+{
+    ompi_osc_rdma_aggregation_t *aggregation = (ompi_osc_rdma_aggregation_t *) context;
+    ompi_osc_rdma_sync_t *sync = aggregation->sync;
+    const char *buffer = (const char *) local_address;
+
+    OSC_RDMA_VERBOSE(status ? MCA_BASE_VERBOSE_ERROR : MCA_BASE_VERBOSE_TRACE, "btl %s of %lu combined bytes complete "
+                     "on sync %p. opal status %d", (OMPI_OSC_RDMA_TYPE_PUT == aggregation->type) ? "put" : "get",
+                     (unsigned long) aggregation->buffer_used, (void *) sync, status);
+
+    if (OPAL_UNLIKELY(OPAL_SUCCESS != status)) {
+        sync->aggregation_error = status;
+    } else if (OMPI_OSC_RDMA_TYPE_GET == aggregation->type) {
+        /* scatter the data to the origin buffers */
+        for (int i = 0 ; i < aggregation->get_count ; ++i) {
+            if (OMPI_SUCCESS != osc_rdma_accelerator_mem_copy (aggregation->gets[i].address, buffer,
+                                                               aggregation->gets[i].length)) {
+                /* Can't bubble up this failure, abort */
+                abort();
+            }
+            buffer += aggregation->gets[i].length;
+        }
+    }
+
+    opal_free_list_return (&mca_osc_rdma_component.aggregations, &aggregation->super);
+
+    ompi_osc_rdma_sync_rdma_dec_always (sync);
+}
+
+/**
+ * @brief start the btl operation of a detached aggregation buffer
+ *
+ * The aggregation must no longer be referenced by the peer or the sync. The
+ * buffer is returned to the free list by the completion callback.
+ */
+static void ompi_osc_rdma_aggregation_start (ompi_osc_rdma_aggregation_t *aggregation)
+{
+    ompi_osc_rdma_sync_t *sync = aggregation->sync;
+    ompi_osc_rdma_peer_t *peer = aggregation->peer;
+    ompi_osc_rdma_module_t *module = sync->module;
+    int ret;
+
+    if (0 == aggregation->buffer_used) {
+        opal_free_list_return (&mca_osc_rdma_component.aggregations, &aggregation->super);
+        return;
+    }
+
+    OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_TRACE, "initiating btl %s of %lu combined bytes at remote address %" PRIx64
+                     ", sync object %p", (OMPI_OSC_RDMA_TYPE_PUT == aggregation->type) ? "put" : "get",
+                     (unsigned long) aggregation->buffer_used, aggregation->target_address, (void *) sync);
+
+    /* the callback releases the buffer so it must run before the sync can complete, even
+     * when the btl_flush function is used */
+    ompi_osc_rdma_sync_rdma_inc_always (sync);
+
+    do {
+        if (OMPI_OSC_RDMA_TYPE_PUT == aggregation->type) {
+            ret = ompi_osc_rdma_btl_put (module, peer->data_btl_index, peer->data_endpoint,
+                                         aggregation->super.ptr, aggregation->target_address, NULL,
+                                         aggregation->target_handle, aggregation->buffer_used, 0,
+                                         MCA_BTL_NO_ORDER, ompi_osc_rdma_aggregation_complete, aggregation, NULL);
+            if (OPAL_LIKELY(OMPI_SUCCESS == ret)) {
+                return;
+            }
+            ++module->put_retry_count;
+        } else {
+            ret = ompi_osc_rdma_btl_get (module, peer->data_btl_index, peer->data_endpoint,
+                                         aggregation->super.ptr, aggregation->target_address, NULL,
+                                         aggregation->target_handle, aggregation->buffer_used, 0,
+                                         MCA_BTL_NO_ORDER, ompi_osc_rdma_aggregation_complete, aggregation, NULL);
+            if (OPAL_LIKELY(OMPI_SUCCESS == ret)) {
+                return;
+            }
+            ++module->get_retry_count;
+        }
+
+        if (!ompi_osc_rdma_oor (ret)) {
+            break;
+        }
+
+        /* spin a bit on progress */
+        ompi_osc_rdma_progress (module);
+    } while (1);
+
+    /* the operations were already reported as started. the error is returned by the next
+     * flush or completion of the sync */
+    OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_ERROR, "btl operation on combined buffer failed with opal error code %d", ret);
+    sync->aggregation_error = ret;
+
+    opal_free_list_return (&mca_osc_rdma_component.aggregations, &aggregation->super);
+    ompi_osc_rdma_sync_rdma_dec_always (sync);
+}
+
+void ompi_osc_rdma_sync_aggregations_flush (ompi_osc_rdma_sync_t *sync)
+{
+    ompi_osc_rdma_aggregation_t *aggregation;
+    opal_list_t aggregations;
+
+    OBJ_CONSTRUCT(&aggregations, opal_list_t);
+
+    OPAL_THREAD_LOCK(&sync->lock);
+    OPAL_LIST_FOREACH(aggregation, &sync->aggregations, ompi_osc_rdma_aggregation_t) {
+        aggregation->peer->aggregate = NULL;
+    }
+    opal_list_join (&aggregations, opal_list_get_end (&aggregations), &sync->aggregations);
+    OPAL_THREAD_UNLOCK(&sync->lock);
+
+    while (NULL != (aggregation = (ompi_osc_rdma_aggregation_t *) opal_list_remove_first (&aggregations))) {
+        ompi_osc_rdma_aggregation_start (aggregation);
+    }
+
+    OBJ_DESTRUCT(&aggregations);
+}
+
+/**
+ * @brief combine a small contiguous put or get with the pending operations to a peer
+ *
+ * @returns OMPI_SUCCESS if the operation was added to an aggregation buffer
+ * @returns OMPI_ERR_NOT_AVAILABLE if the operation must be started on its own
+ *
+ * Operations are combined as long as they target adjacent memory covered by the same
+ * registration. A buffer that can not be extended is started and replaced with a new
+ * one. Data of a put is copied into the buffer immediately so the origin buffer can be
+ * reused as soon as this function returns.
+ */
+static int ompi_osc_rdma_aggregate (ompi_osc_rdma_sync_t *sync, ompi_osc_rdma_peer_t *peer, int type,
+                                    void *local_address, size_t local_count, ompi_datatype_t *local_datatype,
+                                    uint64_t remote_address, mca_btl_base_registration_handle_t *remote_handle,
+                                    size_t remote_count, ompi_datatype_t *remote_datatype, size_t limit)
+{
+    ompi_osc_rdma_aggregation_t *aggregation, *full = NULL;
+    size_t len = local_datatype->super.size * local_count;
+    ptrdiff_t lb, extent;
+    int ret = OMPI_SUCCESS;
+
+    if (len > limit || !ompi_datatype_is_contiguous_memory_layout (local_datatype, local_count) ||
+        !ompi_datatype_is_contiguous_memory_layout (remote_datatype, remote_count)) {
+        return OMPI_ERR_NOT_AVAILABLE;
+    }
+
+    /* ignore failure here */
+    (void) ompi_datatype_get_true_extent (local_datatype, &lb, &extent);
+    local_address = (void *)((intptr_t) local_address + lb);
+
+    (void) ompi_datatype_get_true_extent (remote_datatype, &lb, &extent);
+    remote_address += lb;
+
+    OPAL_THREAD_LOCK(&sync->lock);
+
+    aggregation = peer->aggregate;
+    if (NULL != aggregation && OPAL_UNLIKELY(aggregation->sync != sync)) {
+        /* the buffer belongs to another (erroneously overlapping) epoch. leave it alone */
+        OPAL_THREAD_UNLOCK(&sync->lock);
+        return OMPI_ERR_NOT_AVAILABLE;
+    }
+
+    if (NULL != aggregation) {
+        bool extends = (aggregation->type == type && aggregation->target_handle == remote_handle &&
+                        aggregation->target_address + aggregation->buffer_used == remote_address &&
+                        aggregation->buffer_used + len <= limit);
+
+        if (extends && OMPI_OSC_RDMA_TYPE_GET == type && OMPI_OSC_RDMA_AGGREGATION_MAX_GETS == aggregation->get_count) {
+            /* only a get into memory following the last origin buffer can be added */
+            extends = ((char *) aggregation->gets[aggregation->get_count - 1].address +
+                       aggregation->gets[aggregation->get_count - 1].length == (char *) local_address);
+        }
+
+        if (!extends) {
+            opal_list_remove_item (&sync->aggregations, &aggregation->super.super);
+            peer->aggregate = NULL;
+            full = aggregation;
+            aggregation = NULL;
+        }
+    }
+
+    if (NULL == aggregation) {
+        aggregation = (ompi_osc_rdma_aggregation_t *) opal_free_list_get (&mca_osc_rdma_component.aggregations);
+        if (OPAL_UNLIKELY(NULL == aggregation)) {
+            OPAL_THREAD_UNLOCK(&sync->lock);
+            if (full) {
+                ompi_osc_rdma_aggregation_start (full);
+            }
+            return OMPI_ERR_NOT_AVAILABLE;
+        }
+
+        aggregation->sync = sync;
+        aggregation->peer = peer;
+        aggregation->type = type;
+        aggregation->target_address = remote_address;
+        aggregation->target_handle = remote_handle;
+        aggregation->buffer_used = 0;
+        aggregation->get_count = 0;
+
+        opal_list_append (&sync->aggregations, &aggregation->super.super);
+        peer->aggregate = aggregation;
+    }
+
+    if (OMPI_OSC_RDMA_TYPE_PUT == type) {
+        ret = osc_rdma_accelerator_mem_copy ((char *) aggregation->super.ptr + aggregation->buffer_used,
+                                             local_address, len);
+    } else if (aggregation->get_count && (char *) aggregation->gets[aggregation->get_count - 1].address +
+               aggregation->gets[aggregation->get_count - 1].length == (char *) local_address) {
+        aggregation->gets[aggregation->get_count - 1].length += len;
+    } else {
+        aggregation->gets[aggregation->get_count].address = local_address;
+        aggregation->gets[aggregation->get_count].length = len;
+        aggregation->get_count++;
+    }
+
+    if (OPAL_LIKELY(OMPI_SUCCESS == ret)) {
+        aggregation->buffer_used += len;
+    }
+
+    OPAL_THREAD_UNLOCK(&sync->lock);
+
+    if (full) {
+        ompi_osc_rdma_aggregation_start (full);
+    }
+
+    /* fall back on the regular path if the data could not be copied */
+    return (OMPI_SUCCESS == ret) ? OMPI_SUCCESS : OMPI_ERR_NOT_AVAILABLE;
+}
+
 static inline int ompi_osc_rdma_put_w_req (ompi_osc_rdma_sync_t *sync, const void *origin_addr, int origin_count,
                                            ompi_datatype_t *origin_datatype, ompi_osc_rdma_peer_t *peer,
                                            ptrdiff_t target_disp, int target_count,
@@ -791,6 +1018,17 @@ static inline int ompi_osc_rdma_put_w_req (ompi_osc_rdma_sync_t *sync, const voi
                                          target_count, target_datatype, request);
     }
 
+    /* combine small operations without a request. the data is transferred at the latest
+     * when the epoch is flushed or closed */
+    if (NULL == request && module->put_aggregation_limit) {
+        ret = ompi_osc_rdma_aggregate (sync, peer, OMPI_OSC_RDMA_TYPE_PUT, (void *) origin_addr, origin_count,
+                                       origin_datatype, target_address, target_handle, target_count,
+                                       target_datatype, module->put_aggregation_limit);
+        if (OMPI_ERR_NOT_AVAILABLE != ret) {
+            return ret;
+        }
+    }
+
     return ompi_osc_rdma_master (sync, (void *) origin_addr, origin_count, origin_datatype, peer,
                                  target_address, target_handle, target_count, target_datatype, request,
                                  module->put_limit, ompi_osc_rdma_put_contig, false);
@@ -831,6 +1069,15 @@ static inline int ompi_osc_rdma_get_w_req (ompi_osc_rdma_sync_t *sync, void *ori
                                          origin_addr, origin_count, origin_datatype, request);
     }
 
+    if (NULL == request && module->get_aggregation_limit) {
+        ret = ompi_osc_rdma_aggregate (sync, peer, OMPI_OSC_RDMA_TYPE_GET, origin_addr, origin_count,
+                                       origin_datatype, source_address, source_handle, source_count,
+                                       source_datatype, module->get_aggregation_limit);
+        if (OMPI_ERR_NOT_AVAILABLE != ret) {
+            return ret;
+        }
+    }
+
     return ompi_osc_rdma_master (sync, origin_addr, origin_count, origin_datatype, peer, source_address,
                                  source_handle, source_count, source_datatype, request,
                                  module->get_limit, ompi_osc_rdma_get_contig, true);
@@ -85,6 +85,7 @@ static int ompi_osc_rdma_query_accelerated_btls (ompi_communicator_t *comm, ompi
 static int ompi_osc_rdma_query_alternate_btls (ompi_communicator_t *comm, ompi_osc_rdma_module_t *module);
 
 static const char* ompi_osc_rdma_set_no_lock_info(opal_infosubscriber_t *obj, const char *key, const char *value);
+static const char* ompi_osc_rdma_set_acc_lock_stripes_info(opal_infosubscriber_t *obj, const char *key, const char *value);
 
 static char *ompi_osc_rdma_full_connectivity_btls;
 
@@ -218,6 +219,39 @@ static int ompi_osc_rdma_component_register (void)
                                            &mca_osc_rdma_component.acc_use_amo);
     free(description_str);
 
+    mca_osc_rdma_component.acc_lock_stripes = 0;
+    opal_asprintf(&description_str, "Number of locks protecting the window memory of each process "
+             "in accumulate operations that can not use atomic memory operations, so that accumulate "
+             "operations on disjoint parts of the memory can proceed concurrently. 0 uses a single "
+             "lock. Info key of same name overrides this value (default: %u)",
+             mca_osc_rdma_component.acc_lock_stripes);
+    (void) mca_base_component_var_register(&mca_osc_rdma_component.super.osc_version, "acc_lock_stripes",
+                                           description_str, MCA_BASE_VAR_TYPE_UNSIGNED_INT, NULL, 0, 0,
+                                           OPAL_INFO_LVL_5, MCA_BASE_VAR_SCOPE_GROUP,
+                                           &mca_osc_rdma_component.acc_lock_stripes);
+    free(description_str);
+
+    mca_osc_rdma_component.acc_lock_stripe_size = 4096;
+    opal_asprintf(&description_str, "Size in bytes of the chunks of window memory mapped to the "
+             "accumulate locks when acc_lock_stripes is set (default: %u)",
+             mca_osc_rdma_component.acc_lock_stripe_size);
+    (void) mca_base_component_var_register(&mca_osc_rdma_component.super.osc_version, "acc_lock_stripe_size",
+                                           description_str, MCA_BASE_VAR_TYPE_UNSIGNED_INT, NULL, 0, 0,
+                                           OPAL_INFO_LVL_5, MCA_BASE_VAR_SCOPE_GROUP,
+                                           &mca_osc_rdma_component.acc_lock_stripe_size);
+    free(description_str);
+
+    mca_osc_rdma_component.aggregation_limit = 0;
+    opal_asprintf(&description_str, "Maximum size in bytes of the buffer used to combine small "
+             "contiguous put and get operations to adjacent target memory into a single RDMA "
+             "operation. The buffer is transferred on flush, unlock, or when it is full. 0 disables "
+             "aggregation. Not used on dynamic windows (default: %u)", mca_osc_rdma_component.aggregation_limit);
+    (void) mca_base_component_var_register(&mca_osc_rdma_component.super.osc_version, "aggregation_limit",
+                                           description_str, MCA_BASE_VAR_TYPE_UNSIGNED_INT, NULL, 0, 0,
+                                           OPAL_INFO_LVL_5, MCA_BASE_VAR_SCOPE_GROUP,
+                                           &mca_osc_rdma_component.aggregation_limit);
+    free(description_str);
+
     mca_osc_rdma_component.buffer_size = 32768;
     opal_asprintf(&description_str, "Size of temporary buffers (default: %d)", mca_osc_rdma_component.buffer_size);
     (void) mca_base_component_var_register (&mca_osc_rdma_component.super.osc_version, "buffer_size", description_str,
@@ -349,6 +383,19 @@ static int ompi_osc_rdma_component_init (bool enable_progress_threads,
                             __FILE__, __LINE__, ret);
     }
 
+    OBJ_CONSTRUCT(&mca_osc_rdma_component.aggregations, opal_free_list_t);
+    ret = opal_free_list_init (&mca_osc_rdma_component.aggregations,
+                               sizeof(ompi_osc_rdma_aggregation_t), 8,
+                               OBJ_CLASS(ompi_osc_rdma_aggregation_t),
+                               mca_osc_rdma_component.aggregation_limit, 8,
+                               0, -1, 8, NULL, 0, NULL, NULL, NULL);
+    if (OPAL_SUCCESS != ret) {
+        opal_output_verbose(1, ompi_osc_base_framework.framework_output,
+                            "%s:%d: opal_free_list_init failed: %d\n",
+                            __FILE__, __LINE__, ret);
+        return ret;
+    }
+
     ret = mca_bml_base_init(enable_progress_threads, enable_mpi_threads);
     if (OPAL_SUCCESS != ret) {
         opal_output_verbose(1, ompi_osc_base_framework.framework_output,
@@ -387,6 +434,7 @@ int ompi_osc_rdma_component_finalize (void)
     OBJ_DESTRUCT(&mca_osc_rdma_component.modules);
     OBJ_DESTRUCT(&mca_osc_rdma_component.lock);
     OBJ_DESTRUCT(&mca_osc_rdma_component.requests);
+    OBJ_DESTRUCT(&mca_osc_rdma_component.aggregations);
     OBJ_DESTRUCT(&mca_osc_rdma_component.request_gc);
     OBJ_DESTRUCT(&mca_osc_rdma_component.buffer_gc);
 
@@ -1420,6 +1468,14 @@ static int ompi_osc_rdma_component_select (struct ompi_win_t *win, void **base,
     module->acc_single_intrinsic = check_config_value_bool ("acc_single_intrinsic", info);
     module->acc_use_amo = mca_osc_rdma_component.acc_use_amo;
     module->network_amo_max_count = mca_osc_rdma_component.network_amo_max_count;
+    module->acc_lock_stripes = mca_osc_rdma_component.acc_lock_stripes;
+    module->acc_lock_stripe_size = mca_osc_rdma_component.acc_lock_stripe_size;
+    if (NULL != info) {
+        ompi_osc_base_set_acc_lock_stripes (info, &module->acc_lock_stripes);
+    }
+    if (module->acc_lock_stripes < 2 || 0 == module->acc_lock_stripe_size) {
+        module->acc_lock_stripes = 0;
+    }
 
     module->all_sync.module = module;
 
@@ -1493,6 +1549,28 @@ static int ompi_osc_rdma_component_select (struct ompi_win_t *win, void **base,
         }
     }
 
+    /* small operations are combined in unregistered buffers. this is only possible if
+     * the btl does not require local registration for operations of this size */
+    module->put_aggregation_limit = opal_min(mca_osc_rdma_component.aggregation_limit, module->put_limit);
+    module->get_aggregation_limit = opal_min(mca_osc_rdma_component.aggregation_limit, module->get_limit);
+    if (module->use_memory_registration) {
+        module->put_aggregation_limit = opal_min(module->put_aggregation_limit,
+                                                 module->accelerated_btl->btl_put_local_registration_threshold);
+        module->get_aggregation_limit = opal_min(module->get_aggregation_limit,
+                                                 module->accelerated_btl->btl_get_local_registration_threshold);
+    }
+    if (ALIGNMENT_MASK(module->get_alignment)) {
+        /* the target address of a combined get may not be aligned */
+        module->get_aggregation_limit = 0;
+    }
+    if (MPI_WIN_FLAVOR_DYNAMIC == module->flavor) {
+        /* the registration handles of a dynamic window live in the cached region table
+         * of the peer, which is replaced when it is refreshed. a buffered operation can
+         * not keep a pointer to them */
+        module->put_aggregation_limit = 0;
+        module->get_aggregation_limit = 0;
+    }
+
     /* calculate and store various structure sizes */
 
     module->region_size = sizeof (ompi_osc_rdma_region_t);
@@ -1509,10 +1587,19 @@ static int ompi_osc_rdma_component_select (struct ompi_win_t *win, void **base,
         module->state_size += mca_osc_rdma_component.max_attach * module->region_size;
     }
 
+    /* striped accumulate locks follow the regions */
+    module->state_size += OPAL_ALIGN_PAD_AMOUNT(module->state_size, sizeof (ompi_osc_rdma_lock_t));
+    module->acc_lock_offset = module->state_size;
+    module->state_size += module->acc_lock_stripes * sizeof (ompi_osc_rdma_lock_t);
+
     /*
      * These are the info's that this module is interested in
      */
     opal_infosubscribe_subscribe(&win->super, "no_locks", "false", ompi_osc_rdma_set_no_lock_info);
+    snprintf (module->acc_lock_stripes_info, sizeof (module->acc_lock_stripes_info), "%u",
+              module->acc_lock_stripes);
+    opal_infosubscribe_subscribe(&win->super, "acc_lock_stripes", module->acc_lock_stripes_info,
+                                 ompi_osc_rdma_set_acc_lock_stripes_info);
 
     /*
      * TODO: same_size, same_disp_unit have w_flag entries, but do not appear
@@ -1547,12 +1634,11 @@ static int ompi_osc_rdma_component_select (struct ompi_win_t *win, void **base,
     }
 
     if (MPI_WIN_FLAVOR_DYNAMIC == flavor) {
-        /* allocate space to store local btl handles for attached regions */
-        module->dynamic_handles = (ompi_osc_rdma_handle_t **) calloc (mca_osc_rdma_component.max_attach,
-                                                                      sizeof (module->dynamic_handles[0]));
-        if (NULL == module->dynamic_handles) {
+        /* allocate space to store local btl handles and lookup structures for attached regions */
+        ret = ompi_osc_rdma_dynamic_init (module);
+        if (OMPI_SUCCESS != ret) {
             ompi_osc_rdma_free (win);
-            return OMPI_ERR_OUT_OF_RESOURCE;
+            return ret;
         }
     }
 
@@ -1644,6 +1730,15 @@ ompi_osc_rdma_set_no_lock_info(opal_infosubscriber_t *obj, const char *key, cons
     return module->no_locks ? "true" : "false";
 }
 
+static const char*
+ompi_osc_rdma_set_acc_lock_stripes_info(opal_infosubscriber_t *obj, const char *key, const char *value)
+{
+    ompi_osc_rdma_module_t *module = GET_MODULE((struct ompi_win_t*) obj);
+
+    /* the locks are laid out in the state segment when the window is created */
+    return module->acc_lock_stripes_info;
+}
+
 int ompi_osc_rdma_shared_query(
     struct ompi_win_t *win, int rank, size_t *size,
     ptrdiff_t *disp_unit, void *baseptr)
@@ -34,78 +34,158 @@ OBJ_CLASS_INSTANCE(ompi_osc_rdma_handle_t, opal_object_t, ompi_osc_rdma_handle_i
 
 OBJ_CLASS_INSTANCE(ompi_osc_rdma_attachment_t, opal_list_item_t, NULL, NULL);
 
+/* the region array in the state structure is not sorted. attach and detach
+ * only write the slot of the region that changed, and the local lookups use
+ * a tree sorted by base address. peers sort the regions when they read them. */
+
+#define OMPI_OSC_RDMA_REGION_SLOT(module, index) \
+    ((ompi_osc_rdma_region_t *) ((intptr_t) (module)->state->regions + (index) * (module)->region_size))
+
+#define OMPI_OSC_RDMA_REGION_INDEX(module, region) \
+    ((int) (((intptr_t) (region) - (intptr_t) (module)->state->regions) / (module)->region_size))
+
+struct ompi_osc_rdma_region_range_t {
+    intptr_t base;
+    intptr_t bound;
+};
+typedef struct ompi_osc_rdma_region_range_t ompi_osc_rdma_region_range_t;
+
+/* order the regions in the tree by base address. regions attached on the same
+ * page may share a base, in which case they are ordered by slot */
+static int ompi_osc_rdma_region_compare (void *key1, void *key2)
+{
+    ompi_osc_rdma_region_t *region1 = (ompi_osc_rdma_region_t *) key1;
+    ompi_osc_rdma_region_t *region2 = (ompi_osc_rdma_region_t *) key2;
+
+    if (region1->base != region2->base) {
+        return (region1->base < region2->base) ? -1 : 1;
+    }
+
+    if (region1 != region2) {
+        return ((intptr_t) region1 < (intptr_t) region2) ? -1 : 1;
+    }
+
+    return 0;
+}
+
+/* matches the region containing a range */
+static int ompi_osc_rdma_region_compare_range (void *key1, void *key2)
+{
+    ompi_osc_rdma_region_range_t *range = (ompi_osc_rdma_region_range_t *) key1;
+    ompi_osc_rdma_region_t *region = (ompi_osc_rdma_region_t *) key2;
+
+    if (range->base < (intptr_t) region->base) {
+        return -1;
+    }
+
+    return (range->bound <= (intptr_t) (region->base + region->len)) ? 0 : 1;
+}
+
+static int ompi_osc_rdma_region_sort_compare (const void *a, const void *b)
+{
+    return ompi_osc_rdma_region_compare (*(ompi_osc_rdma_region_t **) a, *(ompi_osc_rdma_region_t **) b);
+}
+
 /**
- * ompi_osc_rdma_find_region_containing:
+ * @brief find the local region containing a range
  *
- * @param[in]  regions      sorted list of regions
- * @param[in]  min_index    minimum index to search (call with 0)
- * @param[in]  max_index    maximum index to search (call with length - 1)
- * @param[in]  base         base of region to search for
- * @param[in]  bound        bound of region to search for
- * @param[in]  region_size  size of an ompi_osc_rdma_region_t object
- * @param[out] region_index index of region if found (may be NULL)
+ * @param[in] module   osc rdma module
+ * @param[in] base     base of range to search for
+ * @param[in] bound    bound of range to search for
  *
- * @returns an index on success or -1 on failure
- *
- * This function searches through a sorted list of rdma regions {regions} and finds
- * the region that contains the region specified by {base} and {bound}. If a
- * matching region is found the index of that region is returned else the function
- * returns -1.
+ * @returns the region in the state structure or NULL if no region matches
  */
-static inline ompi_osc_rdma_region_t *ompi_osc_rdma_find_region_containing (ompi_osc_rdma_region_t *regions, int min_index,
-                                                                            int max_index, intptr_t base, intptr_t bound,
-                                                                            size_t region_size, int *region_index)
+static inline ompi_osc_rdma_region_t *ompi_osc_rdma_find_local_region (ompi_osc_rdma_module_t *module,
+                                                                       intptr_t base, intptr_t bound)
 {
-    int mid_index = (max_index + min_index) >> 1;
-    ompi_osc_rdma_region_t *region = (ompi_osc_rdma_region_t *)((intptr_t) regions + mid_index * region_size);
-    intptr_t region_bound;
+    ompi_osc_rdma_region_range_t range = {.base = base, .bound = bound};
+
+    return (ompi_osc_rdma_region_t *) opal_rb_tree_find_with (module->dynamic_regions, &range,
+                                                              ompi_osc_rdma_region_compare_range);
+}
 
-    if (min_index > max_index) {
-        return NULL;
+/**
+ * @brief find the region containing a range in the cached table of a peer
+ *
+ * @param[in] peer     dynamic peer object
+ * @param[in] base     base of range to search for
+ * @param[in] bound    bound of range to search for
+ *
+ * @returns the cached region or NULL if no region matches
+ */
+static inline ompi_osc_rdma_region_t *ompi_osc_rdma_find_cached_region (ompi_osc_rdma_peer_dynamic_t *peer,
+                                                                        intptr_t base, intptr_t bound)
+{
+    int min_index = 0, max_index = (int) peer->sorted_count - 1;
+
+    while (min_index <= max_index) {
+        int mid_index = (max_index + min_index) >> 1;
+        ompi_osc_rdma_region_t *region = peer->sorted_regions[mid_index];
+
+        OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_DEBUG, "checking memory region %p-%p against %p-%p (index %d)",
+                         (void *) base, (void *) bound, (void *) region->base,
+                         (void *)(region->base + region->len), mid_index);
+
+        if ((intptr_t) region->base > base) {
+            max_index = mid_index - 1;
+        } else if (bound <= (intptr_t) (region->base + region->len)) {
+            return region;
+        } else {
+            min_index = mid_index + 1;
+        }
     }
 
-    region_bound = (intptr_t) (region->base + region->len);
+    return NULL;
+}
 
-    OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_DEBUG, "checking memory region %p-%p against %p-%p (index %d) (min_index = %d, "
-                     "max_index = %d)", (void *) base, (void *) bound, (void *) region->base,
-                     (void *)(region->base + region->len), mid_index, min_index, max_index);
+int ompi_osc_rdma_dynamic_init (ompi_osc_rdma_module_t *module)
+{
+    int max_attach = (int) mca_osc_rdma_component.max_attach;
+    int ret;
 
-    if (region->base > base) {
-        return ompi_osc_rdma_find_region_containing (regions, min_index, mid_index-1, base, bound, region_size,
-                                                     region_index);
+    /* allocate space to store local btl handles for attached regions */
+    module->dynamic_handles = (ompi_osc_rdma_handle_t **) calloc (max_attach, sizeof (module->dynamic_handles[0]));
+    module->dynamic_free_slots = (int *) malloc (max_attach * sizeof (module->dynamic_free_slots[0]));
+    module->dynamic_regions = OBJ_NEW(opal_rb_tree_t);
+    if (NULL == module->dynamic_handles || NULL == module->dynamic_free_slots || NULL == module->dynamic_regions) {
+        return OMPI_ERR_OUT_OF_RESOURCE;
     }
 
-    if (bound <= region_bound) {
-        if (region_index) {
-            *region_index = mid_index;
-        }
+    ret = opal_rb_tree_init (module->dynamic_regions, ompi_osc_rdma_region_compare);
+    if (OPAL_SUCCESS != ret) {
+        return ret;
+    }
 
-        return region;
+    /* hand out the lowest slots first to keep the part of the array peers have to read small */
+    for (int i = 0 ; i < max_attach ; ++i) {
+        module->dynamic_free_slots[i] = max_attach - i - 1;
     }
+    module->dynamic_free_count = max_attach;
 
-    return ompi_osc_rdma_find_region_containing (regions, mid_index+1, max_index, base, bound, region_size, region_index);
+    return OMPI_SUCCESS;
 }
 
-/* binary search for insertion point */
-static ompi_osc_rdma_region_t *find_insertion_point (ompi_osc_rdma_region_t *regions, int min_index, int max_index,
-                                                     intptr_t base, size_t region_size, int *region_index)
+void ompi_osc_rdma_dynamic_fini (ompi_osc_rdma_module_t *module)
 {
-    int mid_index = (max_index + min_index) >> 1;
-    ompi_osc_rdma_region_t *region = (ompi_osc_rdma_region_t *)((intptr_t) regions + mid_index * region_size);
-
-    OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_TRACE, "find_insertion_point (%d, %d, %lx, %lu)\n", min_index, max_index, base,
-                     region_size);
+    if (NULL != module->dynamic_handles) {
+        for (int i = 0 ; i < (int) mca_osc_rdma_component.max_attach ; ++i) {
+            ompi_osc_rdma_handle_t *region_handle = module->dynamic_handles[i];
+            if (NULL != region_handle) {
+                ompi_osc_rdma_deregister (module, region_handle->btl_handle);
+                OBJ_RELEASE(region_handle);
+            }
+        }
 
-    if (max_index < min_index) {
-        *region_index = min_index;
-        return (ompi_osc_rdma_region_t *)((intptr_t) regions + min_index * region_size);
+        free (module->dynamic_handles);
+        module->dynamic_handles = NULL;
     }
 
-    if (region->base > base || (region->base == base && (size_t)region->len > region_size)) {
-        return find_insertion_point (regions, min_index, mid_index-1, base, region_size, region_index);
+    if (NULL != module->dynamic_regions) {
+        OBJ_RELEASE(module->dynamic_regions);
     }
 
-    return find_insertion_point (regions, mid_index+1, max_index, base, region_size, region_index);
+    free (module->dynamic_free_slots);
+    module->dynamic_free_slots = NULL;
 }
 
 static bool ompi_osc_rdma_find_conflicting_attachment (ompi_osc_rdma_handle_t *handle, intptr_t base, intptr_t bound)
@@ -199,15 +279,10 @@ int ompi_osc_rdma_attach (struct ompi_win_t *win, void *base, size_t len)
     OPAL_THREAD_LOCK(&module->lock);
     ompi_osc_rdma_lock_acquire_exclusive (module, my_peer, offsetof (ompi_osc_rdma_state_t, regions_lock));
 
+    /* the low 4 bytes of the region count are the number of slots in use */
     region_count = module->state->region_count & 0xffffffffL;
     region_id    = module->state->region_count >> 32;
 
-    if (region_count == mca_osc_rdma_component.max_attach) {
-        OPAL_THREAD_UNLOCK(&module->lock);
-        OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_TRACE, "attach: could not attach. max attachment count reached.");
-        return OMPI_ERR_RMA_ATTACH;
-    }
-
     /* it is wasteful to register less than a page. this may allow the remote side to access more
      * memory but the MPI standard covers this with calling the calling behavior erroneous */
     aligned_bound = OPAL_ALIGN((intptr_t) base + len, page_size, intptr_t);
@@ -215,33 +290,28 @@ int ompi_osc_rdma_attach (struct ompi_win_t *win, void *base, size_t len)
     aligned_len = (size_t)(aligned_bound - aligned_base);
 
     /* see if a registered region already exists */
-    region = ompi_osc_rdma_find_region_containing ((ompi_osc_rdma_region_t *) module->state->regions, 0, region_count - 1,
-                                                   aligned_base, aligned_bound, module->region_size, &region_index);
+    region = ompi_osc_rdma_find_local_region (module, aligned_base, aligned_bound);
     if (NULL != region) {
+        region_index = OMPI_OSC_RDMA_REGION_INDEX(module, region);
         /* validates that the region does not overlap with an existing region even if they are on the same page */
         ret = ompi_osc_rdma_add_attachment (module->dynamic_handles[region_index], (intptr_t) base, len);
-        OPAL_THREAD_UNLOCK(&module->lock);
         ompi_osc_rdma_lock_release_exclusive (module, my_peer, offsetof (ompi_osc_rdma_state_t, regions_lock));
+        OPAL_THREAD_UNLOCK(&module->lock);
         /* no need to invalidate remote caches */
         return ret;
     }
 
-    /* do a binary search for where the region should be inserted */
-    if (region_count) {
-        region = find_insertion_point ((ompi_osc_rdma_region_t *) module->state->regions, 0, region_count - 1,
-                                       (intptr_t) base, module->region_size, &region_index);
-
-        if (region_index < region_count) {
-            memmove ((void *) ((intptr_t) region + module->region_size), region,
-                     (region_count - region_index) * module->region_size);
-            memmove (module->dynamic_handles + region_index + 1, module->dynamic_handles + region_index,
-                     (region_count - region_index) * sizeof (module->dynamic_handles[0]));
-        }
-    } else {
-        region_index = 0;
-        region = (ompi_osc_rdma_region_t *) module->state->regions;
+    if (0 == module->dynamic_free_count) {
+        ompi_osc_rdma_lock_release_exclusive (module, my_peer, offsetof (ompi_osc_rdma_state_t, regions_lock));
+        OPAL_THREAD_UNLOCK(&module->lock);
+        OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_TRACE, "attach: could not attach. max attachment count reached.");
+        return OMPI_ERR_RMA_ATTACH;
     }
 
+    /* take an unused slot. the other slots are left untouched */
+    region_index = module->dynamic_free_slots[--module->dynamic_free_count];
+    region = OMPI_OSC_RDMA_REGION_SLOT(module, region_index);
+
     region->base = aligned_base;
     region->len  = aligned_len;
 
@@ -258,9 +328,12 @@ int ompi_osc_rdma_attach (struct ompi_win_t *win, void *base, size_t len)
         ret = ompi_osc_rdma_register (module, MCA_BTL_ENDPOINT_ANY, (void *) region->base, region->len,
                                       MCA_BTL_REG_FLAG_ACCESS_ANY, &handle);
         if (OPAL_UNLIKELY(OMPI_SUCCESS != ret)) {
-            OPAL_THREAD_UNLOCK(&module->lock);
+            region->base = 0;
+            region->len  = 0;
+            module->dynamic_free_slots[module->dynamic_free_count++] = region_index;
             OBJ_RELEASE(rdma_region_handle);
             ompi_osc_rdma_lock_release_exclusive (module, my_peer, offsetof (ompi_osc_rdma_state_t, regions_lock));
+            OPAL_THREAD_UNLOCK(&module->lock);
             return OMPI_ERR_RMA_ATTACH;
         }
 
@@ -274,10 +347,15 @@ int ompi_osc_rdma_attach (struct ompi_win_t *win, void *base, size_t len)
     ret = ompi_osc_rdma_add_attachment (rdma_region_handle, (intptr_t) base, len);
     assert(OMPI_SUCCESS == ret);
     module->dynamic_handles[region_index] = rdma_region_handle;
+    (void) opal_rb_tree_insert (module->dynamic_regions, region, region);
+
+    if (region_index >= (int) region_count) {
+        region_count = region_index + 1;
+    }
 
 #if OPAL_ENABLE_DEBUG
-    for (int i = 0 ; i < region_count + 1 ; ++i) {
-        region = (ompi_osc_rdma_region_t *) ((intptr_t) module->state->regions + i * module->region_size);
+    for (int i = 0 ; i < (int) region_count ; ++i) {
+        region = OMPI_OSC_RDMA_REGION_SLOT(module, i);
 
         OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_DEBUG, " dynamic region %d: {%p, %lu}", i,
                          (void *) region->base, (unsigned long) region->len);
@@ -285,7 +363,7 @@ int ompi_osc_rdma_attach (struct ompi_win_t *win, void *base, size_t len)
 #endif
 
     /* the region state has changed */
-    module->state->region_count = ((region_id + 1) << 32) | (region_count + 1);
+    module->state->region_count = ((region_id + 1) << 32) | region_count;
     opal_atomic_wmb ();
 
     ompi_osc_rdma_lock_release_exclusive (module, my_peer, offsetof (ompi_osc_rdma_state_t, regions_lock));
@@ -302,10 +380,10 @@ int ompi_osc_rdma_detach (struct ompi_win_t *win, const void *base)
     ompi_osc_rdma_module_t *module = GET_MODULE(win);
     const int my_rank = ompi_comm_rank (module->comm);
     ompi_osc_rdma_peer_dynamic_t *my_peer = (ompi_osc_rdma_peer_dynamic_t *) ompi_osc_rdma_module_peer (module, my_rank);
-    ompi_osc_rdma_handle_t *rdma_region_handle;
+    ompi_osc_rdma_handle_t *rdma_region_handle = NULL;
     osc_rdma_counter_t region_count, region_id;
     ompi_osc_rdma_region_t *region;
-    int region_index;
+    int region_index = -1;
 
     if (module->flavor != MPI_WIN_FLAVOR_DYNAMIC) {
         return OMPI_ERR_WIN;
@@ -321,32 +399,43 @@ int ompi_osc_rdma_detach (struct ompi_win_t *win, const void *base)
     region_id    = module->state->region_count >> 32;
 
     /* look up the associated region */
-    for (region_index = 0 ; region_index < region_count ; ++region_index) {
+    region = ompi_osc_rdma_find_local_region (module, (intptr_t) base, (intptr_t) base + 1);
+    if (NULL != region) {
+        region_index = OMPI_OSC_RDMA_REGION_INDEX(module, region);
         rdma_region_handle = module->dynamic_handles[region_index];
-        region = (ompi_osc_rdma_region_t *) ((intptr_t) module->state->regions + region_index * module->region_size);
-        OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_INFO, "checking attachments at index %d {.base=%p, len=%lu} for attachment %p"
-                         ", region handle=%p", region_index, (void *) region->base, (unsigned long)region->len, base, (void*)rdma_region_handle);
-
-        if ((uintptr_t)region->base > (uintptr_t) base || (uintptr_t)(region->base + region->len) < (uintptr_t) base) {
-            continue;
+        if (OPAL_SUCCESS != ompi_osc_rdma_remove_attachment (rdma_region_handle, (intptr_t) base)) {
+            region_index = -1;
         }
+    }
 
-        if (OPAL_SUCCESS == ompi_osc_rdma_remove_attachment (rdma_region_handle, (intptr_t) base)) {
-            break;
+    if (-1 == region_index) {
+        /* regions attached on the same page may overlap. check all of them */
+        for (int i = 0 ; i < (int) region_count ; ++i) {
+            rdma_region_handle = module->dynamic_handles[i];
+            region = OMPI_OSC_RDMA_REGION_SLOT(module, i);
+            if (NULL == rdma_region_handle || (uintptr_t) region->base > (uintptr_t) base ||
+                (uintptr_t)(region->base + region->len) < (uintptr_t) base) {
+                continue;
+            }
+
+            if (OPAL_SUCCESS == ompi_osc_rdma_remove_attachment (rdma_region_handle, (intptr_t) base)) {
+                region_index = i;
+                break;
+            }
         }
     }
 
-    if (region_index == region_count) {
+    if (-1 == region_index) {
         OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_INFO, "could not find dynamic memory attachment for %p", base);
-        OPAL_THREAD_UNLOCK(&module->lock);
         ompi_osc_rdma_lock_release_exclusive (module, &my_peer->super, offsetof (ompi_osc_rdma_state_t, regions_lock));
+        OPAL_THREAD_UNLOCK(&module->lock);
         return OMPI_ERR_BASE;
     }
 
     if (!opal_list_is_empty (&rdma_region_handle->attachments)) {
         /* another region is referencing this attachment */
-        OPAL_THREAD_UNLOCK(&module->lock);
         ompi_osc_rdma_lock_release_exclusive (module, &my_peer->super, offsetof (ompi_osc_rdma_state_t, regions_lock));
+        OPAL_THREAD_UNLOCK(&module->lock);
         return OMPI_SUCCESS;
     }
 
@@ -357,18 +446,20 @@ int ompi_osc_rdma_detach (struct ompi_win_t *win, const void *base)
         ompi_osc_rdma_deregister (module, rdma_region_handle->btl_handle);
     }
 
-    if (region_index < region_count - 1) {
-        size_t end_count = region_count - region_index - 1;
-        memmove (module->dynamic_handles + region_index, module->dynamic_handles + region_index + 1,
-                 end_count * sizeof (module->dynamic_handles[0]));
-        memmove (region, (void *)((intptr_t) region + module->region_size),
-                 end_count * module->region_size);
-    }
-
+    (void) opal_rb_tree_delete (module->dynamic_regions, region);
     OBJ_RELEASE(rdma_region_handle);
-    module->dynamic_handles[region_count - 1] = NULL;
+    module->dynamic_handles[region_index] = NULL;
+
+    /* mark the slot unused */
+    region->base = 0;
+    region->len  = 0;
+    module->dynamic_free_slots[module->dynamic_free_count++] = region_index;
+
+    while (region_count > 0 && NULL == module->dynamic_handles[region_count - 1]) {
+        --region_count;
+    }
 
-    module->state->region_count = ((region_id + 1) << 32) | (region_count - 1);
+    module->state->region_count = ((region_id + 1) << 32) | region_count;
     opal_atomic_wmb ();
 
     ompi_osc_rdma_lock_release_exclusive (module, &my_peer->super, offsetof (ompi_osc_rdma_state_t, regions_lock));
@@ -380,6 +471,25 @@ int ompi_osc_rdma_detach (struct ompi_win_t *win, const void *base)
     return OMPI_SUCCESS;
 }
 
+/**
+ * @brief read the region count of a peer
+ */
+static int ompi_osc_rdma_get_region_count (ompi_osc_rdma_module_t *module, ompi_osc_rdma_peer_dynamic_t *peer,
+                                           osc_rdma_counter_t *value)
+{
+    uint64_t source_address;
+
+    if (ompi_osc_rdma_peer_local_state (&peer->super)) {
+        *value = ((volatile ompi_osc_rdma_state_t *) peer->super.state)->region_count;
+        opal_atomic_rmb ();
+        return OMPI_SUCCESS;
+    }
+
+    source_address = (uint64_t)(intptr_t) peer->super.state + offsetof (ompi_osc_rdma_state_t, region_count);
+    return ompi_osc_get_data_blocking (module, peer->super.state_btl_index, peer->super.state_endpoint,
+                                       source_address, peer->super.state_handle, value, sizeof (*value));
+}
+
 /**
  * @brief refresh the local view of the dynamic memory region
  *
@@ -387,11 +497,11 @@ int ompi_osc_rdma_detach (struct ompi_win_t *win, const void *base)
  * @param[in] peer           peer object to refresh
  *
  * This function does the work of keeping the local view of a remote peer in sync with what is attached
- * to the remote window. It is called on every address translation since there is no way (currently) to
- * detect that the attached regions have changed. To reduce the amount of data read we first read the
- * region count (which contains an id). If that hasn't changed the region data is not updated. If the
- * list of attached regions has changed then all valid regions are read from the peer while holding
- * their region lock.
+ * to the remote window. It is called when an address can not be found in the cached view and on the
+ * first access to the peer after a synchronization call. To reduce the amount of data read we first
+ * read the region count (which contains an id). If that hasn't changed the region data is not updated.
+ * If the list of attached regions has changed then all used slots are read from the peer while holding
+ * their region lock and the attached regions are sorted by base address for lookup.
  */
 static int ompi_osc_rdma_refresh_dynamic_region (ompi_osc_rdma_module_t *module, ompi_osc_rdma_peer_dynamic_t *peer) {
     osc_rdma_counter_t region_count, region_id;
@@ -404,10 +514,7 @@ static int ompi_osc_rdma_refresh_dynamic_region (ompi_osc_rdma_module_t *module,
     do {
         osc_rdma_counter_t remote_value;
 
-        source_address = (uint64_t)(intptr_t) peer->super.state + offsetof (ompi_osc_rdma_state_t, region_count);
-        ret = ompi_osc_get_data_blocking (module, peer->super.state_btl_index, peer->super.state_endpoint,
-                                          source_address, peer->super.state_handle, &remote_value,
-                                          sizeof (remote_value));
+        ret = ompi_osc_rdma_get_region_count (module, peer, &remote_value);
         if (OPAL_UNLIKELY(OMPI_SUCCESS != ret)) {
             return ret;
         }
@@ -420,45 +527,75 @@ static int ompi_osc_rdma_refresh_dynamic_region (ompi_osc_rdma_module_t *module,
     OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_DEBUG, "target region: id 0x%lx, count 0x%lx (cached: 0x%x, 0x%x)",
                      (unsigned long) region_id, (unsigned long) region_count, peer->region_id, peer->region_count);
 
-    if (0 == region_count) {
-        return OMPI_ERR_RMA_RANGE;
-    }
-
     /* check if the cached copy is out of date */
     OPAL_THREAD_LOCK(&module->lock);
 
+    peer->epoch = module->dynamic_epoch;
+
     if (peer->region_id != region_id) {
         unsigned region_len = module->region_size * region_count;
         void *temp;
 
         OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_DEBUG, "dynamic memory cache is out of data. reloading from peer");
 
-        /* allocate only enough space for the remote regions */
-        temp = realloc (peer->regions, region_len);
-        if (NULL == temp) {
-            OPAL_THREAD_UNLOCK(&module->lock);
-            return OMPI_ERR_OUT_OF_RESOURCE;
+        peer->sorted_count = 0;
+
+        if (region_count > peer->region_count || NULL == peer->regions) {
+            /* allocate only enough space for the remote regions */
+            temp = realloc (peer->regions, region_len ? region_len : module->region_size);
+            if (NULL == temp) {
+                OPAL_THREAD_UNLOCK(&module->lock);
+                return OMPI_ERR_OUT_OF_RESOURCE;
+            }
+            peer->regions = temp;
+
+            temp = realloc (peer->sorted_regions, (region_count ? region_count : 1) * sizeof (peer->sorted_regions[0]));
+            if (NULL == temp) {
+                OPAL_THREAD_UNLOCK(&module->lock);
+                return OMPI_ERR_OUT_OF_RESOURCE;
+            }
+            peer->sorted_regions = temp;
         }
-        peer->regions = temp;
 
-        /* lock the region */
-        ompi_osc_rdma_lock_acquire_shared (module, &peer->super, 1, offsetof (ompi_osc_rdma_state_t, regions_lock),
-                                           OMPI_OSC_RDMA_LOCK_EXCLUSIVE);
+        if (region_count) {
+            /* lock the region */
+            ompi_osc_rdma_lock_acquire_shared (module, &peer->super, 1, offsetof (ompi_osc_rdma_state_t, regions_lock),
+                                               OMPI_OSC_RDMA_LOCK_EXCLUSIVE);
+
+            source_address = (uint64_t)(intptr_t) peer->super.state + offsetof (ompi_osc_rdma_state_t, regions);
+            if (ompi_osc_rdma_peer_local_state (&peer->super)) {
+                memcpy (peer->regions, (void *)(intptr_t) source_address, region_len);
+            } else {
+                ret = ompi_osc_get_data_blocking (module, peer->super.state_btl_index, peer->super.state_endpoint,
+                                                  source_address, peer->super.state_handle, peer->regions, region_len);
+            }
+
+            /* release the region lock */
+            ompi_osc_rdma_lock_release_shared (module, &peer->super, -1, offsetof (ompi_osc_rdma_state_t, regions_lock));
+
+            if (OPAL_UNLIKELY(OMPI_SUCCESS != ret)) {
+                /* force a reload on the next access */
+                peer->region_id = (uint32_t) region_id - 1;
+                OPAL_THREAD_UNLOCK(&module->lock);
+                return ret;
+            }
+        }
 
-        source_address = (uint64_t)(intptr_t) peer->super.state + offsetof (ompi_osc_rdma_state_t, regions);
-        ret = ompi_osc_get_data_blocking (module, peer->super.state_btl_index, peer->super.state_endpoint,
-                                          source_address, peer->super.state_handle, peer->regions, region_len);
-        if (OPAL_UNLIKELY(OMPI_SUCCESS != ret)) {
-            OPAL_THREAD_UNLOCK(&module->lock);
-            return ret;
+        for (int i = 0 ; i < (int) region_count ; ++i) {
+            ompi_osc_rdma_region_t *region = (ompi_osc_rdma_region_t *) ((intptr_t) peer->regions + i * module->region_size);
+            if (0 != region->len) {
+                peer->sorted_regions[peer->sorted_count++] = region;
+            }
         }
 
-        /* release the region lock */
-        ompi_osc_rdma_lock_release_shared (module, &peer->super, -1, offsetof (ompi_osc_rdma_state_t, regions_lock));
+        qsort (peer->sorted_regions, peer->sorted_count, sizeof (peer->sorted_regions[0]),
+               ompi_osc_rdma_region_sort_compare);
 
         /* update cached region ids */
         peer->region_id = region_id;
-        peer->region_count = region_count;
+        if (region_count > peer->region_count) {
+            peer->region_count = region_count;
+        }
     }
 
     OPAL_THREAD_UNLOCK(&module->lock);
@@ -473,29 +610,31 @@ int ompi_osc_rdma_find_dynamic_region (ompi_osc_rdma_module_t *module, ompi_osc_
 {
     ompi_osc_rdma_peer_dynamic_t *dy_peer = (ompi_osc_rdma_peer_dynamic_t *) peer;
     intptr_t bound = (intptr_t) base + len;
-    ompi_osc_rdma_region_t *regions;
-    int ret = OMPI_SUCCESS, region_count;
+    int ret = OMPI_SUCCESS;
 
     OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_TRACE, "locating dynamic memory region matching: {%" PRIx64 ", %" PRIx64 "}"
                      " (len %lu)", base, base + len, (unsigned long) len);
 
     OPAL_THREAD_LOCK(&module->lock);
-    if (!ompi_osc_rdma_peer_local_state (peer)) {
-        ret = ompi_osc_rdma_refresh_dynamic_region (module, dy_peer);
-        if (OMPI_SUCCESS != ret) {
-            return ret;
+    if (ompi_comm_rank (module->comm) == peer->rank) {
+        *region = ompi_osc_rdma_find_local_region (module, (intptr_t) base, bound);
+    } else {
+        /* the cached view is used without contacting the peer until the next synchronization
+         * call. a miss may be due to a region attached since the view was read */
+        *region = NULL;
+        if (dy_peer->epoch == module->dynamic_epoch) {
+            *region = ompi_osc_rdma_find_cached_region (dy_peer, (intptr_t) base, bound);
         }
 
-        regions = dy_peer->regions;
-        region_count = dy_peer->region_count;
-    } else {
-        ompi_osc_rdma_state_t *peer_state = (ompi_osc_rdma_state_t *) peer->state;
-        regions = (ompi_osc_rdma_region_t *) peer_state->regions;
-        region_count = peer_state->region_count;
+        if (NULL == *region) {
+            ret = ompi_osc_rdma_refresh_dynamic_region (module, dy_peer);
+            if (OMPI_SUCCESS == ret) {
+                *region = ompi_osc_rdma_find_cached_region (dy_peer, (intptr_t) base, bound);
+            }
+        }
     }
 
-    *region = ompi_osc_rdma_find_region_containing (regions, 0, region_count - 1, (intptr_t) base, bound, module->region_size, NULL);
-    if (!*region) {
+    if (OMPI_SUCCESS == ret && !*region) {
         ret = OMPI_ERR_RMA_RANGE;
     }
     OPAL_THREAD_UNLOCK(&module->lock);
@@ -9,6 +9,9 @@
  * $HEADER$
  */
 
+#ifndef OMPI_OSC_RDMA_DYNAMIC_H
+#define OMPI_OSC_RDMA_DYNAMIC_H
+
 #include "osc_rdma.h"
 
 /**
@@ -58,3 +61,38 @@ int ompi_osc_rdma_detach (struct ompi_win_t *win, const void *base);
  */
 int ompi_osc_rdma_find_dynamic_region (ompi_osc_rdma_module_t *module, ompi_osc_rdma_peer_t *peer, uint64_t base, size_t len,
 				       ompi_osc_rdma_region_t **region);
+
+/**
+ * @brief set up the structures tracking the locally attached regions
+ *
+ * @param[in] module   osc rdma module of a dynamic window
+ *
+ * @returns OMPI_SUCCESS on success
+ * @returns OMPI_ERR_OUT_OF_RESOURCE on resource failure
+ */
+int ompi_osc_rdma_dynamic_init (ompi_osc_rdma_module_t *module);
+
+/**
+ * @brief release all locally attached regions
+ *
+ * @param[in] module   osc rdma module
+ */
+void ompi_osc_rdma_dynamic_fini (ompi_osc_rdma_module_t *module);
+
+/**
+ * @brief invalidate the cached region tables of all peers
+ *
+ * @param[in] module   osc rdma module
+ *
+ * Cached region tables are used without contacting the peer until the next
+ * synchronization call. After that the region id of the peer is checked again
+ * on the first access to it.
+ */
+static inline void ompi_osc_rdma_dynamic_invalidate (ompi_osc_rdma_module_t *module)
+{
+    if (MPI_WIN_FLAVOR_DYNAMIC == module->flavor) {
+        module->dynamic_epoch++;
+    }
+}
+
+#endif /* OMPI_OSC_RDMA_DYNAMIC_H */
@@ -26,6 +26,7 @@
 
 #include "osc_rdma.h"
 #include "osc_rdma_lock.h"
+#include "osc_rdma_dynamic.h"
 
 #include "mpi.h"
 
@@ -78,18 +79,7 @@ int ompi_osc_rdma_free(ompi_win_t *win)
 
     win->w_osc_module = NULL;
 
-    if (module->state) {
-        int region_count = module->state->region_count & 0xffffffffL;
-        if (NULL != module->dynamic_handles) {
-            for (int i = 0 ; i < region_count ; ++i) {
-                ompi_osc_rdma_handle_t *region_handle = module->dynamic_handles[i];
-                ompi_osc_rdma_deregister (module, region_handle->btl_handle);
-                OBJ_RELEASE(region_handle);
-            }
-
-            free (module->dynamic_handles);
-        }
-    }
+    ompi_osc_rdma_dynamic_fini (module);
 
     OBJ_DESTRUCT(&module->outstanding_locks);
     OBJ_DESTRUCT(&module->lock);
@@ -25,13 +25,18 @@
 
 #include "osc_rdma_passive_target.h"
 #include "osc_rdma_comm.h"
+#include "osc_rdma_dynamic.h"
 
 #include "mpi.h"
 
 
 int ompi_osc_rdma_sync (struct ompi_win_t *win)
 {
-    ompi_osc_rdma_progress (GET_MODULE(win));
+    ompi_osc_rdma_module_t *module = GET_MODULE(win);
+
+    /* regions attached to the window since the last synchronization become visible */
+    ompi_osc_rdma_dynamic_invalidate (module);
+    ompi_osc_rdma_progress (module);
     return OMPI_SUCCESS;
 }
 
@@ -40,6 +45,7 @@ int ompi_osc_rdma_flush (int target, struct ompi_win_t *win)
     ompi_osc_rdma_module_t *module = GET_MODULE(win);
     ompi_osc_rdma_sync_t *lock;
     ompi_osc_rdma_peer_t *peer;
+    int ret;
 
     assert (0 <= target);
 
@@ -57,11 +63,11 @@ int ompi_osc_rdma_flush (int target, struct ompi_win_t *win)
     OPAL_THREAD_UNLOCK(&module->lock);
 
     /* finish all outstanding fragments */
-    ompi_osc_rdma_sync_rdma_complete (lock);
+    ret = ompi_osc_rdma_sync_rdma_complete (lock);
 
     OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_TRACE, "flush on target %d complete", target);
 
-    return OMPI_SUCCESS;
+    return ret;
 }
 
 
@@ -69,7 +75,7 @@ int ompi_osc_rdma_flush_all (struct ompi_win_t *win)
 {
     ompi_osc_rdma_module_t *module = GET_MODULE(win);
     ompi_osc_rdma_sync_t *lock;
-    int ret = OMPI_SUCCESS;
+    int ret = OMPI_SUCCESS, rc = OMPI_SUCCESS, tmp;
     uint32_t key;
     void *node;
 
@@ -82,21 +88,24 @@ int ompi_osc_rdma_flush_all (struct ompi_win_t *win)
 
     /* globally complete all outstanding rdma requests */
     if (OMPI_OSC_RDMA_SYNC_TYPE_LOCK == module->all_sync.type) {
-        ompi_osc_rdma_sync_rdma_complete (&module->all_sync);
+        rc = ompi_osc_rdma_sync_rdma_complete (&module->all_sync);
     }
 
     /* flush all locks */
     ret = opal_hash_table_get_first_key_uint32 (&module->outstanding_locks, &key, (void **) &lock, &node);
     while (OPAL_SUCCESS == ret) {
         OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_DEBUG, "flushing lock %p", (void *) lock);
-        ompi_osc_rdma_sync_rdma_complete (lock);
+        tmp = ompi_osc_rdma_sync_rdma_complete (lock);
+        if (OMPI_SUCCESS != tmp) {
+            rc = tmp;
+        }
         ret = opal_hash_table_get_next_key_uint32 (&module->outstanding_locks, &key, (void **) &lock,
                                                    node, &node);
     }
 
     OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_TRACE, "flush_all complete");
 
-    return OPAL_SUCCESS;
+    return rc;
 }
 
 
@@ -229,6 +238,7 @@ int ompi_osc_rdma_lock_atomic (int lock_type, int target, int mpi_assert, ompi_w
 
     /* clear the global sync object (in case MPI_Win_fence was called) */
     module->all_sync.type = OMPI_OSC_RDMA_SYNC_TYPE_NONE;
+    ompi_osc_rdma_dynamic_invalidate (module);
 
     /* create lock item */
     lock = ompi_osc_rdma_sync_allocate (module);
@@ -287,10 +297,13 @@ int ompi_osc_rdma_unlock_atomic (int target, ompi_win_t *win)
     ompi_osc_rdma_module_lock_remove (module, lock);
 
     /* finish all outstanding fragments */
-    ompi_osc_rdma_sync_rdma_complete (lock);
+    ret = ompi_osc_rdma_sync_rdma_complete (lock);
 
     if (!(lock->sync.lock.mpi_assert & MPI_MODE_NOCHECK)) {
-        ret = ompi_osc_rdma_unlock_atomic_internal (module, peer, lock);
+        int rc = ompi_osc_rdma_unlock_atomic_internal (module, peer, lock);
+        if (OMPI_SUCCESS == ret) {
+            ret = rc;
+        }
     }
 
     /* release our reference to this peer */
@@ -323,6 +336,8 @@ int ompi_osc_rdma_lock_all_atomic (int mpi_assert, struct ompi_win_t *win)
         return OMPI_ERR_RMA_SYNC;
     }
 
+    ompi_osc_rdma_dynamic_invalidate (module);
+
     OPAL_THREAD_LOCK(&module->lock);
     if (module->all_sync.epoch_active) {
         OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_INFO, "attempted lock_all when active target epoch is %s "
@@ -382,6 +397,7 @@ int ompi_osc_rdma_unlock_all_atomic (struct ompi_win_t *win)
 {
     ompi_osc_rdma_module_t *module = GET_MODULE(win);
     ompi_osc_rdma_sync_t *lock;
+    int ret;
 
     OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_TRACE, "unlock_all: %s", win->w_name);
 
@@ -395,7 +411,7 @@ int ompi_osc_rdma_unlock_all_atomic (struct ompi_win_t *win)
     }
 
     /* finish all outstanding fragments */
-    ompi_osc_rdma_sync_rdma_complete (lock);
+    ret = ompi_osc_rdma_sync_rdma_complete (lock);
 
     if (0 == (lock->sync.lock.mpi_assert & MPI_MODE_NOCHECK)) {
         if (OMPI_OSC_RDMA_LOCKING_ON_DEMAND == module->locking_mode) {
@@ -425,5 +441,5 @@ int ompi_osc_rdma_unlock_all_atomic (struct ompi_win_t *win)
 
     OSC_RDMA_VERBOSE(MCA_BASE_VERBOSE_TRACE, "unlock_all complete");
 
-    return OMPI_SUCCESS;
+    return ret;
 }
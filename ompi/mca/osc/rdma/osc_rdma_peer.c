@@ -394,6 +394,8 @@ static void ompi_osc_rdma_peer_dynamic_destruct (ompi_osc_rdma_peer_dynamic_t *p
     if (peer->regions) {
         free (peer->regions);
     }
+
+    free (peer->sorted_regions);
 }
 
 OBJ_CLASS_INSTANCE(ompi_osc_rdma_peer_dynamic_t, ompi_osc_rdma_peer_t,
@@ -51,6 +51,15 @@ struct ompi_osc_rdma_peer_t {
 
     /** index into BTL array */
     uint8_t state_btl_index;
+
+    /** striped accumulate locks held on this peer (first, count). only one
+     * accumulate can be in flight at a time (see OMPI_OSC_RDMA_PEER_ACCUMULATING) */
+    unsigned int acc_lock_first;
+    unsigned int acc_lock_count;
+
+    /** small operations to this peer being combined (protected by the lock of
+     * the synchronization object) */
+    struct ompi_osc_rdma_aggregation_t *aggregate;
 };
 typedef struct ompi_osc_rdma_peer_t ompi_osc_rdma_peer_t;
 
@@ -63,11 +72,20 @@ struct ompi_osc_rdma_peer_dynamic_t {
     /** last region id seen for this peer */
     uint32_t region_id;
 
-    /** number of regions in the regions array */
+    /** number of slots allocated in the regions array */
     uint32_t region_count;
 
-    /** cached array of attached regions for this peer */
+    /** cached array of attached regions for this peer. unused slots have a length of 0 */
     struct ompi_osc_rdma_region_t *regions;
+
+    /** attached regions in the regions array sorted by base address */
+    struct ompi_osc_rdma_region_t **sorted_regions;
+
+    /** number of entries in sorted_regions */
+    uint32_t sorted_count;
+
+    /** value of the module's dynamic_epoch when the cache was last validated */
+    uint32_t epoch;
 };
 
 typedef struct ompi_osc_rdma_peer_dynamic_t ompi_osc_rdma_peer_dynamic_t;
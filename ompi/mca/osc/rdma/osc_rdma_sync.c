@@ -19,12 +19,15 @@ static void ompi_osc_rdma_sync_constructor (ompi_osc_rdma_sync_t *rdma_sync)
     rdma_sync->outstanding_rdma.counter = 0;
     OBJ_CONSTRUCT(&rdma_sync->lock, opal_mutex_t);
     OBJ_CONSTRUCT(&rdma_sync->demand_locked_peers, opal_list_t);
+    OBJ_CONSTRUCT(&rdma_sync->aggregations, opal_list_t);
+    rdma_sync->aggregation_error = OMPI_SUCCESS;
 }
 
 static void ompi_osc_rdma_sync_destructor (ompi_osc_rdma_sync_t *rdma_sync)
 {
     OBJ_DESTRUCT(&rdma_sync->lock);
     OBJ_DESTRUCT(&rdma_sync->demand_locked_peers);
+    OBJ_DESTRUCT(&rdma_sync->aggregations);
 }
 
 OBJ_CLASS_INSTANCE(ompi_osc_rdma_sync_t, opal_object_t, ompi_osc_rdma_sync_constructor,
@@ -91,6 +91,14 @@ struct ompi_osc_rdma_sync_t {
     /** demand locked peers (lock-all) */
     opal_list_t demand_locked_peers;
 
+    /** small operations waiting to be combined (ompi_osc_rdma_aggregation_t). protected
+     * by the sync lock, as is the aggregate pointer of the peers */
+    opal_list_t aggregations;
+
+    /** error of a combined operation that failed after being reported as started.
+     * returned (and cleared) by the next flush or completion of the sync */
+    opal_atomic_int32_t aggregation_error;
+
     /** number of peers */
     int num_peers;
 
@@ -139,6 +147,16 @@ void ompi_osc_rdma_sync_return (ompi_osc_rdma_sync_t *rdma_sync);
  */
 bool ompi_osc_rdma_sync_pscw_peer (struct ompi_osc_rdma_module_t *module, int target, struct ompi_osc_rdma_peer_t **peer);
 
+/**
+ * @brief start the combined operations of a synchronization object
+ *
+ * @param[in] rdma_sync   synchronization object
+ *
+ * Starts the transfer of all partially filled aggregation buffers associated
+ * with the synchronization object. The operations are tracked by the
+ * outstanding rdma counter of the synchronization object.
+ */
+void ompi_osc_rdma_sync_aggregations_flush (ompi_osc_rdma_sync_t *rdma_sync);
 
 static inline int64_t ompi_osc_rdma_sync_get_count (ompi_osc_rdma_sync_t *rdma_sync)
 {
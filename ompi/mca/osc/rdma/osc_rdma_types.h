@@ -180,6 +180,46 @@ struct ompi_osc_rdma_frag_t {
 typedef struct ompi_osc_rdma_frag_t ompi_osc_rdma_frag_t;
 OBJ_CLASS_DECLARATION(ompi_osc_rdma_frag_t);
 
+/** maximum number of distinct origin buffers in an aggregated get */
+#define OMPI_OSC_RDMA_AGGREGATION_MAX_GETS 16
+
+/**
+ * @brief small put or get operations to contiguous target memory combined
+ *        into a single btl operation
+ */
+struct ompi_osc_rdma_aggregation_t {
+    opal_free_list_item_t super;
+
+    /** synchronization object the operations were started on */
+    struct ompi_osc_rdma_sync_t *sync;
+
+    /** target of the operations */
+    struct ompi_osc_rdma_peer_t *peer;
+
+    /** OMPI_OSC_RDMA_TYPE_PUT or OMPI_OSC_RDMA_TYPE_GET */
+    int type;
+
+    /** target address of the first byte of the buffer */
+    uint64_t target_address;
+
+    /** registration handle of the target memory. windows with a stable handle only */
+    mca_btl_base_registration_handle_t *target_handle;
+
+    /** number of bytes used in the buffer (stored in super.ptr) */
+    size_t buffer_used;
+
+    /** origin buffers the data of a get is copied to on completion */
+    struct {
+        void *address;
+        size_t length;
+    } gets[OMPI_OSC_RDMA_AGGREGATION_MAX_GETS];
+
+    /** number of entries in gets */
+    int get_count;
+};
+typedef struct ompi_osc_rdma_aggregation_t ompi_osc_rdma_aggregation_t;
+OBJ_CLASS_DECLARATION(ompi_osc_rdma_aggregation_t);
+
 #define OSC_RDMA_VERBOSE(x, ...) OPAL_OUTPUT_VERBOSE((x, ompi_osc_base_framework.framework_output, __VA_ARGS__))
 
 #endif /* OMPI_OSC_RDMA_TYPES_H */
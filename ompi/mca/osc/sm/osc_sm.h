@@ -50,6 +50,13 @@ struct ompi_osc_sm_node_state_t {
 };
 typedef struct ompi_osc_sm_node_state_t ompi_osc_sm_node_state_t;
 
+/* one of the striped accumulate locks of a peer, on its own cache line */
+struct ompi_osc_sm_acc_lock_t {
+    opal_atomic_lock_t lock;
+    char padding[64 - sizeof(opal_atomic_lock_t)];
+};
+typedef struct ompi_osc_sm_acc_lock_t ompi_osc_sm_acc_lock_t;
+
 struct ompi_osc_sm_component_t {
     ompi_osc_base_component_t super;
 
@@ -57,6 +64,16 @@ struct ompi_osc_sm_component_t {
     unsigned int priority;
 
     char *backing_directory;
+
+    /** Default for the acc_single_intrinsic info key */
+    bool acc_single_intrinsic;
+
+    /** Default for the acc_lock_stripes info key */
+    unsigned int acc_lock_stripes;
+
+    /** Bytes of window memory covered by a chunk of the striped
+     * accumulate locks */
+    unsigned int acc_lock_stripe_size;
 };
 typedef struct ompi_osc_sm_component_t ompi_osc_sm_component_t;
 OMPI_DECLSPEC extern ompi_osc_sm_component_t mca_osc_sm_component;
@@ -75,6 +92,13 @@ struct ompi_osc_sm_module_t {
     opal_shmem_ds_t seg_ds;
     void *segment_base;
     bool noncontig;
+    /** accumulate operations only use predefined datatypes, and can
+     * be done with processor atomics */
+    bool acc_single_intrinsic;
+    /** number of accumulate locks per peer. 0 if the accumulate_lock of
+     * the peer protects its whole window */
+    unsigned int acc_lock_stripes;
+    unsigned int acc_lock_stripe_size;
 
     size_t *sizes;
     void **bases;
@@ -91,6 +115,8 @@ struct ompi_osc_sm_module_t {
     ompi_osc_sm_global_state_t *global_state;
     ompi_osc_sm_node_state_t *my_node_state;
     ompi_osc_sm_node_state_t *node_states;
+    /* acc_lock_stripes accumulate locks for each peer */
+    ompi_osc_sm_acc_lock_t *acc_locks;
 
     osc_sm_post_atomic_type_t **posts;
 
@@ -20,6 +20,174 @@
 
 #include "osc_sm.h"
 
+/*
+ * Accumulate operations on a single predefined datatype of 4 or 8 bytes are
+ * done element by element with processor atomics instead of under the
+ * accumulate lock of the target. This is only correct if all the
+ * accumulate operations on a location use the atomics, i.e. if the user
+ * asserted that no derived datatypes are used for accumulate operations
+ * (acc_single_intrinsic).
+ */
+#define OSC_SM_DEFINE_ATOMIC_OP(bits)                                   \
+static inline int##bits##_t                                             \
+ompi_osc_sm_atomic_op_##bits(opal_atomic_int##bits##_t *addr, int##bits##_t value, \
+                             struct ompi_op_t *op, struct ompi_datatype_t *dt) \
+{                                                                       \
+    int##bits##_t old, new_value;                                       \
+                                                                        \
+    if (op == &ompi_mpi_op_no_op.op) {                                  \
+        return *addr;                                                   \
+    } else if (op == &ompi_mpi_op_replace.op) {                         \
+        return opal_atomic_swap_##bits(addr, value);                    \
+    } else if (OMPI_DATATYPE_FLAG_DATA_INT == (dt->super.flags & OMPI_DATATYPE_FLAG_DATA_TYPE)) { \
+        if (op == &ompi_mpi_op_sum.op) {                                \
+            return opal_atomic_fetch_add_##bits(addr, value);           \
+        } else if (op == &ompi_mpi_op_band.op) {                        \
+            return opal_atomic_fetch_and_##bits(addr, value);           \
+        } else if (op == &ompi_mpi_op_bor.op) {                         \
+            return opal_atomic_fetch_or_##bits(addr, value);            \
+        } else if (op == &ompi_mpi_op_bxor.op) {                        \
+            return opal_atomic_fetch_xor_##bits(addr, value);           \
+        }                                                               \
+    }                                                                   \
+                                                                        \
+    /* floating point, min/max, etc. */                                 \
+    old = *addr;                                                        \
+    do {                                                                \
+        new_value = old;                                                \
+        ompi_op_reduce(op, &value, &new_value, 1, dt);                  \
+    } while (!opal_atomic_compare_exchange_strong_##bits(addr, &old, new_value)); \
+                                                                        \
+    return old;                                                         \
+}
+
+OSC_SM_DEFINE_ATOMIC_OP(32)
+OSC_SM_DEFINE_ATOMIC_OP(64)
+
+static inline bool
+ompi_osc_sm_use_atomics(ompi_osc_sm_module_t *module, void *remote_address,
+                        struct ompi_datatype_t *dt)
+{
+    ptrdiff_t lb, extent;
+
+    if (!module->acc_single_intrinsic || !ompi_datatype_is_predefined(dt)) {
+        return false;
+    }
+    ompi_datatype_get_extent(dt, &lb, &extent);
+
+    return (size_t) extent == dt->super.size &&
+        ompi_osc_base_is_atomic_size_supported((uint64_t) (uintptr_t) remote_address, dt->super.size);
+}
+
+/*
+ * With acc_lock_stripes set, an accumulate operation only takes the locks
+ * of the chunks of the target memory it touches, so that operations on
+ * disjoint parts of a window do not serialize.
+ */
+static inline void
+ompi_osc_sm_acc_lock_range(ompi_osc_sm_module_t *module, int target, void *remote_address,
+                           size_t target_count, struct ompi_datatype_t *target_dt,
+                           unsigned int *first, unsigned int *count)
+{
+    ptrdiff_t gap;
+    size_t span = opal_datatype_span(&target_dt->super, target_count, &gap);
+    uint64_t offset = (uint64_t) ((char *) remote_address + gap - (char *) module->bases[target]);
+
+    ompi_osc_base_acc_lock_range(offset, span, module->acc_lock_stripe_size,
+                                 module->acc_lock_stripes, first, count);
+}
+
+static inline void
+ompi_osc_sm_acc_lock(ompi_osc_sm_module_t *module, int target, void *remote_address,
+                     size_t target_count, struct ompi_datatype_t *target_dt)
+{
+    ompi_osc_sm_acc_lock_t *locks;
+    unsigned int first, count;
+
+    if (0 == module->acc_lock_stripes) {
+        opal_atomic_lock(&module->node_states[target].accumulate_lock);
+        return;
+    }
+
+    locks = module->acc_locks + target * module->acc_lock_stripes;
+    ompi_osc_sm_acc_lock_range(module, target, remote_address, target_count, target_dt,
+                               &first, &count);
+    for (unsigned int i = 0 ; i < count ; ++i) {
+        opal_atomic_lock(&locks[ompi_osc_base_acc_lock_index(first, count, module->acc_lock_stripes, i)].lock);
+    }
+}
+
+static inline void
+ompi_osc_sm_acc_unlock(ompi_osc_sm_module_t *module, int target, void *remote_address,
+                       size_t target_count, struct ompi_datatype_t *target_dt)
+{
+    ompi_osc_sm_acc_lock_t *locks;
+    unsigned int first, count;
+
+    if (0 == module->acc_lock_stripes) {
+        opal_atomic_unlock(&module->node_states[target].accumulate_lock);
+        return;
+    }
+
+    locks = module->acc_locks + target * module->acc_lock_stripes;
+    ompi_osc_sm_acc_lock_range(module, target, remote_address, target_count, target_dt,
+                               &first, &count);
+    for (unsigned int i = 0 ; i < count ; ++i) {
+        opal_atomic_unlock(&locks[ompi_osc_base_acc_lock_index(first, count, module->acc_lock_stripes, i)].lock);
+    }
+}
+
+/* returns OMPI_ERR_NOT_SUPPORTED if the accumulate lock has to be used */
+static inline int
+ompi_osc_sm_accumulate_atomic(ompi_osc_sm_module_t *module,
+                              const void *origin_addr,
+                              struct ompi_datatype_t *origin_dt,
+                              void *result_addr,
+                              struct ompi_datatype_t *result_dt,
+                              void *remote_address,
+                              size_t target_count,
+                              struct ompi_datatype_t *target_dt,
+                              struct ompi_op_t *op)
+{
+    size_t size = target_dt->super.size;
+
+    if (!ompi_osc_sm_use_atomics(module, remote_address, target_dt) ||
+        (op != &ompi_mpi_op_no_op.op && origin_dt != target_dt) ||
+        (NULL != result_addr && result_dt != target_dt)) {
+        return OMPI_ERR_NOT_SUPPORTED;
+    }
+
+    for (size_t i = 0 ; i < target_count ; ++i) {
+        const char *origin = (const char *) origin_addr + i * size;
+        char *result = (char *) result_addr + i * size;
+        char *remote = (char *) remote_address + i * size;
+
+        if (4 == size) {
+            int32_t value = 0, old;
+
+            if (op != &ompi_mpi_op_no_op.op) {
+                memcpy(&value, origin, sizeof(value));
+            }
+            old = ompi_osc_sm_atomic_op_32((opal_atomic_int32_t *) remote, value, op, target_dt);
+            if (NULL != result_addr) {
+                memcpy(result, &old, sizeof(old));
+            }
+        } else {
+            int64_t value = 0, old;
+
+            if (op != &ompi_mpi_op_no_op.op) {
+                memcpy(&value, origin, sizeof(value));
+            }
+            old = ompi_osc_sm_atomic_op_64((opal_atomic_int64_t *) remote, value, op, target_dt);
+            if (NULL != result_addr) {
+                memcpy(result, &old, sizeof(old));
+            }
+        }
+    }
+
+    return OMPI_SUCCESS;
+}
+
 int
 ompi_osc_sm_rput(const void *origin_addr,
                  size_t origin_count,
@@ -127,16 +295,20 @@ ompi_osc_sm_raccumulate(const void *origin_addr,
 
     remote_address = ((char*) (module->bases[target])) + module->disp_units[target] * target_disp;
 
-    opal_atomic_lock(&module->node_states[target].accumulate_lock);
-    if (op == &ompi_mpi_op_replace.op) {
-        ret = ompi_datatype_sndrcv((void *)origin_addr, origin_count, origin_dt,
-                                    remote_address, target_count, target_dt);
-    } else {
-        ret = ompi_osc_base_sndrcv_op(origin_addr, origin_count, origin_dt,
-                                      remote_address, target_count, target_dt,
-                                      op);
+    ret = ompi_osc_sm_accumulate_atomic(module, origin_addr, origin_dt, NULL, NULL,
+                                        remote_address, target_count, target_dt, op);
+    if (OMPI_ERR_NOT_SUPPORTED == ret) {
+        ompi_osc_sm_acc_lock(module, target, remote_address, target_count, target_dt);
+        if (op == &ompi_mpi_op_replace.op) {
+            ret = ompi_datatype_sndrcv((void *)origin_addr, origin_count, origin_dt,
+                                        remote_address, target_count, target_dt);
+        } else {
+            ret = ompi_osc_base_sndrcv_op(origin_addr, origin_count, origin_dt,
+                                          remote_address, target_count, target_dt,
+                                          op);
+        }
+        ompi_osc_sm_acc_unlock(module, target, remote_address, target_count, target_dt);
     }
-    opal_atomic_unlock(&module->node_states[target].accumulate_lock);
 
     /* the only valid field of RMA request status is the MPI_ERROR field.
      * ompi_request_empty has status MPI_SUCCESS and indicates the request is
@@ -178,7 +350,13 @@ ompi_osc_sm_rget_accumulate(const void *origin_addr,
 
     remote_address = ((char*) (module->bases[target])) + module->disp_units[target] * target_disp;
 
-    opal_atomic_lock(&module->node_states[target].accumulate_lock);
+    ret = ompi_osc_sm_accumulate_atomic(module, origin_addr, origin_dt, result_addr, result_dt,
+                                        remote_address, target_count, target_dt, op);
+    if (OMPI_ERR_NOT_SUPPORTED != ret) {
+        goto out;
+    }
+
+    ompi_osc_sm_acc_lock(module, target, remote_address, target_count, target_dt);
 
     ret = ompi_datatype_sndrcv(remote_address, target_count, target_dt,
                                result_addr, result_count, result_dt);
@@ -194,8 +372,9 @@ ompi_osc_sm_rget_accumulate(const void *origin_addr,
     }
 
  done:
-    opal_atomic_unlock(&module->node_states[target].accumulate_lock);
+    ompi_osc_sm_acc_unlock(module, target, remote_address, target_count, target_dt);
 
+ out:
     /* the only valid field of RMA request status is the MPI_ERROR field.
      * ompi_request_empty has status MPI_SUCCESS and indicates the request is
      * complete. */
@@ -293,16 +472,20 @@ ompi_osc_sm_accumulate(const void *origin_addr,
 
     remote_address = ((char*) (module->bases[target])) + module->disp_units[target] * target_disp;
 
-    opal_atomic_lock(&module->node_states[target].accumulate_lock);
-    if (op == &ompi_mpi_op_replace.op) {
-        ret = ompi_datatype_sndrcv((void *)origin_addr, origin_count, origin_dt,
-                                    remote_address, target_count, target_dt);
-    } else {
-        ret = ompi_osc_base_sndrcv_op(origin_addr, origin_count, origin_dt,
-                                      remote_address, target_count, target_dt,
-                                      op);
+    ret = ompi_osc_sm_accumulate_atomic(module, origin_addr, origin_dt, NULL, NULL,
+                                        remote_address, target_count, target_dt, op);
+    if (OMPI_ERR_NOT_SUPPORTED == ret) {
+        ompi_osc_sm_acc_lock(module, target, remote_address, target_count, target_dt);
+        if (op == &ompi_mpi_op_replace.op) {
+            ret = ompi_datatype_sndrcv((void *)origin_addr, origin_count, origin_dt,
+                                        remote_address, target_count, target_dt);
+        } else {
+            ret = ompi_osc_base_sndrcv_op(origin_addr, origin_count, origin_dt,
+                                          remote_address, target_count, target_dt,
+                                          op);
+        }
+        ompi_osc_sm_acc_unlock(module, target, remote_address, target_count, target_dt);
     }
-    opal_atomic_unlock(&module->node_states[target].accumulate_lock);
 
     return ret;
 }
@@ -337,7 +520,13 @@ ompi_osc_sm_get_accumulate(const void *origin_addr,
 
     remote_address = ((char*) (module->bases[target])) + module->disp_units[target] * target_disp;
 
-    opal_atomic_lock(&module->node_states[target].accumulate_lock);
+    ret = ompi_osc_sm_accumulate_atomic(module, origin_addr, origin_dt, result_addr, result_dt,
+                                        remote_address, target_count, target_dt, op);
+    if (OMPI_ERR_NOT_SUPPORTED != ret) {
+        goto out;
+    }
+
+    ompi_osc_sm_acc_lock(module, target, remote_address, target_count, target_dt);
 
     ret = ompi_datatype_sndrcv(remote_address, target_count, target_dt,
                                result_addr, result_count, result_dt);
@@ -353,8 +542,9 @@ ompi_osc_sm_get_accumulate(const void *origin_addr,
     }
 
  done:
-    opal_atomic_unlock(&module->node_states[target].accumulate_lock);
+    ompi_osc_sm_acc_unlock(module, target, remote_address, target_count, target_dt);
 
+ out:
     return ret;
 }
 
@@ -383,7 +573,28 @@ ompi_osc_sm_compare_and_swap(const void *origin_addr,
 
     ompi_datatype_type_size(dt, &size);
 
-    opal_atomic_lock(&module->node_states[target].accumulate_lock);
+    if (ompi_osc_sm_use_atomics(module, remote_address, dt)) {
+        if (4 == size) {
+            int32_t compare, value;
+
+            memcpy(&compare, compare_addr, sizeof(compare));
+            memcpy(&value, origin_addr, sizeof(value));
+            (void) opal_atomic_compare_exchange_strong_32((opal_atomic_int32_t *) remote_address,
+                                                          &compare, value);
+            memcpy(result_addr, &compare, sizeof(compare));
+        } else {
+            int64_t compare, value;
+
+            memcpy(&compare, compare_addr, sizeof(compare));
+            memcpy(&value, origin_addr, sizeof(value));
+            (void) opal_atomic_compare_exchange_strong_64((opal_atomic_int64_t *) remote_address,
+                                                          &compare, value);
+            memcpy(result_addr, &compare, sizeof(compare));
+        }
+        return OMPI_SUCCESS;
+    }
+
+    ompi_osc_sm_acc_lock(module, target, remote_address, 1, dt);
 
     /* fetch */
     ompi_datatype_copy_content_same_ddt(dt, 1, (char*) result_addr, (char*) remote_address);
@@ -393,7 +604,7 @@ ompi_osc_sm_compare_and_swap(const void *origin_addr,
         ompi_datatype_copy_content_same_ddt(dt, 1, (char*) remote_address, (char*) origin_addr);
     }
 
-    opal_atomic_unlock(&module->node_states[target].accumulate_lock);
+    ompi_osc_sm_acc_unlock(module, target, remote_address, 1, dt);
 
     return OMPI_SUCCESS;
 }
@@ -421,7 +632,12 @@ ompi_osc_sm_fetch_and_op(const void *origin_addr,
 
     remote_address = ((char*) (module->bases[target])) + module->disp_units[target] * target_disp;
 
-    opal_atomic_lock(&module->node_states[target].accumulate_lock);
+    if (OMPI_SUCCESS == ompi_osc_sm_accumulate_atomic(module, origin_addr, dt, result_addr, dt,
+                                                      remote_address, 1, dt, op)) {
+        return OMPI_SUCCESS;
+    }
+
+    ompi_osc_sm_acc_lock(module, target, remote_address, 1, dt);
 
     /* fetch */
     ompi_datatype_copy_content_same_ddt(dt, 1, (char*) result_addr, (char*) remote_address);
@@ -435,7 +651,7 @@ ompi_osc_sm_fetch_and_op(const void *origin_addr,
     }
 
  done:
-    opal_atomic_unlock(&module->node_states[target].accumulate_lock);
+    ompi_osc_sm_acc_unlock(module, target, remote_address, 1, dt);
 
-    return OMPI_SUCCESS;;
+    return OMPI_SUCCESS;
 }
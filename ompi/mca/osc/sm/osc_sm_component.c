@@ -138,6 +138,41 @@ static int component_register (void)
                                           &mca_osc_sm_component.priority);
     free(description_str);
 
+    mca_osc_sm_component.acc_single_intrinsic = false;
+    opal_asprintf(&description_str, "Use processor atomics for MPI_Accumulate, MPI_Fetch_and_op, etc. "
+                  "Only valid for codes that do not use derived datatypes in accumulate operations. "
+                  "Info key of same name overrides this value (default: %s)",
+                  mca_osc_sm_component.acc_single_intrinsic ? "true" : "false");
+    (void) mca_base_component_var_register(&mca_osc_sm_component.super.osc_version,
+                                           "acc_single_intrinsic", description_str,
+                                           MCA_BASE_VAR_TYPE_BOOL, NULL, 0, 0,
+                                           OPAL_INFO_LVL_5, MCA_BASE_VAR_SCOPE_GROUP,
+                                           &mca_osc_sm_component.acc_single_intrinsic);
+    free(description_str);
+
+    mca_osc_sm_component.acc_lock_stripes = 0;
+    opal_asprintf(&description_str, "Number of locks protecting the window memory of each process "
+                  "in accumulate operations, so that accumulate operations on disjoint parts of the "
+                  "memory can proceed concurrently. 0 uses a single lock. Info key of same name "
+                  "overrides this value (default: %u)", mca_osc_sm_component.acc_lock_stripes);
+    (void) mca_base_component_var_register(&mca_osc_sm_component.super.osc_version,
+                                           "acc_lock_stripes", description_str,
+                                           MCA_BASE_VAR_TYPE_UNSIGNED_INT, NULL, 0, 0,
+                                           OPAL_INFO_LVL_5, MCA_BASE_VAR_SCOPE_GROUP,
+                                           &mca_osc_sm_component.acc_lock_stripes);
+    free(description_str);
+
+    mca_osc_sm_component.acc_lock_stripe_size = 4096;
+    opal_asprintf(&description_str, "Size in bytes of the chunks of window memory mapped to the "
+                  "accumulate locks when acc_lock_stripes is set (default: %u)",
+                  mca_osc_sm_component.acc_lock_stripe_size);
+    (void) mca_base_component_var_register(&mca_osc_sm_component.super.osc_version,
+                                           "acc_lock_stripe_size", description_str,
+                                           MCA_BASE_VAR_TYPE_UNSIGNED_INT, NULL, 0, 0,
+                                           OPAL_INFO_LVL_5, MCA_BASE_VAR_SCOPE_GROUP,
+                                           &mca_osc_sm_component.acc_lock_stripe_size);
+    free(description_str);
+
     return OPAL_SUCCESS;
 }
 
@@ -217,8 +252,22 @@ component_select(struct ompi_win_t *win, void **base, size_t size, ptrdiff_t dis
 
     OBJ_CONSTRUCT(&module->lock, opal_mutex_t);
 
+    module->acc_single_intrinsic = mca_osc_sm_component.acc_single_intrinsic;
+    module->acc_lock_stripes = mca_osc_sm_component.acc_lock_stripes;
+    module->acc_lock_stripe_size = mca_osc_sm_component.acc_lock_stripe_size;
     if (NULL != info) {
+        bool acc_single_intrinsic;
+        int flag;
+
         ompi_osc_base_set_memory_alignment(info, &memory_alignment);
+        if (OMPI_SUCCESS == opal_info_get_bool(info, "acc_single_intrinsic",
+                                               &acc_single_intrinsic, &flag) && flag) {
+            module->acc_single_intrinsic = acc_single_intrinsic;
+        }
+        ompi_osc_base_set_acc_lock_stripes(info, &module->acc_lock_stripes);
+    }
+    if (module->acc_lock_stripes < 2 || 0 == module->acc_lock_stripe_size) {
+        module->acc_lock_stripes = 0;
     }
 
     /* fill in the function pointer part */
@@ -246,8 +295,14 @@ component_select(struct ompi_win_t *win, void **base, size_t size, ptrdiff_t dis
 
         module->global_state = malloc(sizeof(ompi_osc_sm_global_state_t));
         if (NULL == module->global_state) return OMPI_ERR_TEMP_OUT_OF_RESOURCE;
-        module->node_states = malloc(sizeof(ompi_osc_sm_node_state_t));
-        if (NULL == module->node_states) return OMPI_ERR_TEMP_OUT_OF_RESOURCE;
+        /* the accumulate locks start on a cache line of their own */
+        if (0 != posix_memalign ((void **) &module->node_states, 64,
+                                 OPAL_ALIGN(sizeof(ompi_osc_sm_node_state_t), 64, size_t) +
+                                 module->acc_lock_stripes * sizeof(ompi_osc_sm_acc_lock_t))) {
+            module->node_states = NULL;
+            return OMPI_ERR_TEMP_OUT_OF_RESOURCE;
+        }
+        module->acc_locks = OPAL_ALIGN_PTR(module->node_states + 1, 64, ompi_osc_sm_acc_lock_t *);
         module->posts = calloc (1, sizeof(module->posts[0]) + sizeof (module->posts[0][0]));
         if (NULL == module->posts) return OMPI_ERR_TEMP_OUT_OF_RESOURCE;
         module->posts[0] = (osc_sm_post_atomic_type_t *) (module->posts + 1);
@@ -308,8 +363,11 @@ component_select(struct ompi_win_t *win, void **base, size_t size, ptrdiff_t dis
         }
 
         /* user opal/shmem directly to create a shared memory segment */
+        /* the accumulate locks start on a cache line boundary, after the node states */
         state_size = sizeof(ompi_osc_sm_global_state_t) + sizeof(ompi_osc_sm_node_state_t) * comm_size;
         state_size += OPAL_ALIGN_PAD_AMOUNT(state_size, 64);
+        state_size += sizeof(ompi_osc_sm_acc_lock_t) * module->acc_lock_stripes * comm_size;
+        state_size += OPAL_ALIGN_PAD_AMOUNT(state_size, 64);
         posts_size = comm_size * post_size * sizeof (module->posts[0][0]);
         posts_size += OPAL_ALIGN_PAD_AMOUNT(posts_size, 64);
         data_base_size = state_size + posts_size;
@@ -372,6 +430,8 @@ component_select(struct ompi_win_t *win, void **base, size_t size, ptrdiff_t dis
         module->posts[0] = (osc_sm_post_atomic_type_t *) (module->segment_base);
         module->global_state = (ompi_osc_sm_global_state_t *) (module->posts[0] + comm_size * post_size);
         module->node_states = (ompi_osc_sm_node_state_t *) (module->global_state + 1);
+        /* global_state is 64 byte aligned as posts_size is padded to 64 */
+        module->acc_locks = OPAL_ALIGN_PTR(module->node_states + comm_size, 64, ompi_osc_sm_acc_lock_t *);
 
         for (i = 0, total = data_base_size ; i < comm_size ; ++i) {
             if (i > 0) {
@@ -400,6 +460,10 @@ component_select(struct ompi_win_t *win, void **base, size_t size, ptrdiff_t dis
     *base = module->bases[ompi_comm_rank(module->comm)];
 
     opal_atomic_lock_init(&module->my_node_state->accumulate_lock, OPAL_ATOMIC_LOCK_UNLOCKED);
+    for (unsigned int i = 0 ; i < module->acc_lock_stripes ; ++i) {
+        opal_atomic_lock_init(&module->acc_locks[ompi_comm_rank(module->comm) * module->acc_lock_stripes + i].lock,
+                              OPAL_ATOMIC_LOCK_UNLOCKED);
+    }
 
     /* share everyone's displacement units. */
     module->disp_units = malloc(sizeof(ptrdiff_t) * comm_size);
@@ -604,6 +668,14 @@ ompi_osc_sm_get_info(struct ompi_win_t *win, struct opal_info_t **info_used)
         opal_info_set(info, "alloc_shared_noncontig",
                       (module->noncontig) ? "true" : "false");
     }
+    opal_info_set(info, "acc_single_intrinsic",
+                  module->acc_single_intrinsic ? "true" : "false");
+    if (0 < module->acc_lock_stripes) {
+        char stripes[16];
+
+        snprintf(stripes, sizeof(stripes), "%u", module->acc_lock_stripes);
+        opal_info_set(info, "acc_lock_stripes", stripes);
+    }
 
     *info_used = info;
 
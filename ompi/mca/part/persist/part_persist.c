@@ -45,3 +45,109 @@ OBJ_CLASS_INSTANCE(mca_part_persist_list_t,
                    NULL,
                    NULL);
 
+
+static void mca_part_persist_channel_construct(mca_part_persist_channel_t *channel)
+{
+    channel->peer_proc = NULL;
+    channel->datatype = NULL;
+    channel->persist_reqs = NULL;
+}
+
+static void mca_part_persist_channel_destruct(mca_part_persist_channel_t *channel)
+{
+    if(NULL != channel->persist_reqs) {
+        for(size_t i = 0; i < channel->parts; i++) {
+            ompi_request_free(&(channel->persist_reqs[i]));
+        }
+        free(channel->persist_reqs);
+    }
+    if(NULL != channel->datatype) {
+        OBJ_RELEASE(channel->datatype);
+    }
+}
+
+OBJ_CLASS_INSTANCE(mca_part_persist_channel_t,
+                   opal_list_item_t,
+                   mca_part_persist_channel_construct,
+                   mca_part_persist_channel_destruct);
+
+mca_part_persist_channel_t *mca_part_persist_channel_take(mca_part_persist_request_type_t req_type,
+                                                          ompi_communicator_t *comm, int32_t peer,
+                                                          int32_t tag, size_t parts, size_t count,
+                                                          ompi_datatype_t *datatype)
+{
+    mca_part_persist_channel_t *channel, *found = NULL;
+    struct ompi_proc_t *peer_proc = NULL;
+    uint32_t cid = 0;
+
+    if(NULL != comm) {
+        cid = ompi_comm_get_local_cid(comm);
+        peer_proc = ompi_comm_peer_lookup(comm, peer);
+    }
+
+    OPAL_THREAD_LOCK(&ompi_part_persist.lock);
+    OPAL_LIST_FOREACH_REV(channel, &ompi_part_persist.channel_cache, mca_part_persist_channel_t) {
+        if(channel->req_type == req_type && channel->cid == cid && channel->peer_proc == peer_proc && channel->peer == peer &&
+           channel->tag == tag && channel->parts == parts && channel->count == count &&
+           channel->datatype == datatype) {
+            opal_list_remove_item(&ompi_part_persist.channel_cache, &channel->super);
+            found = channel;
+            break;
+        }
+    }
+    OPAL_THREAD_UNLOCK(&ompi_part_persist.lock);
+
+    return found;
+}
+
+void mca_part_persist_channel_store(struct mca_part_persist_request_t *req)
+{
+    mca_part_persist_channel_t *channel = OBJ_NEW(mca_part_persist_channel_t);
+    opal_list_item_t *evicted = NULL;
+
+    if(NULL == channel) return;
+
+    channel->req_type = req->req_type;
+    if(MCA_PART_PERSIST_REQUEST_PSEND == req->req_type) {
+        channel->cid = ompi_comm_get_local_cid(req->req_comm);
+        channel->peer_proc = ompi_comm_peer_lookup(req->req_comm, req->req_peer);
+        channel->peer = req->req_peer;
+        channel->tag = req->req_tag;
+    } else {
+        /* The tags are only unique per sender, and are not tied to the user communicator */
+        channel->cid = 0;
+        channel->peer = req->world_peer;
+        channel->tag = req->my_send_tag;
+    }
+    channel->parts = req->real_parts;
+    channel->count = req->real_count;
+    channel->datatype = req->req_datatype;
+    OBJ_RETAIN(channel->datatype);
+    channel->addr = req->req_addr;
+    channel->real_dt_size = req->real_dt_size;
+    channel->world_peer = req->world_peer;
+    channel->send_tag = req->my_send_tag;
+    channel->recv_tag = req->my_recv_tag;
+    channel->persist_reqs = req->persist_reqs;
+    req->persist_reqs = NULL;
+
+    OPAL_THREAD_LOCK(&ompi_part_persist.lock);
+    opal_list_append(&ompi_part_persist.channel_cache, &channel->super);
+    if(opal_list_get_size(&ompi_part_persist.channel_cache) > (size_t) ompi_part_persist.channel_cache_size) {
+        evicted = opal_list_remove_first(&ompi_part_persist.channel_cache);
+    }
+    OPAL_THREAD_UNLOCK(&ompi_part_persist.lock);
+
+    if(NULL != evicted) {
+        OBJ_RELEASE(evicted);
+    }
+}
+
+void mca_part_persist_channel_flush(void)
+{
+    opal_list_item_t *item;
+
+    while(NULL != (item = opal_list_remove_first(&ompi_part_persist.channel_cache))) {
+        OBJ_RELEASE(item);
+    }
+}
@@ -38,6 +38,7 @@
 #include "ompi/communicator/communicator.h"
 #include "ompi/request/request.h"
 #include "opal/sys/atomic.h"
+#include "opal/class/opal_fifo.h"
 
 #include "ompi/mca/part/persist/part_persist_request.h"
 #include "ompi/mca/part/base/part_base_precvreq.h"
@@ -54,13 +55,62 @@ typedef struct mca_part_persist_list_t {
 
 OPAL_DECLSPEC OBJ_CLASS_DECLARATION(mca_part_persist_list_t);
 
+/**
+ * A channel negotiated by a freed request, kept to set up the next request with the same
+ * signature without the set-up handshake. The user communicator is not retained: a send channel
+ * is keyed by its local CID and only matches while the communicator in that slot still maps the
+ * destination to the same process. The datatype is retained, so it can not be recycled under the
+ * same address while cached.
+ */
+typedef struct mca_part_persist_channel_t {
+    opal_list_item_t        super;
+    mca_part_persist_request_type_t req_type;
+    uint32_t                cid;          /* send side only: local CID of the user communicator */
+    struct ompi_proc_t     *peer_proc;    /* send side only: process of the destination */
+    int32_t                 peer;         /* destination in comm (send) or world rank of the sender (recv) */
+    int32_t                 tag;          /* user tag (send) or first data tag (recv) */
+    size_t                  parts;
+    size_t                  count;
+    ompi_datatype_t        *datatype;
+    const void             *addr;         /* buffer the persistent requests are bound to */
+    size_t                  real_dt_size;
+    int32_t                 world_peer;
+    int32_t                 send_tag;
+    int32_t                 recv_tag;
+    ompi_request_t        **persist_reqs;
+} mca_part_persist_channel_t;
+
+OPAL_DECLSPEC OBJ_CLASS_DECLARATION(mca_part_persist_channel_t);
+
+struct mca_part_persist_request_t;
+
+/**
+ * Remove and return the cached channel matching a signature, or NULL.
+ */
+mca_part_persist_channel_t *mca_part_persist_channel_take(mca_part_persist_request_type_t req_type,
+                                                          ompi_communicator_t *comm, int32_t peer,
+                                                          int32_t tag, size_t parts, size_t count,
+                                                          ompi_datatype_t *datatype);
+
+/**
+ * Cache the channel of a request being freed. The persistent requests move to the cache.
+ */
+void mca_part_persist_channel_store(struct mca_part_persist_request_t *req);
+
+/**
+ * Release all the cached channels.
+ */
+void mca_part_persist_channel_flush(void);
+
 
 struct ompi_part_persist_t {
     mca_part_base_module_t super;
     int                    free_list_num;
     int                    free_list_max;
     int                    free_list_inc;
-    opal_list_t           *progress_list;
+    opal_list_t           *progress_list; /* All the requests, for bookkeeping. Protected by lock. */
+    opal_fifo_t            pending;       /* Requests that got work to do since the last progress call. */
+    opal_list_t            active_list;   /* Requests with work in progress. Only touched by the progress engine. */
 
     int32_t next_send_tag;                /**< This is a counter for send tags for the actual data transfer. */
     int32_t next_recv_tag; 
@@ -80,27 +130,44 @@ struct ompi_part_persist_t {
                                              to set up the requests. */
     opal_atomic_int32_t    block_entry;
     opal_mutex_t lock; 
+    bool                   aggregate;     /* Send the ready partitions in runs instead of one message each. */
+    int                    channel_cache_size; /* Maximum number of cached channels, 0 to disable the cache. */
+    opal_list_t            channel_cache; /* Channels of freed requests, most recent last. Protected by lock. */
 };
 typedef struct ompi_part_persist_t ompi_part_persist_t;
 extern ompi_part_persist_t ompi_part_persist;
 
 
 /**
- * This is a helper function that frees a request. This requires ompi_part_persist.lock be held before calling.
+ * This is a helper function that frees a request. It must be called from the progress engine, after
+ * the request has been removed from the active list.
  */
 __opal_attribute_always_inline__ static inline int
 mca_part_persist_free_req(struct mca_part_persist_request_t* req)
 {
     int err = OMPI_SUCCESS;
     size_t i;
+    OPAL_THREAD_LOCK(&ompi_part_persist.lock);
     opal_list_remove_item(ompi_part_persist.progress_list, (opal_list_item_t*)req->progress_elem);
+    OPAL_THREAD_UNLOCK(&ompi_part_persist.lock);
     OBJ_RELEASE(req->progress_elem);
+    OBJ_RELEASE(req->pending_elem);
 
-    for(i = 0; i < req->real_parts; i++) {
-        ompi_request_free(&(req->persist_reqs[i]));
+    /* Aggregated receives have no persistent requests worth keeping */
+    if(0 < ompi_part_persist.channel_cache_size && true == req->initialized &&
+       (MCA_PART_PERSIST_REQUEST_PSEND == req->req_type || NULL != req->persist_reqs)) {
+        mca_part_persist_channel_store(req);
+    }
+    if(NULL != req->persist_reqs) {
+        for(i = 0; i < req->real_parts; i++) {
+            ompi_request_free(&(req->persist_reqs[i]));
+        }
     }
     free(req->persist_reqs);
     free(req->flags);
+    free((void *) req->ready_map);
+    free(req->sent_map);
+    free(req->runs);
 
     if( MCA_PART_PERSIST_REQUEST_PRECV == req->req_type ) {
         MCA_PART_PERSIST_PRECV_REQUEST_RETURN(req);
@@ -132,6 +199,44 @@ __opal_attribute_always_inline__ static inline void mca_part_persist_init_lists(
                          ompi_part_persist.free_list_inc,
                          NULL, 0, NULL, NULL, NULL);
      ompi_part_persist.progress_list = OBJ_NEW(opal_list_t);
+     OBJ_CONSTRUCT(&ompi_part_persist.pending, opal_fifo_t);
+     OBJ_CONSTRUCT(&ompi_part_persist.active_list, opal_list_t);
+     OBJ_CONSTRUCT(&ompi_part_persist.channel_cache, opal_list_t);
+}
+
+/**
+ * Whether the progress engine has something to do for a request: finish its set-up, test the
+ * partitions handed to the PML, or release it once freed.
+ */
+__opal_attribute_always_inline__ static inline bool
+mca_part_persist_has_work(struct mca_part_persist_request_t* req)
+{
+    if(false == req->initialized || true == req->req_free_called) {
+        return true;
+    }
+    if(true == req->req_part_complete || OMPI_REQUEST_ACTIVE != req->req_ompi.req_state) {
+        return false;
+    }
+    /* A send only has work once some partitions are ready */
+    if(MCA_PART_PERSIST_REQUEST_PSEND == req->req_type) {
+        return (size_t) req->ready_count != req->done_count;
+    }
+    return true;
+}
+
+/**
+ * Hand a request to the progress engine. This is lock-free, and can be called by any thread after
+ * updating the state of the request. A request is queued at most once.
+ */
+__opal_attribute_always_inline__ static inline void
+mca_part_persist_enqueue(struct mca_part_persist_request_t* req)
+{
+    int32_t expected = 0;
+
+    opal_atomic_wmb();
+    if(opal_atomic_compare_exchange_strong_32(&req->queued, &expected, 1)) {
+        opal_fifo_push_atomic(&ompi_part_persist.pending, (opal_list_item_t*)req->pending_elem);
+    }
 }
 
 __opal_attribute_always_inline__ static inline void
@@ -150,15 +255,203 @@ mca_part_persist_complete(struct mca_part_persist_request_t* request)
     ompi_request_complete(&(request->req_ompi), true );
 }
 
+/*
+ * Aggregated transport helpers. A partition is ready once its bit is set in
+ * ready_map (by MPI_Pready, possibly from several threads at once), and sent
+ * once its bit is set in sent_map (by the progress engine, under the lock).
+ */
+#define MCA_PART_PERSIST_MAP_BITS 64
+#define MCA_PART_PERSIST_MAP_WORDS(parts) \
+    (((parts) + MCA_PART_PERSIST_MAP_BITS - 1) / MCA_PART_PERSIST_MAP_BITS)
+
+__opal_attribute_always_inline__ static inline bool
+mca_part_persist_map_test(const uint64_t *map, size_t part)
+{
+    return 0 != (map[part / MCA_PART_PERSIST_MAP_BITS] & (1ULL << (part % MCA_PART_PERSIST_MAP_BITS)));
+}
+
+__opal_attribute_always_inline__ static inline void
+mca_part_persist_mark_ready(struct mca_part_persist_request_t* req, size_t min_part, size_t max_part)
+{
+    size_t first_word = min_part / MCA_PART_PERSIST_MAP_BITS;
+    size_t last_word = max_part / MCA_PART_PERSIST_MAP_BITS;
+
+    for(size_t w = first_word; w <= last_word; w++) {
+        uint64_t mask = ~0ULL;
+        if(w == first_word) {
+            mask &= ~0ULL << (min_part % MCA_PART_PERSIST_MAP_BITS);
+        }
+        if(w == last_word) {
+            mask &= ~0ULL >> (MCA_PART_PERSIST_MAP_BITS - 1 - max_part % MCA_PART_PERSIST_MAP_BITS);
+        }
+        (void) opal_atomic_fetch_or_64(&req->ready_map[w], (int64_t) mask);
+    }
+}
+
+/**
+ * Post a control message and a single send for each run of contiguous
+ * partitions that are ready but not sent yet.
+ */
+__opal_attribute_always_inline__ static inline int
+mca_part_persist_send_runs(struct mca_part_persist_request_t* req)
+{
+    const uint64_t *ready = (const uint64_t *) req->ready_map;
+    int ctrl_tag = req->my_send_tag + (int) req->real_parts;
+    size_t part = 0;
+    int err;
+
+    opal_atomic_rmb();
+    while(part < req->real_parts) {
+        size_t w = part / MCA_PART_PERSIST_MAP_BITS;
+        uint64_t pending = (ready[w] & ~req->sent_map[w]) & (~0ULL << (part % MCA_PART_PERSIST_MAP_BITS));
+
+        if(0 == pending) {
+            part = (w + 1) * MCA_PART_PERSIST_MAP_BITS;
+            continue;
+        }
+        size_t first = w * MCA_PART_PERSIST_MAP_BITS + (size_t) __builtin_ctzll(pending);
+        size_t last = first;
+        while(last + 1 < req->real_parts && mca_part_persist_map_test(ready, last + 1)
+              && !mca_part_persist_map_test(req->sent_map, last + 1)) {
+            last++;
+        }
+        for(size_t i = first; i <= last; i++) {
+            req->sent_map[i / MCA_PART_PERSIST_MAP_BITS] |= 1ULL << (i % MCA_PART_PERSIST_MAP_BITS);
+        }
+
+        struct mca_part_persist_run_t *run = &req->runs[req->num_runs++];
+        run->hdr.first = first;
+        run->hdr.count = last - first + 1;
+        err = MCA_PML_CALL(isend(&run->hdr, sizeof(struct mca_part_persist_run_hdr_t), MPI_BYTE,
+                                 req->world_peer, ctrl_tag, MCA_PML_BASE_SEND_STANDARD,
+                                 ompi_part_persist.part_comm, &run->ctrl_req));
+        if(OMPI_SUCCESS != err) return err;
+        err = MCA_PML_CALL(isend(((char *) req->req_addr) + req->part_size * first,
+                                 req->real_count * run->hdr.count, req->req_datatype,
+                                 req->world_peer, req->my_send_tag + (int) first,
+                                 MCA_PML_BASE_SEND_STANDARD, ompi_part_persist.part_comm,
+                                 &run->data_req));
+        if(OMPI_SUCCESS != err) return err;
+        part = last + 1;
+    }
+    return OMPI_SUCCESS;
+}
+
+/**
+ * Post the receive of the data of every run announced so far.
+ */
+__opal_attribute_always_inline__ static inline int
+mca_part_persist_recv_runs(struct mca_part_persist_request_t* req, size_t dt_size)
+{
+    int ctrl_tag = req->my_send_tag + (int) req->real_parts;
+    int done = 0, err;
+
+    while(MPI_REQUEST_NULL != req->ctrl_req) {
+        ompi_request_test(&req->ctrl_req, &done, MPI_STATUS_IGNORE);
+        if(!done) break;
+
+        struct mca_part_persist_run_t *run = &req->runs[req->num_runs++];
+        run->hdr = req->ctrl_hdr;
+        run->ctrl_req = MPI_REQUEST_NULL;
+        if(req->real_dt_size == dt_size) {
+            err = MCA_PML_CALL(irecv(((char *) req->req_addr) + req->part_size * run->hdr.first,
+                                     req->real_count * run->hdr.count, req->req_datatype,
+                                     req->world_peer, req->my_send_tag + (int) run->hdr.first,
+                                     ompi_part_persist.part_comm, &run->data_req));
+        } else {
+            err = MCA_PML_CALL(irecv(((char *) req->req_addr) + req->part_size * run->hdr.first,
+                                     req->real_count * req->real_dt_size * run->hdr.count, MPI_BYTE,
+                                     req->world_peer, req->my_send_tag + (int) run->hdr.first,
+                                     ompi_part_persist.part_comm, &run->data_req));
+        }
+        if(OMPI_SUCCESS != err) return err;
+
+        req->announced += run->hdr.count;
+        if(req->announced < req->real_parts) {
+            err = MCA_PML_CALL(irecv(&req->ctrl_hdr, sizeof(struct mca_part_persist_run_hdr_t), MPI_BYTE,
+                                     req->world_peer, ctrl_tag, ompi_part_persist.part_comm,
+                                     &req->ctrl_req));
+            if(OMPI_SUCCESS != err) return err;
+        }
+    }
+    return OMPI_SUCCESS;
+}
+
+/**
+ * Test the runs in flight, and account for the partitions of the completed
+ * ones. On the receive side this is also where the arrival flags read by
+ * MPI_Parrived are raised.
+ */
+__opal_attribute_always_inline__ static inline void
+mca_part_persist_test_runs(struct mca_part_persist_request_t* req)
+{
+    bool prefix = true;
+
+    for(size_t r = req->first_pending_run; r < req->num_runs; r++) {
+        struct mca_part_persist_run_t *run = &req->runs[r];
+        int done = 0;
+
+        if(MPI_REQUEST_NULL == run->data_req) {
+            if(prefix) req->first_pending_run = r + 1;
+            continue;
+        }
+        if(MPI_REQUEST_NULL != run->ctrl_req) {
+            ompi_request_test(&run->ctrl_req, &done, MPI_STATUS_IGNORE);
+            if(!done) {
+                prefix = false;
+                continue;
+            }
+        }
+        ompi_request_test(&run->data_req, &done, MPI_STATUS_IGNORE);
+        if(!done) {
+            prefix = false;
+            continue;
+        }
+        if(MCA_PART_PERSIST_REQUEST_PRECV == req->req_type) {
+            for(size_t i = run->hdr.first; i < run->hdr.first + run->hdr.count; i++) {
+                req->flags[i] = 1;
+            }
+        }
+        req->done_count += run->hdr.count;
+        if(prefix) req->first_pending_run = r + 1;
+    }
+}
+
+/**
+ * Reset the state of the aggregated transport for a new epoch. On the
+ * receive side this posts the receive of the first control message.
+ */
+__opal_attribute_always_inline__ static inline int
+mca_part_persist_reset_runs(struct mca_part_persist_request_t* req)
+{
+    req->num_runs = 0;
+    req->first_pending_run = 0;
+    req->announced = 0;
+    req->done_count = 0;
+    if(MCA_PART_PERSIST_REQUEST_PSEND == req->req_type) {
+        memset(req->sent_map, 0, sizeof(uint64_t) * MCA_PART_PERSIST_MAP_WORDS(req->real_parts));
+        memset((void *) req->ready_map, 0, sizeof(uint64_t) * MCA_PART_PERSIST_MAP_WORDS(req->real_parts));
+        return OMPI_SUCCESS;
+    }
+    memset((void *) req->flags, 0, sizeof(int32_t) * req->real_parts);
+    return MCA_PML_CALL(irecv(&req->ctrl_hdr, sizeof(struct mca_part_persist_run_hdr_t), MPI_BYTE,
+                              req->world_peer, req->my_send_tag + (int) req->real_parts,
+                              ompi_part_persist.part_comm, &req->ctrl_req));
+}
+
 /**
  * mca_part_persist_progress is the progress function that will be registered. It handles 
  * both send and recv request testing and completion. It also handles freeing requests,
  * after MPI_Free is called and the requests have become inactive.
+ *
+ * Only the requests with work to do are looked at: they are handed over through the lock-free
+ * pending queue, and stay in the active list until they run out of work.
  */
 __opal_attribute_always_inline__ static inline int
 mca_part_persist_progress(void)
 {
-    mca_part_persist_list_t *current;
+    mca_part_persist_list_t *current, *next;
+    opal_list_item_t *item;
     int err;
     size_t i;
 
@@ -171,8 +464,6 @@ mca_part_persist_progress(void)
     }
 
     OPAL_THREAD_LOCK(&ompi_part_persist.lock);
- 
-    mca_part_persist_request_t* to_delete = NULL;
 
     /* Don't do anything till a function in the module is called. */
     if(-1 == ompi_part_persist.init_world)
@@ -217,8 +508,14 @@ mca_part_persist_progress(void)
         block_entry = opal_atomic_add_fetch_32(&(ompi_part_persist.block_entry), -1);
         return OMPI_SUCCESS;
     }
+    OPAL_THREAD_UNLOCK(&ompi_part_persist.lock);
+
+    /* Pick up the requests that got work since the last call */
+    while(NULL != (item = opal_fifo_pop_atomic(&ompi_part_persist.pending))) {
+        opal_list_append(&ompi_part_persist.active_list, item);
+    }
 
-    OPAL_LIST_FOREACH(current, ompi_part_persist.progress_list, mca_part_persist_list_t) {
+    OPAL_LIST_FOREACH_SAFE(current, next, &ompi_part_persist.active_list, mca_part_persist_list_t) {
         mca_part_persist_request_t *req = (mca_part_persist_request_t *) current->item;
 
         /* Check to see if request is initilaized */
@@ -245,6 +542,13 @@ mca_part_persist_progress(void)
                     dt_size = (dt_size_ > (size_t) UINT_MAX) ? MPI_UNDEFINED : (uint32_t) dt_size_;
                     uint32_t bytes = req->real_count * dt_size;
 
+                    if(req->aggregate) {
+                        /* Partitions marked ready so far go out at the next progress call */
+                        req->part_size = bytes;
+                        req->initialized = true;
+                        continue;
+                    }
+
                     /* Set up persistent sends */
                     req->persist_reqs = (ompi_request_t**) malloc(sizeof(ompi_request_t*)*(req->real_parts));
                     for(i = 0; i < req->real_parts; i++) {
@@ -259,6 +563,7 @@ mca_part_persist_progress(void)
                     req->real_parts   = req->setup_info[1].num_parts;
                     req->real_count   = req->setup_info[1].count;
                     req->real_dt_size = req->setup_info[1].dt_size;
+                    req->aggregate    = req->setup_info[1].aggregate;
 
 
                     err = opal_datatype_type_size(&(req->req_datatype->super), &dt_size_);
@@ -268,6 +573,26 @@ mca_part_persist_progress(void)
 
 
 
+                    mca_part_persist_channel_t *channel = NULL;
+                    if(!req->aggregate && 0 < ompi_part_persist.channel_cache_size) {
+                        channel = mca_part_persist_channel_take(MCA_PART_PERSIST_REQUEST_PRECV, NULL, req->world_peer,
+                                                                req->my_send_tag, req->real_parts, req->real_count,
+                                                                req->req_datatype);
+                    }
+
+                    if(NULL != channel && channel->addr == req->req_addr && channel->real_dt_size == req->real_dt_size) {
+                        /* Same buffer as the previous request on this channel */
+                        req->persist_reqs = channel->persist_reqs;
+                        channel->persist_reqs = NULL;
+                        req->flags = (int*) calloc(req->real_parts,sizeof(int));
+                        err = req->persist_reqs[0]->req_start(req->real_parts, (&(req->persist_reqs[0])));
+                    } else if(req->aggregate) {
+                        req->flags = (int*) calloc(req->real_parts,sizeof(int));
+                        req->runs = (struct mca_part_persist_run_t*) malloc(sizeof(struct mca_part_persist_run_t)*(req->real_parts));
+                        req->part_size = (req->real_dt_size == dt_size) ? bytes : req->real_count * req->real_dt_size;
+                        err = mca_part_persist_reset_runs(req);
+                    } else {
+
 		    /* Set up persistent sends */
                     req->persist_reqs = (ompi_request_t**) malloc(sizeof(ompi_request_t*)*(req->real_parts));
                     req->flags = (int*) calloc(req->real_parts,sizeof(int));
@@ -285,17 +610,40 @@ mca_part_persist_progress(void)
                         }
 		    }
                     err = req->persist_reqs[0]->req_start(req->real_parts, (&(req->persist_reqs[0])));                     
+                    }
+                    if(NULL != channel) OBJ_RELEASE(channel);
 
-                    /* Send back a message */
-                    req->setup_info[0].world_rank = ompi_part_persist.my_world_rank;
-                    err = MCA_PML_CALL(isend(&(req->setup_info[0]), sizeof(struct ompi_mca_persist_setup_t), MPI_BYTE, req->world_peer, req->my_recv_tag, MCA_PML_BASE_SEND_STANDARD, ompi_part_persist.part_comm_setup, &req->setup_req[0]));
-                    if(OMPI_SUCCESS != err) return OMPI_ERROR;
+                    /* Send back a message, unless the sender already knows us from a cached channel */
+                    if(!req->setup_info[1].reuse) {
+                        req->setup_info[0].world_rank = ompi_part_persist.my_world_rank;
+                        err = MCA_PML_CALL(isend(&(req->setup_info[0]), sizeof(struct ompi_mca_persist_setup_t), MPI_BYTE, req->world_peer, req->my_recv_tag, MCA_PML_BASE_SEND_STANDARD, ompi_part_persist.part_comm_setup, &req->setup_req[0]));
+                        if(OMPI_SUCCESS != err) return OMPI_ERROR;
+                    }
                 }
 
                 req->initialized = true; 
             }
         } else {
-            if(false == req->req_part_complete && REQUEST_COMPLETED != req->req_ompi.req_complete && OMPI_REQUEST_ACTIVE == req->req_ompi.req_state) {
+            if(false == req->req_part_complete && REQUEST_COMPLETED != req->req_ompi.req_complete && OMPI_REQUEST_ACTIVE == req->req_ompi.req_state && req->aggregate) {
+                if(MCA_PART_PERSIST_REQUEST_PSEND == req->req_type) {
+                    err = mca_part_persist_send_runs(req);
+                } else {
+                    size_t dt_size_;
+                    err = opal_datatype_type_size(&(req->req_datatype->super), &dt_size_);
+                    if(OMPI_SUCCESS == err) err = mca_part_persist_recv_runs(req, dt_size_);
+                }
+                if(OMPI_SUCCESS != err) {
+                    block_entry = opal_atomic_add_fetch_32(&(ompi_part_persist.block_entry), -1);
+                    return OMPI_ERROR;
+                }
+                mca_part_persist_test_runs(req);
+
+                if(req->done_count == req->real_parts)
+                {
+                    req->first_send = false;
+                    mca_part_persist_complete(req);
+                }
+            } else if(false == req->req_part_complete && REQUEST_COMPLETED != req->req_ompi.req_complete && OMPI_REQUEST_ACTIVE == req->req_ompi.req_state) {
                for(i = 0; i < req->real_parts; i++) {
 
                     /* Check to see if partition is queued for being started. Only applicable to sends. */ 
@@ -320,19 +668,29 @@ mca_part_persist_progress(void)
             }
 
             if(true == req->req_free_called && true == req->req_part_complete && REQUEST_COMPLETED == req->req_ompi.req_complete &&  OMPI_REQUEST_INACTIVE == req->req_ompi.req_state) {
-                to_delete = req;
+                opal_list_remove_item(&ompi_part_persist.active_list, (opal_list_item_t*)current);
+                err = mca_part_persist_free_req(req);
+                if(OMPI_SUCCESS != err) {
+                    block_entry = opal_atomic_add_fetch_32(&(ompi_part_persist.block_entry), -1);
+                    return OMPI_ERROR;
+                }
+                continue;
             }
         }
 
-    }
-    OPAL_THREAD_UNLOCK(&ompi_part_persist.lock);
-    block_entry = opal_atomic_add_fetch_32(&(ompi_part_persist.block_entry), -1);
-    if(to_delete) {
-        err =  mca_part_persist_free_req(to_delete);
-        if (OMPI_SUCCESS != err) {
-            return OMPI_ERROR;
+        /* Retire the request once it runs out of work. A thread handing it new work in the
+         * meantime either found it still queued, and the check below sees the new work, or
+         * queues it again itself. */
+        if(!mca_part_persist_has_work(req)) {
+            opal_list_remove_item(&ompi_part_persist.active_list, (opal_list_item_t*)current);
+            req->queued = 0;
+            opal_atomic_mb();
+            if(mca_part_persist_has_work(req)) {
+                mca_part_persist_enqueue(req);
+            }
         }
     }
+    block_entry = opal_atomic_add_fetch_32(&(ompi_part_persist.block_entry), -1);
 
     return OMPI_SUCCESS;
 }
@@ -375,6 +733,12 @@ mca_part_persist_precv_init(void *buf,
     req->first_send  = true; 
     req->flag_post_setup_recv = false;
     req->flags = NULL;
+    req->persist_reqs = NULL;
+    req->aggregate = false;
+    req->ready_map = NULL;
+    req->sent_map = NULL;
+    req->runs = NULL;
+    req->ctrl_req = MPI_REQUEST_NULL;
     /* Non-blocking receive on setup info */
     err	= MCA_PML_CALL(irecv(&req->setup_info[1], sizeof(struct ompi_mca_persist_setup_t), MPI_BYTE, src, tag, comm, &req->setup_req[1])); 
     if(OMPI_SUCCESS != err) return OMPI_ERROR;
@@ -398,6 +762,11 @@ mca_part_persist_precv_init(void *buf,
     OPAL_THREAD_LOCK(&ompi_part_persist.lock);
     opal_list_append(ompi_part_persist.progress_list, (opal_list_item_t*)new_progress_elem);
     OPAL_THREAD_UNLOCK(&ompi_part_persist.lock);
+    req->pending_elem = OBJ_NEW(mca_part_persist_list_t);
+    req->pending_elem->item = req;
+    req->queued = 0;
+    req->ready_count = 0;
+    mca_part_persist_enqueue(req);
 
     /* set return values */
     *request = (ompi_request_t*) recvreq;
@@ -420,6 +789,7 @@ mca_part_persist_psend_init(const void* buf,
     uint32_t dt_size;
     mca_part_persist_list_t* new_progress_elem = NULL;
     mca_part_persist_psend_request_t *sendreq;
+    mca_part_persist_channel_t *channel = NULL;
 
     /* if module hasn't been called before, flag module to init. */
     if(-1 == ompi_part_persist.init_world)
@@ -445,11 +815,27 @@ mca_part_persist_psend_init(const void* buf,
     dt_size = (dt_size_ > (size_t) UINT_MAX) ? MPI_UNDEFINED : (uint32_t) dt_size_;
     req->req_bytes = parts * count * dt_size;
 
+    /* A channel left by a previous request with the same signature saves the handshake */
+    if(0 < ompi_part_persist.channel_cache_size) {
+        channel = mca_part_persist_channel_take(MCA_PART_PERSIST_REQUEST_PSEND, comm, dst, tag, parts, count, datatype);
+    }
+
     /* non-blocking send set-up data */
     req->setup_info[0].world_rank = ompi_comm_rank(&ompi_mpi_comm_world.comm);
-    req->setup_info[0].start_tag = ompi_part_persist.next_send_tag; ompi_part_persist.next_send_tag += parts; 
+    req->aggregate = ompi_part_persist.aggregate;
+    req->setup_info[0].aggregate = req->aggregate;
+    if(NULL != channel) {
+        req->setup_info[0].start_tag = channel->send_tag;
+        req->setup_info[0].setup_tag = channel->recv_tag;
+        req->setup_info[0].reuse = 1;
+    } else {
+        req->setup_info[0].start_tag = ompi_part_persist.next_send_tag; ompi_part_persist.next_send_tag += parts; 
+        /* The aggregated transport uses one more tag, for the control messages */
+        if(req->aggregate) ompi_part_persist.next_send_tag++;
+        req->setup_info[0].setup_tag = ompi_part_persist.next_recv_tag; ompi_part_persist.next_recv_tag++;
+        req->setup_info[0].reuse = 0;
+    }
     req->my_send_tag = req->setup_info[0].start_tag;
-    req->setup_info[0].setup_tag = ompi_part_persist.next_recv_tag; ompi_part_persist.next_recv_tag++;
     req->my_recv_tag = req->setup_info[0].setup_tag;
     req->setup_info[0].num_parts = parts;
     req->real_parts = parts;
@@ -458,12 +844,43 @@ mca_part_persist_psend_init(const void* buf,
     req->setup_info[0].dt_size = dt_size;
 
     req->flags = (int*) calloc(req->real_parts, sizeof(int));
+    req->persist_reqs = NULL;
+    req->ready_map = NULL;
+    req->sent_map = NULL;
+    req->runs = NULL;
+    req->ctrl_req = MPI_REQUEST_NULL;
+    if(req->aggregate) {
+        req->ready_map = (opal_atomic_int64_t*) calloc(MCA_PART_PERSIST_MAP_WORDS(parts), sizeof(uint64_t));
+        req->sent_map = (uint64_t*) calloc(MCA_PART_PERSIST_MAP_WORDS(parts), sizeof(uint64_t));
+        req->runs = (struct mca_part_persist_run_t*) malloc(sizeof(struct mca_part_persist_run_t) * parts);
+        if(NULL == req->ready_map || NULL == req->sent_map || NULL == req->runs) return OMPI_ERR_OUT_OF_RESOURCE;
+    }
 
     err = MCA_PML_CALL(isend(&(req->setup_info[0]), sizeof(struct ompi_mca_persist_setup_t), MPI_BYTE, dst, tag, MCA_PML_BASE_SEND_STANDARD, comm, &req->setup_req[0]));
     if(OMPI_SUCCESS != err) return OMPI_ERROR;
 
-    /* Non-blocking receive on setup info */
-    if(1 == ompi_part_persist.init_comms) {
+    if(NULL != channel) {
+        /* The peer is known and the back end communicators exist: no reply to wait for */
+        req->world_peer = channel->world_peer;
+        req->part_size = req->real_count * dt_size;
+        req->setup_req[1] = MPI_REQUEST_NULL;
+        req->flag_post_setup_recv = false;
+        if(!req->aggregate) {
+            if(channel->addr == buf && NULL != channel->persist_reqs) {
+                req->persist_reqs = channel->persist_reqs;
+                channel->persist_reqs = NULL;
+            } else {
+                req->persist_reqs = (ompi_request_t**) malloc(sizeof(ompi_request_t*)*(req->real_parts));
+                for(size_t i = 0; i < req->real_parts; i++) {
+                    void *part_buf = ((void*) (((char*)req->req_addr) + (req->part_size * i)));
+                    err = MCA_PML_CALL(isend_init(part_buf, req->real_count, req->req_datatype, req->world_peer, req->my_send_tag+i, MCA_PML_BASE_SEND_STANDARD, ompi_part_persist.part_comm, &(req->persist_reqs[i])));
+                }
+            }
+        }
+        OBJ_RELEASE(channel);
+        req->initialized = true;
+    } else if(1 == ompi_part_persist.init_comms) {
+        /* Non-blocking receive on setup info */
         err = MCA_PML_CALL(irecv(&(req->setup_info[1]), sizeof(struct ompi_mca_persist_setup_t), MPI_BYTE, MPI_ANY_SOURCE, req->my_recv_tag, ompi_part_persist.part_comm_setup, &req->setup_req[1]));
         if(OMPI_SUCCESS != err) return OMPI_ERROR;
         req->flag_post_setup_recv = false;
@@ -484,6 +901,11 @@ mca_part_persist_psend_init(const void* buf,
     OPAL_THREAD_LOCK(&ompi_part_persist.lock);
     opal_list_append(ompi_part_persist.progress_list, (opal_list_item_t*)new_progress_elem);
     OPAL_THREAD_UNLOCK(&ompi_part_persist.lock);
+    req->pending_elem = OBJ_NEW(mca_part_persist_list_t);
+    req->pending_elem->item = req;
+    req->queued = 0;
+    req->ready_count = 0;
+    mca_part_persist_enqueue(req);
 
     /* Set return values */
     *request = (ompi_request_t*) sendreq;
@@ -500,7 +922,13 @@ mca_part_persist_start(size_t count, ompi_request_t** requests)
     for(i = 0; i < _count && OMPI_SUCCESS == err; i++) {
         mca_part_persist_request_t *req = (mca_part_persist_request_t *)(requests[i]);
         /* First use is a special case, to support lazy initialization */
-        if(false == req->first_send)
+        if(req->aggregate)
+        {
+            /* The receive side posts its first control receive at set-up */
+            if(false == req->first_send || MCA_PART_PERSIST_REQUEST_PSEND == req->req_type) {
+                err = mca_part_persist_reset_runs(req);
+            }
+        } else if(false == req->first_send)
         {
             if(MCA_PART_PERSIST_REQUEST_PSEND == req->req_type) {
                 req->done_count = 0;
@@ -524,9 +952,11 @@ mca_part_persist_start(size_t count, ompi_request_t** requests)
         req->req_ompi.req_status.MPI_TAG = MPI_ANY_TAG;
         req->req_ompi.req_status.MPI_ERROR = OMPI_SUCCESS;
         req->req_ompi.req_status._cancelled = 0;
+        req->ready_count = 0;
         req->req_part_complete = false;
         req->req_ompi.req_complete = false;
         OPAL_ATOMIC_SWAP_PTR(&req->req_ompi.req_complete, REQUEST_PENDING);   
+        mca_part_persist_enqueue(req);
     }
 
     return err;
@@ -541,7 +971,12 @@ mca_part_persist_pready(size_t min_part,
     size_t i;
 
     mca_part_persist_request_t *req = (mca_part_persist_request_t *)(request);
-    if(true == req->initialized)
+    if(req->aggregate)
+    {
+        /* Picked up by the progress engine, whether the request is set up or not */
+        mca_part_persist_mark_ready(req, min_part, max_part);
+    }
+    else if(true == req->initialized)
     {
         err = req->persist_reqs[min_part]->req_start(max_part-min_part+1, (&(req->persist_reqs[min_part])));
         for(i = min_part; i <= max_part && OMPI_SUCCESS == err; i++) {
@@ -554,6 +989,10 @@ mca_part_persist_pready(size_t min_part,
             req->flags[i] = -2; /* Mark partition as queued */
         }
     }
+
+    /* The progress engine only looks at the send while fewer partitions completed than got ready */
+    (void) opal_atomic_add_fetch_32(&req->ready_count, (int32_t) (max_part - min_part + 1));
+    mca_part_persist_enqueue(req);
     return err;
 }
 
@@ -603,6 +1042,7 @@ mca_part_persist_free(ompi_request_t** request)
 
     if(true == req->req_free_called) return OMPI_ERROR;
     req->req_free_called = true;
+    mca_part_persist_enqueue(req);
 
     *request = MPI_REQUEST_NULL;
     return OMPI_SUCCESS;
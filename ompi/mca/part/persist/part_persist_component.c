@@ -21,6 +21,8 @@
 
 #include "ompi_config.h"
 
+#include "ompi/instance/instance.h"
+
 #include "ompi/mca/part/persist/part_persist.h"
 
 #include "ompi/mca/part/persist/part_persist_sendreq.h"
@@ -85,6 +87,25 @@ mca_part_persist_component_register(void)
                                            MCA_BASE_VAR_SCOPE_READONLY,
                                            &ompi_part_persist.free_list_inc);
 
+    ompi_part_persist.aggregate = false;
+    (void) mca_base_component_var_register(&mca_part_persist_component.partm_version, "aggregate",
+                                           "Send the contiguous ready partitions of a request in as few "
+                                           "messages as possible, instead of using one persistent send "
+                                           "per partition (selected by the sender)",
+                                           MCA_BASE_VAR_TYPE_BOOL, NULL, 0, 0,
+                                           OPAL_INFO_LVL_5,
+                                           MCA_BASE_VAR_SCOPE_READONLY,
+                                           &ompi_part_persist.aggregate);
+
+    ompi_part_persist.channel_cache_size = 0;
+    (void) mca_base_component_var_register(&mca_part_persist_component.partm_version, "channel_cache_size",
+                                           "Number of channels of freed requests kept to set up new requests "
+                                           "with the same peer, tag, count and datatype without the set-up "
+                                           "handshake (0 disables the cache)",
+                                           MCA_BASE_VAR_TYPE_INT, NULL, 0, 0,
+                                           OPAL_INFO_LVL_5,
+                                           MCA_BASE_VAR_SCOPE_READONLY,
+                                           &ompi_part_persist.channel_cache_size);
 
     return OPAL_SUCCESS;
 }
@@ -113,6 +134,10 @@ mca_part_persist_component_open(void)
 static int
 mca_part_persist_component_close(void)
 {
+    mca_part_persist_channel_flush();
+    OBJ_DESTRUCT(&ompi_part_persist.channel_cache);
+    OBJ_DESTRUCT(&ompi_part_persist.active_list);
+    OBJ_DESTRUCT(&ompi_part_persist.pending);
     OBJ_DESTRUCT(&ompi_part_persist.lock);
     return OMPI_SUCCESS; 
 }
@@ -125,6 +150,10 @@ mca_part_persist_component_init(int* priority,
 {
     *priority = 1;
 
+    /* Cached channels hold persistent requests on part_comm: release them before the
+     * communicators are torn down */
+    ompi_mpi_instance_append_finalize (mca_part_persist_channel_flush);
+
     opal_output_verbose( 10, 0,
                          "in persist part priority is %d\n", *priority);
 
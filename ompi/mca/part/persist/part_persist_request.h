@@ -39,11 +39,29 @@ struct ompi_mca_persist_setup_t {
    int world_rank;
    int start_tag;
    int setup_tag;
+   int aggregate;                        /**< the sender uses the aggregated transport */
+   int reuse;                            /**< the sender reuses a cached channel, no reply expected */
    size_t num_parts;
    size_t dt_size;
    size_t count;
 };
 
+/**
+ * Aggregated transport: the partitions are sent in runs of contiguous
+ * ready partitions. Each run is announced by a control message carrying
+ * this header, and its data is sent with the tag of its first partition.
+ */
+struct mca_part_persist_run_hdr_t {
+    uint64_t first;                       /**< first partition of the run */
+    uint64_t count;                       /**< number of partitions in the run */
+};
+
+struct mca_part_persist_run_t {
+    struct mca_part_persist_run_hdr_t hdr;
+    ompi_request_t *ctrl_req;             /**< control message (send side only) */
+    ompi_request_t *data_req;             /**< data of the run, MPI_REQUEST_NULL once completed */
+};
+
 
 /**
  *  Base type for PART PERSIST requests
@@ -94,9 +112,22 @@ struct mca_part_persist_request_t {
 
     int32_t *flags;               /**< array of flags to determine whether a partition has arrived */
 
+    int32_t aggregate;                    /**< partitions are sent in runs instead of one request each */
+    opal_atomic_int64_t *ready_map;       /**< bitmap of the partitions marked ready by MPI_Pready */
+    uint64_t *sent_map;                   /**< bitmap of the partitions handed to the PML */
+    struct mca_part_persist_run_t *runs;  /**< runs of partitions posted during this epoch */
+    size_t num_runs;                      /**< number of runs posted during this epoch */
+    size_t first_pending_run;             /**< all the runs before this one are completed */
+    size_t announced;                     /**< partitions announced by control messages (recv side) */
+    struct mca_part_persist_run_hdr_t ctrl_hdr; /**< buffer for the incoming control messages */
+    ompi_request_t *ctrl_req;             /**< receive of the next control message */
+
     struct ompi_mca_persist_setup_t setup_info[2]; /**< Setup info to send during initialization. */
   
     struct mca_part_persist_list_t* progress_elem; /**< pointer to progress list element for removal during free. */ 
+    struct mca_part_persist_list_t* pending_elem;  /**< element queued to the progress engine when the request has work. */
+    opal_atomic_int32_t queued;           /**< pending_elem is in the pending queue or in the active list */
+    opal_atomic_int32_t ready_count;      /**< number of partitions marked ready during this epoch */
 
 };
 typedef struct mca_part_persist_request_t mca_part_persist_request_t;
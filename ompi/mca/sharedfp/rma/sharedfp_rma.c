@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * These symbols are in a file by themselves to provide nice linker
+ * semantics. Since linkers generally pull in symbols by object fules,
+ * keeping these symbols as the only symbols in this file prevents
+ * utility programs such as "ompi_info" from having to import entire
+ * modules just to query their version and parameters
+ */
+
+#include "ompi_config.h"
+#include "mpi.h"
+#include "ompi/communicator/communicator.h"
+#include "ompi/mca/sharedfp/sharedfp.h"
+#include "ompi/mca/sharedfp/base/base.h"
+#include "ompi/mca/sharedfp/rma/sharedfp_rma.h"
+
+/*
+ * *******************************************************************
+ * ************************ actions structure ************************
+ * *******************************************************************
+ */
+ /* IMPORTANT: Update here when adding sharedfp component interface functions*/
+static mca_sharedfp_base_module_2_0_0_t rma =  {
+    mca_sharedfp_rma_module_init, /* initialise after being selected */
+    mca_sharedfp_rma_module_finalize, /* close a module on a communicator */
+    mca_sharedfp_rma_seek,
+    mca_sharedfp_rma_get_position,
+    mca_sharedfp_rma_read,
+    mca_sharedfp_rma_read_ordered,
+    mca_sharedfp_rma_read_ordered_begin,
+    mca_sharedfp_rma_read_ordered_end,
+    mca_sharedfp_rma_iread,
+    mca_sharedfp_rma_write,
+    mca_sharedfp_rma_write_ordered,
+    mca_sharedfp_rma_write_ordered_begin,
+    mca_sharedfp_rma_write_ordered_end,
+    mca_sharedfp_rma_iwrite,
+    mca_sharedfp_rma_file_open,
+    mca_sharedfp_rma_file_close
+};
+/*
+ * *******************************************************************
+ * ************************* structure ends **************************
+ * *******************************************************************
+ */
+
+int mca_sharedfp_rma_component_init_query(bool enable_progress_threads,
+                                          bool enable_mpi_threads)
+{
+    /* Nothing to do */
+
+    return OMPI_SUCCESS;
+}
+
+struct mca_sharedfp_base_module_2_0_0_t * mca_sharedfp_rma_component_file_query(ompio_file_t *fh, int *priority)
+{
+    *priority = 0;
+
+    /* The shared file pointer is kept in an MPI window on rank 0 of the
+    ** file communicator, and updated with atomic fetch-and-op operations.
+    ** This works across nodes without any support from the file system,
+    ** the only requirement is an osc component able to create the window.
+    */
+    if ( OMPI_COMM_IS_INTER(fh->f_comm) ) {
+        opal_output_verbose(10, ompi_sharedfp_base_framework.framework_output,
+                            "mca_sharedfp_rma_component_file_query: Disqualifying myself: "
+                            "inter-communicators are not supported.");
+        return NULL;
+    }
+
+    /* This module can run */
+    *priority = mca_sharedfp_rma_priority;
+    return &rma;
+}
+
+int mca_sharedfp_rma_component_file_unquery (ompio_file_t *file)
+{
+    /* This function might be needed for some purposes later. for now it
+    * does not have anything to do since there are no steps which need
+    * to be undone if this module is not selected */
+
+    return OMPI_SUCCESS;
+}
+
+int mca_sharedfp_rma_module_init (ompio_file_t *file)
+{
+    return OMPI_SUCCESS;
+}
+
+
+int mca_sharedfp_rma_module_finalize (ompio_file_t *file)
+{
+    return OMPI_SUCCESS;
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+#ifndef MCA_SHAREDFP_RMA_H
+#define MCA_SHAREDFP_RMA_H
+
+#include "ompi_config.h"
+#include "ompi/mca/mca.h"
+#include "ompi/mca/sharedfp/sharedfp.h"
+#include "ompi/mca/common/ompio/common_ompio.h"
+
+
+BEGIN_C_DECLS
+
+int mca_sharedfp_rma_component_init_query(bool enable_progress_threads,
+                                          bool enable_mpi_threads);
+struct mca_sharedfp_base_module_2_0_0_t *
+        mca_sharedfp_rma_component_file_query (ompio_file_t *file, int *priority);
+int mca_sharedfp_rma_component_file_unquery (ompio_file_t *file);
+
+int mca_sharedfp_rma_module_init (ompio_file_t *file);
+int mca_sharedfp_rma_module_finalize (ompio_file_t *file);
+
+extern int mca_sharedfp_rma_priority;
+extern int mca_sharedfp_rma_verbose;
+
+OMPI_DECLSPEC extern mca_sharedfp_base_component_3_0_0_t mca_sharedfp_rma_component;
+/*
+ * ******************************************************************
+ * ********* functions which are implemented in this module *********
+ * ******************************************************************
+ */
+/*IMPORANT: Update here when implementing functions from sharedfp API*/
+
+int mca_sharedfp_rma_seek (ompio_file_t *fh,
+                           OMPI_MPI_OFFSET_TYPE offset, int whence);
+int mca_sharedfp_rma_get_position (ompio_file_t *fh,
+                                   OMPI_MPI_OFFSET_TYPE * offset);
+int mca_sharedfp_rma_file_open (struct ompi_communicator_t *comm,
+                                const char* filename,
+                                int amode,
+                                struct opal_info_t *info,
+                                ompio_file_t *fh);
+int mca_sharedfp_rma_file_close (ompio_file_t *fh);
+int mca_sharedfp_rma_read (ompio_file_t *fh,
+                           void *buf, size_t count, MPI_Datatype datatype, MPI_Status *status);
+int mca_sharedfp_rma_read_ordered (ompio_file_t *fh,
+                                   void *buf, size_t count, struct ompi_datatype_t *datatype,
+                                   ompi_status_public_t *status
+                                   );
+int mca_sharedfp_rma_read_ordered_begin (ompio_file_t *fh,
+                                                 void *buf,
+                                                 size_t count,
+                                                 struct ompi_datatype_t *datatype);
+int mca_sharedfp_rma_read_ordered_end (ompio_file_t *fh,
+                                               void *buf,
+                                               ompi_status_public_t *status);
+int mca_sharedfp_rma_iread (ompio_file_t *fh,
+                                    void *buf,
+                                    size_t count,
+                                    struct ompi_datatype_t *datatype,
+                                    ompi_request_t **request);
+int mca_sharedfp_rma_write (ompio_file_t *fh,
+                            const void *buf,
+                            size_t count,
+                            struct ompi_datatype_t *datatype,
+                            ompi_status_public_t *status);
+int mca_sharedfp_rma_write_ordered (ompio_file_t *fh,
+                                    const void *buf,
+                                    size_t count,
+                                    struct ompi_datatype_t *datatype,
+                                    ompi_status_public_t *status);
+int mca_sharedfp_rma_write_ordered_begin (ompio_file_t *fh,
+                                          const void *buf,
+                                          size_t count,
+                                          struct ompi_datatype_t *datatype);
+int mca_sharedfp_rma_write_ordered_end (ompio_file_t *fh,
+                                        const void *buf,
+                                        ompi_status_public_t *status);
+int mca_sharedfp_rma_iwrite (ompio_file_t *fh,
+                             const void *buf,
+                             size_t count,
+                             struct ompi_datatype_t *datatype,
+                             ompi_request_t **request);
+
+/*--------------------------------------------------------------*
+ *Structures and definitions only for this component
+ *--------------------------------------------------------------*/
+
+/*This structure will hang off of the mca_sharedfp_base_data_t's
+ *selected_module_data attribute
+ */
+struct mca_sharedfp_rma_data
+{
+    /* window exposing the shared file pointer, which is located on
+       rank 0 of the file communicator */
+    struct ompi_win_t *win;
+    OMPI_MPI_OFFSET_TYPE *base;
+};
+
+typedef struct mca_sharedfp_rma_data rma_data_global;
+
+
+int mca_sharedfp_rma_request_position (struct mca_sharedfp_base_data_t * sh,
+                                       long long bytes_requested,
+                                       OMPI_MPI_OFFSET_TYPE * offset);
+/*
+ * ******************************************************************
+ * ************ functions implemented in this module end ************
+ * ******************************************************************
+ */
+
+END_C_DECLS
+
+#endif /* MCA_SHAREDFP_RMA_H */
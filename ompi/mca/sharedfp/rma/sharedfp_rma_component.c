@@ -0,0 +1,84 @@
+/* -*- Mode: C; c-basic-offset:4 ; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * These symbols are in a file by themselves to provide nice linker
+ * semantics.  Since linkers generally pull in symbols by object
+ * files, keeping these symbols as the only symbols in this file
+ * prevents utility programs such as "ompi_info" from having to import
+ * entire components just to query their version and parameters.
+ */
+
+#include "ompi_config.h"
+#include "sharedfp_rma.h"
+#include "mpi.h"
+
+/*
+ * Public string showing the sharedfp rma component version number
+ */
+const char *mca_sharedfp_rma_component_version_string =
+  "OMPI/MPI rma SHAREDFP MCA component version " OMPI_VERSION;
+/*
+ * Global variables
+ */
+int mca_sharedfp_rma_priority=5;
+int mca_sharedfp_rma_verbose=0;
+
+static int rma_register(void);
+
+/*
+ * Instantiate the public struct with all of our public information
+ * and pointers to our public functions in it
+ */
+mca_sharedfp_base_component_3_0_0_t mca_sharedfp_rma_component = {
+
+    /* First, the mca_component_t struct containing meta information
+       about the component itself */
+
+    .sharedfpm_version = {
+        MCA_SHAREDFP_BASE_VERSION_3_0_0,
+
+        /* Component name and version */
+        .mca_component_name = "rma",
+        MCA_BASE_MAKE_VERSION(component, OMPI_MAJOR_VERSION, OMPI_MINOR_VERSION,
+                              OMPI_RELEASE_VERSION),
+        .mca_register_component_params = rma_register,
+    },
+    .sharedfpm_data = {
+        /* This component is checkpointable */
+      MCA_BASE_METADATA_PARAM_CHECKPOINT
+    },
+    .sharedfpm_init_query = mca_sharedfp_rma_component_init_query,      /* get thread level */
+    .sharedfpm_file_query = mca_sharedfp_rma_component_file_query,      /* get priority and actions */
+    .sharedfpm_file_unquery = mca_sharedfp_rma_component_file_unquery,  /* undo what was done by previous function */
+};
+MCA_BASE_COMPONENT_INIT(ompi, sharedfp, rma)
+
+static int rma_register(void)
+{
+    /* Below lockedfile and individual: the component is only used when
+    ** asked for, or when nothing else can serve the file.
+    */
+    mca_sharedfp_rma_priority = 5;
+    (void) mca_base_component_var_register(&mca_sharedfp_rma_component.sharedfpm_version,
+                                           "priority", "Priority of the rma sharedfp component "
+                                           "(set it above 10 to prefer it over lockedfile and individual)",
+                                           MCA_BASE_VAR_TYPE_INT, NULL, 0, 0,
+                                           OPAL_INFO_LVL_9,
+                                           MCA_BASE_VAR_SCOPE_READONLY, &mca_sharedfp_rma_priority);
+    mca_sharedfp_rma_verbose = 0;
+    (void) mca_base_component_var_register(&mca_sharedfp_rma_component.sharedfpm_version,
+                                           "verbose", "Verbosity of the rma sharedfp component",
+                                           MCA_BASE_VAR_TYPE_INT, NULL, 0, 0,
+                                           OPAL_INFO_LVL_9,
+                                           MCA_BASE_VAR_SCOPE_READONLY, &mca_sharedfp_rma_verbose);
+
+    return OMPI_SUCCESS;
+}
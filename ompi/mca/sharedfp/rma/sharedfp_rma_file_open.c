@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+
+#include "ompi_config.h"
+#include "sharedfp_rma.h"
+
+#include "mpi.h"
+#include "opal/util/output.h"
+#include "ompi/constants.h"
+#include "ompi/info/info.h"
+#include "ompi/win/win.h"
+#include "ompi/mca/osc/osc.h"
+#include "ompi/mca/sharedfp/sharedfp.h"
+#include "ompi/mca/sharedfp/base/base.h"
+
+int mca_sharedfp_rma_file_open (struct ompi_communicator_t *comm,
+                                const char* filename,
+                                int amode,
+                                struct opal_info_t *info,
+                                ompio_file_t *fh)
+{
+    int err = OMPI_SUCCESS;
+    struct mca_sharedfp_base_data_t* sh;
+    struct mca_sharedfp_rma_data * rma_data = NULL;
+    size_t win_size;
+
+    /*Memory is allocated here for the sh structure*/
+    if ( mca_sharedfp_rma_verbose ) {
+        opal_output(ompi_sharedfp_base_framework.framework_output,
+                    "mca_sharedfp_rma_file_open: malloc f_sharedfp_ptr struct\n");
+    }
+
+    sh = (struct mca_sharedfp_base_data_t*)malloc(sizeof(struct mca_sharedfp_base_data_t));
+    if ( NULL == sh ) {
+        opal_output(0, "mca_sharedfp_rma_file_open: Error, unable to malloc f_sharedfp struct\n");
+        return OMPI_ERR_OUT_OF_RESOURCE;
+    }
+
+    /*Populate the sh file structure based on the implementation*/
+    sh->global_offset = 0;                        /* Global Offset*/
+    sh->selected_module_data = NULL;
+
+    rma_data = (struct mca_sharedfp_rma_data*) malloc ( sizeof(struct mca_sharedfp_rma_data));
+    if ( NULL == rma_data ){
+        opal_output(0, "mca_sharedfp_rma_file_open: Error, unable to malloc rma_data struct\n");
+        free(sh);
+        return OMPI_ERR_OUT_OF_RESOURCE;
+    }
+    rma_data->win  = NULL;
+    rma_data->base = NULL;
+
+    /* Only rank 0 exposes memory: it holds the shared file pointer. */
+    win_size = ( 0 == fh->f_rank ) ? sizeof(OMPI_MPI_OFFSET_TYPE) : 0;
+    err = ompi_win_allocate ( win_size, sizeof(OMPI_MPI_OFFSET_TYPE), &(MPI_INFO_NULL->super),
+                              comm, &rma_data->base, &rma_data->win );
+    if ( OMPI_SUCCESS != err ) {
+        /* No osc component can serve this communicator. Open the file without
+        ** a shared file pointer, as if no sharedfp component had been selected:
+        ** only the shared file pointer operations will return an error.
+        */
+        opal_output_verbose(10, ompi_sharedfp_base_framework.framework_output,
+                            "mca_sharedfp_rma_file_open: unable to allocate the window, "
+                            "shared file pointer operations are disabled on this file");
+        free(rma_data);
+        free(sh);
+        fh->f_sharedfp = NULL;
+        return OMPI_SUCCESS;
+    }
+
+    if ( 0 == fh->f_rank ) {
+        *rma_data->base = 0;
+    }
+
+    /* All the accesses to the shared file pointer happen in a single
+    ** passive target epoch which lasts until the file is closed.
+    */
+    err = rma_data->win->w_osc_module->osc_lock_all ( MPI_MODE_NOCHECK, rma_data->win );
+    if ( OMPI_SUCCESS != err ) {
+        opal_output(0, "mca_sharedfp_rma_file_open: Error, unable to start the access epoch\n");
+        ompi_win_free(rma_data->win);
+        free(rma_data);
+        free(sh);
+        return err;
+    }
+
+    sh->selected_module_data = rma_data;
+    fh->f_sharedfp_data = sh;
+
+    /* The initial value has to be in place before anybody modifies it */
+    err = comm->c_coll->coll_barrier (comm, comm->c_coll->coll_barrier_module );
+    if ( OMPI_SUCCESS != err ) {
+        opal_output(0,"mca_sharedfp_rma_file_open: Error in barrier operation \n");
+    }
+
+    return err;
+}
+
+int mca_sharedfp_rma_file_close (ompio_file_t *fh)
+{
+    int err = OMPI_SUCCESS;
+    /*sharedfp data structure*/
+    struct mca_sharedfp_base_data_t *sh=NULL;
+    /*sharedfp rma module data structure*/
+    struct mca_sharedfp_rma_data * file_data=NULL;
+
+    if( NULL == fh->f_sharedfp_data ){
+        return OMPI_SUCCESS;
+    }
+    sh = fh->f_sharedfp_data;
+
+    file_data = (rma_data_global*)(sh->selected_module_data);
+    if (file_data)  {
+        if ( NULL != file_data->win ) {
+            file_data->win->w_osc_module->osc_unlock_all ( file_data->win );
+            /* window free is collective, and synchronizes all processes */
+            err = ompi_win_free ( file_data->win );
+        }
+        free(file_data);
+    }
+
+    /*free shared file pointer data struct*/
+    free(sh);
+    fh->f_sharedfp_data = NULL;
+
+    return err;
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+
+#include "ompi_config.h"
+#include "sharedfp_rma.h"
+
+#include "mpi.h"
+#include "ompi/constants.h"
+#include "ompi/win/win.h"
+#include "ompi/mca/osc/osc.h"
+#include "ompi/mca/sharedfp/sharedfp.h"
+#include "ompi/mca/sharedfp/base/base.h"
+
+int mca_sharedfp_rma_request_position(struct mca_sharedfp_base_data_t * sh,
+                                      long long bytes_requested,
+                                      OMPI_MPI_OFFSET_TYPE *offset)
+{
+    int ret = OMPI_SUCCESS;
+    OMPI_MPI_OFFSET_TYPE increment = (OMPI_MPI_OFFSET_TYPE) bytes_requested;
+    OMPI_MPI_OFFSET_TYPE old_offset = 0;
+    struct mca_sharedfp_rma_data * rma_data = sh->selected_module_data;
+    ompi_win_t *win = rma_data->win;
+
+    *offset = 0;
+
+    /* A single atomic operation both reads the current position and
+    ** reserves bytes_requested bytes. A request for 0 bytes does not
+    ** modify the position.
+    */
+    ret = win->w_osc_module->osc_fetch_and_op ( &increment, &old_offset, OMPI_OFFSET_DATATYPE,
+                                                0, 0, 0 == increment ? MPI_NO_OP : MPI_SUM, win );
+    if ( OMPI_SUCCESS != ret ) {
+        opal_output(0,"sharedfp_rma_request_position: error in fetch_and_op %d\n", ret);
+        return ret;
+    }
+    ret = win->w_osc_module->osc_flush ( 0, win );
+    if ( OMPI_SUCCESS != ret ) {
+        opal_output(0,"sharedfp_rma_request_position: error in flush %d\n", ret);
+        return ret;
+    }
+
+    if ( mca_sharedfp_rma_verbose ) {
+        opal_output(ompi_sharedfp_base_framework.framework_output,
+                    "sharedfp_rma_request_position: old_offset=%lld, bytes_requested=%lld, new offset=%lld!\n",
+                    old_offset, bytes_requested, old_offset + increment);
+    }
+
+    *offset = old_offset;
+
+    return ret;
+}
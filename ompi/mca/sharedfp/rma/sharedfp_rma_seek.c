@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+
+#include "ompi_config.h"
+#include "sharedfp_rma.h"
+
+#include "mpi.h"
+#include "ompi/constants.h"
+#include "ompi/win/win.h"
+#include "ompi/mca/osc/osc.h"
+#include "ompi/mca/sharedfp/sharedfp.h"
+#include "ompi/mca/sharedfp/base/base.h"
+
+int
+mca_sharedfp_rma_seek (ompio_file_t *fh,
+                       OMPI_MPI_OFFSET_TYPE off, int whence)
+{
+    int ret = OMPI_SUCCESS;
+    struct mca_sharedfp_base_data_t *sh = NULL;
+    struct mca_sharedfp_rma_data * rma_data;
+    OMPI_MPI_OFFSET_TYPE offset, old_offset, end_position=0;
+
+    if(fh->f_sharedfp_data==NULL){
+	opal_output(ompi_sharedfp_base_framework.framework_output,
+		    "sharedfp_rma_seek: module not initialized\n");
+        return OMPI_ERROR;
+    }
+
+    sh = fh->f_sharedfp_data;
+    offset = off * fh->f_fview.f_etype_size;
+
+    /* Make sure that no process is still using the old position */
+    ret = fh->f_comm->c_coll->coll_barrier ( fh->f_comm , fh->f_comm->c_coll->coll_barrier_module );
+    if ( OMPI_SUCCESS != ret ) {
+        return ret;
+    }
+
+    if( 0 == fh->f_rank ){
+        if ( MPI_SEEK_SET == whence ){
+            /*don't need to read current value*/
+            if(offset < 0){
+                opal_output(0,"sharedfp_rma_seek - MPI_SEEK_SET, offset must be > 0,"
+                            " got offset=%lld.\n",offset);
+                ret = OMPI_ERROR;
+            }
+        }
+	else if ( MPI_SEEK_CUR == whence){
+            OMPI_MPI_OFFSET_TYPE current_position;
+            ret = mca_sharedfp_rma_request_position(sh,0,&current_position);
+            if ( OMPI_SUCCESS == ret ) {
+                offset = current_position + offset;
+                if(offset < 0){
+                    opal_output(0,"sharedfp_rma_seek - MPI_SEEK_CUR, offset must be > 0, got offset=%lld.\n",offset);
+                    ret = OMPI_ERROR;
+                }
+            }
+        }
+	else if( MPI_SEEK_END == whence ){
+            mca_common_ompio_file_get_size( fh,&end_position);
+            offset = end_position + offset;
+
+            if ( offset < 0){
+                opal_output(0,"sharedfp_rma_seek - MPI_SEEK_END, offset must be > 0, got offset=%lld.\n",offset);
+                ret = OMPI_ERROR;
+            }
+        }else{
+            opal_output(0,"sharedfp_rma_seek - whence=%i is not supported\n",whence);
+            ret = OMPI_ERROR;
+        }
+
+        /* Set Shared file pointer  */
+        if ( OMPI_SUCCESS == ret ) {
+            rma_data = sh->selected_module_data;
+            ret = rma_data->win->w_osc_module->osc_fetch_and_op ( &offset, &old_offset, OMPI_OFFSET_DATATYPE,
+                                                                  0, 0, MPI_REPLACE, rma_data->win );
+            if ( OMPI_SUCCESS == ret ) {
+                ret = rma_data->win->w_osc_module->osc_flush ( 0, rma_data->win );
+            }
+            if ( mca_sharedfp_rma_verbose ) {
+                opal_output(ompi_sharedfp_base_framework.framework_output,
+                            "sharedfp_rma_seek: old_offset=%lld, new offset=%lld, ret=%d\n",
+                            old_offset, offset, ret);
+            }
+        }
+    }
+
+    fh->f_comm->c_coll->coll_bcast ( &ret, 1, MPI_INT, 0, fh->f_comm,
+                                     fh->f_comm->c_coll->coll_bcast_module );
+    return ret;
+}
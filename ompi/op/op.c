@@ -238,6 +238,8 @@ int ompi_op_init(void)
 
     ompi_op_ddt_map[OMPI_DATATYPE_MPI_FLOAT128] = OMPI_OP_BASE_TYPE_REAL16;
 
+    ompi_op_ddt_map[OMPI_DATATYPE_MPI_BFLOAT16] = OMPI_OP_BASE_TYPE_BFLOAT16;
+
     /* Create the intrinsic ops */
 
     if (OMPI_SUCCESS !=
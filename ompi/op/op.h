@@ -228,6 +228,28 @@ typedef struct ompi_predefined_op_t ompi_predefined_op_t;
  */
 OMPI_DECLSPEC extern int ompi_op_ddt_map[OMPI_DATATYPE_MAX_PREDEFINED];
 
+/**
+ * Size in bytes above which the reductions on intrinsic operations are
+ * handed to ompi_op_base_parallel_reduce(). SIZE_MAX when the parallel
+ * execution is disabled (the default).
+ */
+OMPI_DECLSPEC extern size_t ompi_op_base_parallel_threshold;
+
+/**
+ * Split an intrinsic reduction across the op helper threads (see
+ * ompi/mca/op/base/op_base_parallel.c).
+ *
+ * @param source1 First input buffer of the 3 buffers flavor, NULL for
+ *        the 2 buffers flavor (target = source2 op target)
+ *
+ * @returns OMPI_SUCCESS if the reduction has been executed, an error
+ * if the caller should execute it serially instead.
+ */
+OMPI_DECLSPEC int ompi_op_base_parallel_reduce(ompi_op_t *op, const void *source1,
+                                               const void *source2, void *target,
+                                               size_t count, ompi_datatype_t *dtype,
+                                               int dtype_id);
+
 /**
  * Global variable for MPI_OP_NULL (_addr flavor is for F03 bindings)
  */
@@ -578,6 +600,11 @@ static inline void ompi_op_reduce(ompi_op_t * op, const void *source,
         } else {
             dtype_id = ompi_op_ddt_map[dtype->id];
         }
+        if (OPAL_UNLIKELY(full_count * dtype->super.size >= ompi_op_base_parallel_threshold) &&
+            OMPI_SUCCESS == ompi_op_base_parallel_reduce(op, NULL, source, target, full_count,
+                                                         dtype, dtype_id)) {
+            return;
+        }
         op->o_func.intrinsic.fns[dtype_id](source, target,
                                            &count, &dtype,
                                            op->o_func.intrinsic.modules[dtype_id]);
@@ -678,6 +705,11 @@ static inline void ompi_3buff_op_reduce(ompi_op_t * op, void *source1,
 
     if (OPAL_LIKELY(ompi_op_is_intrinsic (op))) {
         int count = (int)full_count;
+        if (OPAL_UNLIKELY(full_count * dtype->super.size >= ompi_op_base_parallel_threshold) &&
+            OMPI_SUCCESS == ompi_op_base_parallel_reduce(op, src1, src2, tgt, full_count, dtype,
+                                                         ompi_op_ddt_map[dtype->id])) {
+            return;
+        }
         op->o_3buff_intrinsic.fns[ompi_op_ddt_map[dtype->id]](src1, src2,
                                                               tgt, &count,
                                                               &dtype,
@@ -23,6 +23,7 @@
 
 #include "opal_config.h"
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdlib.h>
 
@@ -288,6 +289,165 @@ static int32_t opal_datatype_optimize_short(opal_datatype_t *pData, size_t count
     return OPAL_SUCCESS;
 }
 
+/**
+ * Maximum number of consecutive units (a unit being either a data element or
+ * a full loop) that are considered as a candidate period when looking for
+ * repeated patterns in an optimized description.
+ */
+#define OPAL_DATATYPE_FOLD_MAX_PERIOD 8
+
+static inline uint32_t opal_datatype_unit_length(const dt_elem_desc_t *pElem)
+{
+    if (OPAL_DATATYPE_LOOP == pElem->elem.common.type) {
+        return pElem->loop.items + 1;
+    }
+    return 1;
+}
+
+static inline size_t opal_datatype_unit_size(const dt_elem_desc_t *pElem)
+{
+    if (OPAL_DATATYPE_LOOP == pElem->elem.common.type) {
+        return (size_t) pElem->loop.loops * pElem[pElem->loop.items].end_loop.size;
+    }
+    return (size_t) pElem->elem.count * pElem->elem.blocklen
+           * opal_datatype_basicDatatypes[pElem->elem.common.type]->size;
+}
+
+static inline ptrdiff_t opal_datatype_unit_disp(const dt_elem_desc_t *pElem)
+{
+    return pElem[GET_FIRST_NON_LOOP(pElem)].elem.disp;
+}
+
+/**
+ * Check if the length entries starting at b describe exactly the same memory
+ * layout as the ones starting at a, shifted by shift bytes.
+ */
+static bool opal_datatype_same_shifted(const dt_elem_desc_t *a, const dt_elem_desc_t *b,
+                                       uint32_t length, ptrdiff_t shift)
+{
+    for (uint32_t i = 0; i < length; i++) {
+        if ((a[i].elem.common.type != b[i].elem.common.type)
+            || (a[i].elem.common.flags != b[i].elem.common.flags)) {
+            return false;
+        }
+        switch (a[i].elem.common.type) {
+        case OPAL_DATATYPE_LOOP:
+            if ((a[i].loop.loops != b[i].loop.loops) || (a[i].loop.items != b[i].loop.items)
+                || (a[i].loop.extent != b[i].loop.extent)) {
+                return false;
+            }
+            break;
+        case OPAL_DATATYPE_END_LOOP:
+            if ((a[i].end_loop.items != b[i].end_loop.items)
+                || (a[i].end_loop.size != b[i].end_loop.size)
+                || ((a[i].end_loop.first_elem_disp + shift) != b[i].end_loop.first_elem_disp)) {
+                return false;
+            }
+            break;
+        default:
+            if ((a[i].elem.count != b[i].elem.count) || (a[i].elem.blocklen != b[i].elem.blocklen)
+                || (a[i].elem.extent != b[i].elem.extent)
+                || ((a[i].elem.disp + shift) != b[i].elem.disp)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Fold periodic patterns in the length entries of an optimized description
+ * starting at pSrc. A sequence of k repetitions of the same group of units,
+ * each repetition shifted by a constant displacement from the previous one,
+ * is replaced by a single loop over the first repetition. This typically
+ * happens with arrays of structures with gaps built through indexed or
+ * struct constructors, where each array element is described independently.
+ * The result is written in pDst, and the number of entries written returned.
+ * The number of loops created is accumulated in added_loops. If the folding
+ * can not be done, length is returned and pDst must be ignored.
+ */
+static uint32_t opal_datatype_fold_periodic(const dt_elem_desc_t *pSrc, uint32_t length,
+                                            dt_elem_desc_t *pDst, uint32_t *added_loops)
+{
+    uint32_t *units, nb_units = 0, u, pos = 0, out = 0;
+
+    units = (uint32_t *) malloc(sizeof(uint32_t) * (length + 1));
+    if (NULL == units) {
+        return length;
+    }
+    while (pos < length) {
+        units[nb_units++] = pos;
+        pos += opal_datatype_unit_length(&pSrc[pos]);
+    }
+    units[nb_units] = length;
+
+    for (u = 0; u < nb_units;) {
+        uint32_t best_period = 0, best_repeat = 0, best_saved = 0, period, plen, repeat;
+        ptrdiff_t best_shift = 0, shift;
+
+        for (period = 1; (period <= OPAL_DATATYPE_FOLD_MAX_PERIOD) && ((u + 2 * period) <= nb_units);
+             period++) {
+            plen = units[u + period] - units[u];
+            shift = opal_datatype_unit_disp(&pSrc[units[u + period]])
+                    - opal_datatype_unit_disp(&pSrc[units[u]]);
+            if (0 == shift) {
+                continue;
+            }
+            for (repeat = 1; (u + (repeat + 1) * period) <= nb_units; repeat++) {
+                if (((units[u + (repeat + 1) * period] - units[u + repeat * period]) != plen)
+                    || !opal_datatype_same_shifted(&pSrc[units[u]],
+                                                   &pSrc[units[u + repeat * period]], plen,
+                                                   repeat * shift)) {
+                    break;
+                }
+            }
+            /* the new loop costs 2 entries in the description */
+            if ((repeat > 1) && (((repeat - 1) * plen) > (best_saved + 2))) {
+                best_saved = (repeat - 1) * plen - 2;
+                best_period = period;
+                best_repeat = repeat;
+                best_shift = shift;
+            }
+        }
+
+        if (0 != best_saved) {
+            dt_elem_desc_t *pLoop = &pDst[out];
+            uint32_t inner;
+            size_t size = 0;
+
+            plen = units[u + best_period] - units[u];
+            inner = opal_datatype_fold_periodic(&pSrc[units[u]], plen, pLoop + 1, added_loops);
+            for (period = 0; period < best_period; period++) {
+                size += opal_datatype_unit_size(&pSrc[units[u + period]]);
+            }
+            CREATE_LOOP_START(pLoop, best_repeat, inner + 1, best_shift, 0);
+            CREATE_LOOP_END(pLoop + inner + 1, inner + 1,
+                            opal_datatype_unit_disp(&pSrc[units[u]]), size, 0);
+            (*added_loops)++;
+            out += inner + 2;
+            u += best_repeat * best_period;
+            continue;
+        }
+
+        pos = units[u];
+        if (OPAL_DATATYPE_LOOP == pSrc[pos].elem.common.type) {
+            /* keep the loop, but look for patterns inside its body */
+            uint32_t inner = opal_datatype_fold_periodic(&pSrc[pos + 1], pSrc[pos].loop.items - 1,
+                                                         &pDst[out + 1], added_loops);
+            pDst[out] = pSrc[pos];
+            pDst[out].loop.items = inner + 1;
+            pDst[out + inner + 1] = pSrc[pos + pSrc[pos].loop.items];
+            pDst[out + inner + 1].end_loop.items = inner + 1;
+            out += inner + 2;
+        } else {
+            pDst[out++] = pSrc[pos];
+        }
+        u++;
+    }
+    free(units);
+    return out;
+}
+
 int32_t opal_datatype_commit(opal_datatype_t *pData)
 {
     ddt_endloop_desc_t *pLast = &(pData->desc.desc[pData->desc.used].end_loop);
@@ -331,6 +491,30 @@ int32_t opal_datatype_commit(opal_datatype_t *pData)
     /*if( pData->size == (pData->true_ub - pData->true_lb) ) return OPAL_SUCCESS; */
 
     (void) opal_datatype_optimize_short(pData, 1, &(pData->opt_desc));
+    if (pData->opt_desc.used > 3) {
+        /* Collapse the repeated sub-patterns left by the previous step into loops. This
+         * shrinks the description, and therefore the number of elements (and stack
+         * updates) the pack/unpack engine has to go through.
+         */
+        dt_elem_desc_t *folded = (dt_elem_desc_t *) malloc(sizeof(dt_elem_desc_t)
+                                                           * pData->opt_desc.length);
+        uint32_t added_loops = 0, used = pData->opt_desc.used;
+
+        /* the folding is optional, keep the unfolded description if memory is short */
+        if (NULL != folded) {
+            used = opal_datatype_fold_periodic(pData->opt_desc.desc, pData->opt_desc.used, folded,
+                                               &added_loops);
+        }
+        if (used < pData->opt_desc.used) {
+            free(pData->opt_desc.desc);
+            pData->opt_desc.desc = folded;
+            pData->opt_desc.used = used;
+            /* each loop needs an extra position on the convertor stack */
+            pData->loops += 2 * added_loops;
+        } else {
+            free(folded);
+        }
+    }
     if (0 != pData->opt_desc.used) {
         /* let's add a fake element at the end just to avoid useless comparaisons
          * in pack/unpack functions.
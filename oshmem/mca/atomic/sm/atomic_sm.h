@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026      NVIDIA Corporation.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+#ifndef MCA_ATOMIC_SM_H
+#define MCA_ATOMIC_SM_H
+
+#include "oshmem_config.h"
+
+#include "oshmem/mca/mca.h"
+#include "oshmem/mca/atomic/atomic.h"
+#include "oshmem/util/oshmem_util.h"
+
+BEGIN_C_DECLS
+
+/* Globally exported variables */
+
+OSHMEM_DECLSPEC extern mca_atomic_base_component_1_0_0_t
+mca_atomic_sm_component;
+
+/* module of the next best component, used for the targets that cannot
+ * be accessed with load/store */
+extern mca_atomic_base_module_t *mca_atomic_sm_fallback;
+
+/* API functions */
+
+int mca_atomic_sm_startup(bool enable_progress_threads, bool enable_threads);
+int mca_atomic_sm_finalize(void);
+mca_atomic_base_module_t*
+mca_atomic_sm_query(int *priority);
+
+void *mca_atomic_sm_ptr(shmem_ctx_t ctx, void *target, int pe);
+
+int mca_atomic_sm_cswap(shmem_ctx_t ctx,
+                        void *target,
+                        uint64_t *prev,
+                        uint64_t cond,
+                        uint64_t value,
+                        size_t size,
+                        int pe);
+int mca_atomic_sm_cswap_nb(shmem_ctx_t ctx,
+                           void *fetch,
+                           void *target,
+                           uint64_t *prev,
+                           uint64_t cond,
+                           uint64_t value,
+                           size_t size,
+                           int pe);
+
+struct mca_atomic_sm_module_t {
+    mca_atomic_base_module_t super;
+};
+typedef struct mca_atomic_sm_module_t mca_atomic_sm_module_t;
+OBJ_CLASS_DECLARATION(mca_atomic_sm_module_t);
+
+END_C_DECLS
+
+#endif /* MCA_ATOMIC_SM_H */
@@ -0,0 +1,80 @@
+/* -*- Mode: C; c-basic-offset:4 ; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2026      NVIDIA Corporation.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+#include "oshmem_config.h"
+
+#include "oshmem/constants.h"
+#include "oshmem/mca/atomic/atomic.h"
+#include "oshmem/mca/atomic/base/base.h"
+#include "atomic_sm.h"
+
+/*
+ * Public string showing the atomic sm component version number
+ */
+const char *mca_atomic_sm_component_version_string =
+"Open SHMEM sm atomic MCA component version " OSHMEM_VERSION;
+
+/*
+ * Local function
+ */
+static int _sm_register(void);
+
+/*
+ * Instantiate the public struct with all of our public information
+ * and pointers to our public functions in it
+ */
+
+mca_atomic_base_component_t mca_atomic_sm_component = {
+
+    /* First, the mca_component_t struct containing meta information
+       about the component itself */
+
+    .atomic_version = {
+        MCA_ATOMIC_BASE_VERSION_2_0_0,
+
+        /* Component name and version */
+        .mca_component_name = "sm",
+        MCA_BASE_MAKE_VERSION(component, OSHMEM_MAJOR_VERSION, OSHMEM_MINOR_VERSION,
+                              OSHMEM_RELEASE_VERSION),
+
+        .mca_register_component_params = _sm_register,
+    },
+    .atomic_data = {
+        /* The component is checkpoint ready */
+        MCA_BASE_METADATA_PARAM_CHECKPOINT
+    },
+
+    /* Initialization / querying functions */
+
+    .atomic_startup = mca_atomic_sm_startup,
+    .atomic_finalize = mca_atomic_sm_finalize,
+    .atomic_query = mca_atomic_sm_query,
+};
+MCA_BASE_COMPONENT_INIT(oshmem, atomic, sm)
+
+static int _sm_register(void)
+{
+    /* above basic, below ucx which handles intra-node atomics itself */
+    mca_atomic_sm_component.priority = 85;
+    mca_base_component_var_register (&mca_atomic_sm_component.atomic_version,
+                                     "priority", "Priority of the atomic:sm "
+                                     "component (default: 85)", MCA_BASE_VAR_TYPE_INT,
+                                     NULL, 0, MCA_BASE_VAR_FLAG_SETTABLE,
+                                     OPAL_INFO_LVL_3,
+                                     MCA_BASE_VAR_SCOPE_ALL_EQ,
+                                     &mca_atomic_sm_component.priority);
+
+    return OSHMEM_SUCCESS;
+}
+
+OBJ_CLASS_INSTANCE(mca_atomic_sm_module_t,
+                   mca_atomic_base_module_t,
+                   NULL,
+                   NULL);
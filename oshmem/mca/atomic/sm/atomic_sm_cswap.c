@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026      NVIDIA Corporation.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+#include "oshmem_config.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "opal/sys/atomic.h"
+
+#include "oshmem/constants.h"
+#include "oshmem/mca/atomic/atomic.h"
+#include "oshmem/mca/atomic/base/base.h"
+#include "atomic_sm.h"
+
+int mca_atomic_sm_cswap(shmem_ctx_t ctx,
+                        void *target,
+                        uint64_t *prev,
+                        uint64_t cond,
+                        uint64_t value,
+                        size_t size,
+                        int pe)
+{
+    void *ptr;
+    int32_t old32;
+    int64_t old64;
+
+    assert((8 == size) || (4 == size));
+
+    ptr = mca_atomic_sm_ptr(ctx, target, pe);
+    if (OPAL_UNLIKELY(NULL == ptr)) {
+        return mca_atomic_sm_fallback->atomic_cswap(ctx, target, prev, cond,
+                                                    value, size, pe);
+    }
+
+    /* on failure the current value is stored into old32/old64, which is
+     * what has to be returned in both cases */
+    if (4 == size) {
+        old32 = (int32_t)cond;
+        opal_atomic_compare_exchange_strong_32((opal_atomic_int32_t *)ptr,
+                                               &old32, (int32_t)value);
+        memcpy(prev, &old32, sizeof(old32));
+    } else {
+        old64 = (int64_t)cond;
+        opal_atomic_compare_exchange_strong_64((opal_atomic_int64_t *)ptr,
+                                               &old64, (int64_t)value);
+        memcpy(prev, &old64, sizeof(old64));
+    }
+
+    return OSHMEM_SUCCESS;
+}
+
+int mca_atomic_sm_cswap_nb(shmem_ctx_t ctx,
+                           void *fetch,
+                           void *target,
+                           uint64_t *prev,
+                           uint64_t cond,
+                           uint64_t value,
+                           size_t size,
+                           int pe)
+{
+    return mca_atomic_sm_cswap(ctx, target, (uint64_t *)fetch, cond, value,
+                               size, pe);
+}
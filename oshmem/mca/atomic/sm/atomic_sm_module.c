@@ -0,0 +1,469 @@
+/*
+ * Copyright (c) 2026      NVIDIA Corporation.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+#include "oshmem_config.h"
+#include <stdio.h>
+
+#include "opal/sys/atomic.h"
+#include "opal/util/proc.h"
+#include "ompi/proc/proc.h"
+
+#include "oshmem/constants.h"
+#include "oshmem/mca/atomic/atomic.h"
+#include "oshmem/mca/atomic/base/base.h"
+#include "oshmem/mca/spml/spml.h"
+#include "oshmem/mca/memheap/memheap.h"
+#include "oshmem/mca/memheap/base/base.h"
+#include "oshmem/proc/proc.h"
+#include "atomic_sm.h"
+
+mca_atomic_base_module_t *mca_atomic_sm_fallback = NULL;
+
+enum {
+    ATOMIC_SM_OP_ADD,
+    ATOMIC_SM_OP_AND,
+    ATOMIC_SM_OP_OR,
+    ATOMIC_SM_OP_XOR,
+    ATOMIC_SM_OP_SWAP
+};
+
+/*
+ * Initial query function that is invoked during initialization, allowing
+ * this module to indicate what level of thread support it provides.
+ */
+int mca_atomic_sm_startup(bool enable_progress_threads, bool enable_threads)
+{
+    return OSHMEM_SUCCESS;
+}
+
+int mca_atomic_sm_finalize(void)
+{
+    if (NULL != mca_atomic_sm_fallback) {
+        OBJ_RELEASE(mca_atomic_sm_fallback);
+        mca_atomic_sm_fallback = NULL;
+    }
+
+    return OSHMEM_SUCCESS;
+}
+
+/*
+ * Return the address of the target word in our address space, or NULL if
+ * the segment it belongs to is not mapped. The decision must be the same
+ * for every PE on a given segment, otherwise load/store atomics issued by
+ * the peers could race with the lock based atomics of the fallback, so
+ * a local target is only accessed directly when the peers can map it too.
+ */
+void *mca_atomic_sm_ptr(shmem_ctx_t ctx, void *target, int pe)
+{
+    sshmem_mkey_t *mkey;
+    void *rva;
+    int me = oshmem_my_proc_id();
+    int npes = oshmem_num_procs();
+    int probe;
+    int i;
+
+    if (1 == npes) {
+        return target;
+    }
+
+    probe = (pe == me) ? (me + 1) % npes : pe;
+
+    for (i = 0; i < mca_memheap_base_num_transports(); i++) {
+        mkey = mca_memheap_base_get_cached_mkey(ctx, probe, target, i, &rva);
+        if (NULL == mkey) {
+            continue;
+        }
+
+        if (!mca_memheap_base_mkey_is_shm(mkey)) {
+            rva = MCA_SPML_CALL(rmkey_ptr(target, mkey, probe));
+        }
+
+        if (NULL != rva) {
+            return (pe == me) ? target : rva;
+        }
+    }
+
+    return NULL;
+}
+
+static inline
+uint64_t mca_atomic_sm_fop_32(void *ptr, uint64_t value, int op)
+{
+    int32_t *addr = (int32_t *)ptr;
+    int32_t val   = (int32_t)value;
+
+    switch (op) {
+    case ATOMIC_SM_OP_ADD:
+        return (uint32_t)opal_atomic_fetch_add_32((opal_atomic_int32_t *)addr, val);
+    case ATOMIC_SM_OP_AND:
+        return (uint32_t)opal_atomic_fetch_and_32((opal_atomic_int32_t *)addr, val);
+    case ATOMIC_SM_OP_OR:
+        return (uint32_t)opal_atomic_fetch_or_32((opal_atomic_int32_t *)addr, val);
+    case ATOMIC_SM_OP_XOR:
+        return (uint32_t)opal_atomic_fetch_xor_32((opal_atomic_int32_t *)addr, val);
+    default:
+        return (uint32_t)opal_atomic_swap_32((opal_atomic_int32_t *)addr, val);
+    }
+}
+
+static inline
+uint64_t mca_atomic_sm_fop_64(void *ptr, uint64_t value, int op)
+{
+    int64_t *addr = (int64_t *)ptr;
+    int64_t val   = (int64_t)value;
+
+    switch (op) {
+    case ATOMIC_SM_OP_ADD:
+        return (uint64_t)opal_atomic_fetch_add_64((opal_atomic_int64_t *)addr, val);
+    case ATOMIC_SM_OP_AND:
+        return (uint64_t)opal_atomic_fetch_and_64((opal_atomic_int64_t *)addr, val);
+    case ATOMIC_SM_OP_OR:
+        return (uint64_t)opal_atomic_fetch_or_64((opal_atomic_int64_t *)addr, val);
+    case ATOMIC_SM_OP_XOR:
+        return (uint64_t)opal_atomic_fetch_xor_64((opal_atomic_int64_t *)addr, val);
+    default:
+        return (uint64_t)opal_atomic_swap_64((opal_atomic_int64_t *)addr, val);
+    }
+}
+
+/*
+ * Apply the operation with a processor atomic. Return OSHMEM_ERR_NOT_FOUND
+ * when the target is not mapped so that the caller can use the fallback.
+ */
+static inline
+int mca_atomic_sm_fop(shmem_ctx_t ctx,
+                      void *target,
+                      void *prev,
+                      uint64_t value,
+                      size_t size,
+                      int pe,
+                      int op)
+{
+    void *ptr;
+    uint32_t prev32;
+    uint64_t prev64;
+
+    assert((8 == size) || (4 == size));
+
+    ptr = mca_atomic_sm_ptr(ctx, target, pe);
+    if (OPAL_UNLIKELY(NULL == ptr)) {
+        return OSHMEM_ERR_NOT_FOUND;
+    }
+
+    if (4 == size) {
+        prev32 = (uint32_t)mca_atomic_sm_fop_32(ptr, value, op);
+        if (NULL != prev) {
+            memcpy(prev, &prev32, sizeof(prev32));
+        }
+    } else {
+        prev64 = mca_atomic_sm_fop_64(ptr, value, op);
+        if (NULL != prev) {
+            memcpy(prev, &prev64, sizeof(prev64));
+        }
+    }
+
+    return OSHMEM_SUCCESS;
+}
+
+static int mca_atomic_sm_add(shmem_ctx_t ctx,
+                             void *target,
+                             uint64_t value,
+                             size_t size,
+                             int pe)
+{
+    int rc = mca_atomic_sm_fop(ctx, target, NULL, value, size, pe, ATOMIC_SM_OP_ADD);
+
+    if (OSHMEM_ERR_NOT_FOUND == rc) {
+        rc = mca_atomic_sm_fallback->atomic_add(ctx, target, value, size, pe);
+    }
+    return rc;
+}
+
+static int mca_atomic_sm_and(shmem_ctx_t ctx,
+                             void *target,
+                             uint64_t value,
+                             size_t size,
+                             int pe)
+{
+    int rc = mca_atomic_sm_fop(ctx, target, NULL, value, size, pe, ATOMIC_SM_OP_AND);
+
+    if (OSHMEM_ERR_NOT_FOUND == rc) {
+        rc = mca_atomic_sm_fallback->atomic_and(ctx, target, value, size, pe);
+    }
+    return rc;
+}
+
+static int mca_atomic_sm_or(shmem_ctx_t ctx,
+                            void *target,
+                            uint64_t value,
+                            size_t size,
+                            int pe)
+{
+    int rc = mca_atomic_sm_fop(ctx, target, NULL, value, size, pe, ATOMIC_SM_OP_OR);
+
+    if (OSHMEM_ERR_NOT_FOUND == rc) {
+        rc = mca_atomic_sm_fallback->atomic_or(ctx, target, value, size, pe);
+    }
+    return rc;
+}
+
+static int mca_atomic_sm_xor(shmem_ctx_t ctx,
+                             void *target,
+                             uint64_t value,
+                             size_t size,
+                             int pe)
+{
+    int rc = mca_atomic_sm_fop(ctx, target, NULL, value, size, pe, ATOMIC_SM_OP_XOR);
+
+    if (OSHMEM_ERR_NOT_FOUND == rc) {
+        rc = mca_atomic_sm_fallback->atomic_xor(ctx, target, value, size, pe);
+    }
+    return rc;
+}
+
+static int mca_atomic_sm_fadd(shmem_ctx_t ctx,
+                              void *target,
+                              void *prev,
+                              uint64_t value,
+                              size_t size,
+                              int pe)
+{
+    int rc = mca_atomic_sm_fop(ctx, target, prev, value, size, pe, ATOMIC_SM_OP_ADD);
+
+    if (OSHMEM_ERR_NOT_FOUND == rc) {
+        rc = mca_atomic_sm_fallback->atomic_fadd(ctx, target, prev, value, size, pe);
+    }
+    return rc;
+}
+
+static int mca_atomic_sm_fand(shmem_ctx_t ctx,
+                              void *target,
+                              void *prev,
+                              uint64_t value,
+                              size_t size,
+                              int pe)
+{
+    int rc = mca_atomic_sm_fop(ctx, target, prev, value, size, pe, ATOMIC_SM_OP_AND);
+
+    if (OSHMEM_ERR_NOT_FOUND == rc) {
+        rc = mca_atomic_sm_fallback->atomic_fand(ctx, target, prev, value, size, pe);
+    }
+    return rc;
+}
+
+static int mca_atomic_sm_for(shmem_ctx_t ctx,
+                             void *target,
+                             void *prev,
+                             uint64_t value,
+                             size_t size,
+                             int pe)
+{
+    int rc = mca_atomic_sm_fop(ctx, target, prev, value, size, pe, ATOMIC_SM_OP_OR);
+
+    if (OSHMEM_ERR_NOT_FOUND == rc) {
+        rc = mca_atomic_sm_fallback->atomic_for(ctx, target, prev, value, size, pe);
+    }
+    return rc;
+}
+
+static int mca_atomic_sm_fxor(shmem_ctx_t ctx,
+                              void *target,
+                              void *prev,
+                              uint64_t value,
+                              size_t size,
+                              int pe)
+{
+    int rc = mca_atomic_sm_fop(ctx, target, prev, value, size, pe, ATOMIC_SM_OP_XOR);
+
+    if (OSHMEM_ERR_NOT_FOUND == rc) {
+        rc = mca_atomic_sm_fallback->atomic_fxor(ctx, target, prev, value, size, pe);
+    }
+    return rc;
+}
+
+static int mca_atomic_sm_swap(shmem_ctx_t ctx,
+                              void *target,
+                              void *prev,
+                              uint64_t value,
+                              size_t size,
+                              int pe)
+{
+    int rc = mca_atomic_sm_fop(ctx, target, prev, value, size, pe, ATOMIC_SM_OP_SWAP);
+
+    if (OSHMEM_ERR_NOT_FOUND == rc) {
+        rc = mca_atomic_sm_fallback->atomic_swap(ctx, target, prev, value, size, pe);
+    }
+    return rc;
+}
+
+/*
+ * The non-blocking variants complete immediately: the old value is stored
+ * straight into the user fetch buffer, so there is nothing left for quiet.
+ */
+static int mca_atomic_sm_fadd_nb(shmem_ctx_t ctx,
+                                 void *fetch,
+                                 void *target,
+                                 void *prev,
+                                 uint64_t value,
+                                 size_t size,
+                                 int pe)
+{
+    return mca_atomic_sm_fadd(ctx, target, fetch, value, size, pe);
+}
+
+static int mca_atomic_sm_fand_nb(shmem_ctx_t ctx,
+                                 void *fetch,
+                                 void *target,
+                                 void *prev,
+                                 uint64_t value,
+                                 size_t size,
+                                 int pe)
+{
+    return mca_atomic_sm_fand(ctx, target, fetch, value, size, pe);
+}
+
+static int mca_atomic_sm_for_nb(shmem_ctx_t ctx,
+                                void *fetch,
+                                void *target,
+                                void *prev,
+                                uint64_t value,
+                                size_t size,
+                                int pe)
+{
+    return mca_atomic_sm_for(ctx, target, fetch, value, size, pe);
+}
+
+static int mca_atomic_sm_fxor_nb(shmem_ctx_t ctx,
+                                 void *fetch,
+                                 void *target,
+                                 void *prev,
+                                 uint64_t value,
+                                 size_t size,
+                                 int pe)
+{
+    return mca_atomic_sm_fxor(ctx, target, fetch, value, size, pe);
+}
+
+static int mca_atomic_sm_swap_nb(shmem_ctx_t ctx,
+                                 void *fetch,
+                                 void *target,
+                                 void *prev,
+                                 uint64_t value,
+                                 size_t size,
+                                 int pe)
+{
+    return mca_atomic_sm_swap(ctx, target, fetch, value, size, pe);
+}
+
+static int mca_atomic_sm_set(shmem_ctx_t ctx,
+                             void *target,
+                             uint64_t value,
+                             size_t size,
+                             int pe)
+{
+    uint64_t prev;
+    int rc = mca_atomic_sm_fop(ctx, target, NULL, value, size, pe, ATOMIC_SM_OP_SWAP);
+
+    if (OSHMEM_ERR_NOT_FOUND == rc) {
+        if (NULL != mca_atomic_sm_fallback->atomic_set) {
+            rc = mca_atomic_sm_fallback->atomic_set(ctx, target, value, size, pe);
+        } else {
+            rc = mca_atomic_sm_fallback->atomic_swap(ctx, target, &prev, value, size, pe);
+        }
+    }
+    return rc;
+}
+
+/*
+ * Query the other atomic components and keep the best of them to serve the
+ * targets that cannot be accessed with load/store.
+ */
+static mca_atomic_base_module_t *mca_atomic_sm_query_fallback(void)
+{
+    mca_base_component_list_item_t *cli;
+    mca_atomic_base_component_t *component;
+    mca_atomic_base_module_t *module;
+    mca_atomic_base_module_t *best = NULL;
+    int best_priority = -1;
+    int priority;
+
+    OPAL_LIST_FOREACH(cli, &oshmem_atomic_base_framework.framework_components,
+                      mca_base_component_list_item_t) {
+        component = (mca_atomic_base_component_t *)cli->cli_component;
+        if (component == &mca_atomic_sm_component) {
+            continue;
+        }
+
+        priority = -1;
+        module = component->atomic_query(&priority);
+        if (NULL == module) {
+            continue;
+        }
+
+        if ((priority > best_priority) && (NULL != module->atomic_fadd) &&
+            (NULL != module->atomic_cswap) && (NULL != module->atomic_swap)) {
+            if (NULL != best) {
+                OBJ_RELEASE(best);
+            }
+            best          = module;
+            best_priority = priority;
+        } else {
+            OBJ_RELEASE(module);
+        }
+    }
+
+    return best;
+}
+
+mca_atomic_base_module_t *
+mca_atomic_sm_query(int *priority)
+{
+    mca_atomic_sm_module_t *module;
+
+    *priority = mca_atomic_sm_component.priority;
+
+    /* Mixing processor atomics with the atomics of a network adapter on the
+     * same word is not atomic, so only qualify when every PE is on our node */
+    if ((int)opal_process_info.num_local_peers + 1 != ompi_proc_world_size()) {
+        ATOMIC_VERBOSE(5, "not all PEs are on the local node, disqualifying");
+        return NULL;
+    }
+
+    if (NULL == mca_atomic_sm_fallback) {
+        mca_atomic_sm_fallback = mca_atomic_sm_query_fallback();
+        if (NULL == mca_atomic_sm_fallback) {
+            ATOMIC_VERBOSE(5, "no fallback atomic component, disqualifying");
+            return NULL;
+        }
+    }
+
+    module = OBJ_NEW(mca_atomic_sm_module_t);
+    if (module) {
+        module->super.atomic_add   = mca_atomic_sm_add;
+        module->super.atomic_and   = mca_atomic_sm_and;
+        module->super.atomic_or    = mca_atomic_sm_or;
+        module->super.atomic_xor   = mca_atomic_sm_xor;
+        module->super.atomic_fadd  = mca_atomic_sm_fadd;
+        module->super.atomic_fand  = mca_atomic_sm_fand;
+        module->super.atomic_for   = mca_atomic_sm_for;
+        module->super.atomic_fxor  = mca_atomic_sm_fxor;
+        module->super.atomic_swap  = mca_atomic_sm_swap;
+        module->super.atomic_cswap = mca_atomic_sm_cswap;
+        module->super.atomic_fadd_nb  = mca_atomic_sm_fadd_nb;
+        module->super.atomic_fand_nb  = mca_atomic_sm_fand_nb;
+        module->super.atomic_for_nb   = mca_atomic_sm_for_nb;
+        module->super.atomic_fxor_nb  = mca_atomic_sm_fxor_nb;
+        module->super.atomic_swap_nb  = mca_atomic_sm_swap_nb;
+        module->super.atomic_cswap_nb = mca_atomic_sm_cswap_nb;
+        module->super.atomic_set      = mca_atomic_sm_set;
+        return &(module->super);
+    }
+
+    return NULL ;
+}
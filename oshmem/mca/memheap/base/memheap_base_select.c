@@ -24,6 +24,7 @@
 #include "oshmem/include/shmemx.h"
 #include "oshmem/mca/sshmem/base/base.h"
 #include "ompi/util/timings.h"
+#include "opal/util/minmax.h"
 
 #include <sys/mman.h>
 
@@ -105,20 +106,50 @@ int mca_memheap_base_select()
 
 static size_t _memheap_size(void)
 {
-    return (size_t) memheap_align(oshmem_shmem_info_env.symmetric_heap_size);
+    size_t size = (size_t) memheap_align(oshmem_shmem_info_env.symmetric_heap_size);
+    size_t page_size = mca_sshmem_base_hugepage_align;
+
+    /* user and private heaps fill whole huge pages when sshmem uses them */
+    if (page_size > MEMHEAP_BASE_MIN_SIZE) {
+        size = ((size + MEMHEAP_BASE_PRIVATE_SIZE + page_size - 1) & ~(page_size - 1)) -
+               MEMHEAP_BASE_PRIVATE_SIZE;
+    }
+
+    return size;
 }
 
 static void *memheap_mmap_get(void *hint, size_t size)
 {
     void *addr;
+    size_t align;
+    uintptr_t start;
+
+    if (NULL != hint) {
+        addr = mmap(hint, size,
+                    PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (addr == MAP_FAILED) {
+            return NULL;
+        }
 
-    addr = mmap(hint, size,
+        return addr;
+    }
+
+    /* Start the region on a huge page boundary so that sshmem can back
+     * it with huge pages */
+    align = opal_max((size_t)MEMHEAP_BASE_MIN_SIZE, mca_sshmem_base_hugepage_align);
+    addr = mmap(NULL, size + align,
                 PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
     if (addr == MAP_FAILED) {
         return NULL;
     }
 
-    return addr;
+    start = ((uintptr_t)addr + align - 1) & ~((uintptr_t)align - 1);
+    if (start != (uintptr_t)addr) {
+        (void)munmap(addr, start - (uintptr_t)addr);
+    }
+    (void)munmap((void *)(start + size), (uintptr_t)addr + align - start);
+
+    return (void *)start;
 }
 
 static int memheap_exchange_base_address(size_t size, void **address)
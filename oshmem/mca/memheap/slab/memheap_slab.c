@@ -0,0 +1,806 @@
+/* -*- Mode: C; c-basic-offset:4 ; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2026      NVIDIA Corporation.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+#include "oshmem_config.h"
+#include "oshmem/proc/proc.h"
+#include "oshmem/mca/spml/spml.h"
+#include "oshmem/mca/memheap/memheap.h"
+#include "oshmem/mca/memheap/slab/memheap_slab.h"
+#include "oshmem/mca/memheap/slab/memheap_slab_component.h"
+#include "oshmem/mca/memheap/base/base.h"
+#include "opal/class/opal_hash_table.h"
+#include "opal/class/opal_object.h"
+
+mca_memheap_slab_module_t memheap_slab = {
+    {
+        &mca_memheap_slab_component,
+        mca_memheap_slab_finalize,
+        mca_memheap_slab_alloc,
+        mca_memheap_slab_align,
+        mca_memheap_slab_realloc,
+        mca_memheap_slab_free,
+
+        mca_memheap_slab_private_alloc,
+        mca_memheap_slab_private_free,
+
+        mca_memheap_base_get_mkey,
+        mca_memheap_base_is_symmetric_addr,
+        mca_memheap_modex_recv_all,
+
+        0
+    },
+    50  /* priority */
+};
+
+/*
+ * Object sizes of the small classes: multiples of 16 bytes (except for
+ * the smallest one) with four classes per power of two above 64 bytes,
+ * which bounds the internal fragmentation to 25%.
+ */
+static const size_t slab_class_size[MEMHEAP_SLAB_NUM_CLASSES] = {
+    8, 16, 32, 48, 64,
+    80, 96, 112, 128,
+    160, 192, 224, 256,
+    320, 384, 448, 512,
+    640, 768, 896, 1024,
+    1280, 1536, 1792, 2048
+};
+
+/* Size class of a request, indexed by the size in 8 byte units */
+static uint8_t slab_class_index[(MEMHEAP_SLAB_MAX_SMALL >> 3) + 1];
+
+/*
+ * Find first bit set in a non zero word.
+ */
+static inline __opal_attribute_always_inline__ unsigned slab_ffs(uint64_t word)
+{
+#if OPAL_C_HAVE_BUILTIN_CLZ
+    return 63 - __builtin_clzll(word & (~word + 1));
+#else
+    unsigned num = 0;
+
+    if ((word & 0xffffffffULL) == 0) {
+        num += 32;
+        word >>= 32;
+    }
+    if ((word & 0xffff) == 0) {
+        num += 16;
+        word >>= 16;
+    }
+    if ((word & 0xff) == 0) {
+        num += 8;
+        word >>= 8;
+    }
+    if ((word & 0xf) == 0) {
+        num += 4;
+        word >>= 4;
+    }
+    if ((word & 0x3) == 0) {
+        num += 2;
+        word >>= 2;
+    }
+    if ((word & 0x1) == 0) {
+        num += 1;
+    }
+    return num;
+#endif
+}
+
+/* round down to a power of two */
+static inline unsigned slab_floor_order(size_t val)
+{
+    unsigned order = memheap_log2(val);
+
+    return (val & (val - 1)) ? order - 1 : order;
+}
+
+static memheap_slab_bitmap_t *slab_bitmap_create(size_t nbits)
+{
+    memheap_slab_bitmap_t *bm;
+    size_t words[MEMHEAP_SLAB_BITMAP_MAX_LEVELS];
+    size_t total = 0;
+    size_t n = nbits;
+    unsigned levels = 0;
+    unsigned l;
+    uint64_t *p;
+
+    do {
+        if (MEMHEAP_SLAB_BITMAP_MAX_LEVELS == levels) {
+            return NULL;
+        }
+        n = (n > 64) ? ((n + 63) >> 6) : 1;
+        words[levels++] = n;
+        total += n;
+    } while (n > 1);
+
+    bm = (memheap_slab_bitmap_t *) calloc(1, sizeof(*bm) + total * sizeof(uint64_t));
+    if (NULL == bm) {
+        return NULL;
+    }
+
+    bm->nbits = nbits;
+    bm->levels = levels;
+    p = (uint64_t *) (bm + 1);
+    for (l = 0; l < levels; ++l) {
+        bm->level[l] = p;
+        p += words[l];
+    }
+
+    return bm;
+}
+
+static inline void slab_bitmap_destroy(memheap_slab_bitmap_t *bm)
+{
+    free(bm);
+}
+
+/* set the nbits first bits, lower levels first */
+static void slab_bitmap_fill(memheap_slab_bitmap_t *bm)
+{
+    size_t n = bm->nbits;
+    unsigned l;
+
+    for (l = 0; l < bm->levels; ++l) {
+        memset(bm->level[l], 0xff, (n >> 6) * sizeof(uint64_t));
+        if (n & 63) {
+            bm->level[l][n >> 6] = (1ULL << (n & 63)) - 1;
+        }
+        n = (n + 63) >> 6;
+    }
+}
+
+static inline int slab_bitmap_test(const memheap_slab_bitmap_t *bm, size_t nr)
+{
+    return (bm->level[0][nr >> 6] >> (nr & 63)) & 1;
+}
+
+static inline void slab_bitmap_set(memheap_slab_bitmap_t *bm, size_t nr)
+{
+    unsigned l;
+    uint64_t old;
+
+    for (l = 0; l < bm->levels; ++l) {
+        old = bm->level[l][nr >> 6];
+        bm->level[l][nr >> 6] = old | (1ULL << (nr & 63));
+        if (old) {
+            /* upper levels already know about this word */
+            break;
+        }
+        nr >>= 6;
+    }
+}
+
+static inline void slab_bitmap_clear(memheap_slab_bitmap_t *bm, size_t nr)
+{
+    unsigned l;
+
+    for (l = 0; l < bm->levels; ++l) {
+        bm->level[l][nr >> 6] &= ~(1ULL << (nr & 63));
+        if (bm->level[l][nr >> 6]) {
+            break;
+        }
+        nr >>= 6;
+    }
+}
+
+/*
+ * Lowest set bit of the bitmap or nbits if the bitmap is empty.
+ */
+static inline size_t slab_bitmap_find_first(const memheap_slab_bitmap_t *bm)
+{
+    size_t nr = 0;
+    int l;
+
+    if (0 == bm->level[bm->levels - 1][0]) {
+        return bm->nbits;
+    }
+
+    for (l = (int) bm->levels - 1; l >= 0; --l) {
+        nr = (nr << 6) + slab_ffs(bm->level[l][nr]);
+    }
+
+    return nr;
+}
+
+/*
+ * Buddy allocator over pages, free blocks of each order are kept in
+ * their own bitmap.
+ */
+static int slab_block_alloc(mca_memheap_slab_heap_t *heap,
+                            unsigned order,
+                            size_t *page)
+{
+    unsigned o;
+    size_t nr = 0;
+
+    for (o = order; o <= heap->max_order; ++o) {
+        nr = slab_bitmap_find_first(heap->free_blocks[o]);
+        if (nr < heap->free_blocks[o]->nbits) {
+            goto found;
+        }
+    }
+
+    return OSHMEM_ERR_OUT_OF_RESOURCE;
+
+    found:
+    slab_bitmap_clear(heap->free_blocks[o], nr);
+    while (o > order) {
+        --o;
+        nr <<= 1;
+        slab_bitmap_set(heap->free_blocks[o], nr + 1);
+    }
+
+    *page = nr << order;
+    return OSHMEM_SUCCESS;
+}
+
+static void slab_block_free(mca_memheap_slab_heap_t *heap,
+                            size_t page,
+                            unsigned order)
+{
+    size_t nr = page >> order;
+
+    while ((order < heap->max_order)
+            && ((nr ^ 1) < heap->free_blocks[order]->nbits)
+            && slab_bitmap_test(heap->free_blocks[order], nr ^ 1)) {
+        slab_bitmap_clear(heap->free_blocks[order], nr ^ 1);
+        nr >>= 1;
+        ++order;
+    }
+
+    slab_bitmap_set(heap->free_blocks[order], nr);
+}
+
+/*
+ * Release an arbitrary run of pages as the largest aligned blocks
+ * that fit in it.
+ */
+static void slab_range_free(mca_memheap_slab_heap_t *heap,
+                            size_t page,
+                            size_t count)
+{
+    unsigned order;
+
+    while (count) {
+        order = page ? slab_ffs(page) : heap->max_order;
+        if (order > heap->max_order) {
+            order = heap->max_order;
+        }
+        while (((size_t) 1 << order) > count) {
+            --order;
+        }
+
+        slab_block_free(heap, page, order);
+        page += (size_t) 1 << order;
+        count -= (size_t) 1 << order;
+    }
+}
+
+static int slab_large_alloc(mca_memheap_slab_heap_t *heap,
+                            size_t size,
+                            unsigned min_order,
+                            void **p_buff,
+                            size_t *p_size)
+{
+    int rc;
+    size_t pages;
+    size_t page;
+    unsigned order;
+    unsigned long addr;
+
+    pages = (size + (1UL << MEMHEAP_SLAB_PAGE_ORDER) - 1) >> MEMHEAP_SLAB_PAGE_ORDER;
+    if (0 == pages) {
+        pages = 1;
+    }
+
+    order = memheap_log2(pages);
+    if (order < min_order) {
+        order = min_order;
+    }
+    if (order > heap->max_order) {
+        MEMHEAP_VERBOSE(5, "Allocation overflow of symmetric heap size");
+        return OSHMEM_ERR_OUT_OF_RESOURCE;
+    }
+
+    rc = slab_block_alloc(heap, order, &page);
+    if (OSHMEM_SUCCESS != rc) {
+        MEMHEAP_VERBOSE(5, "No free block of order %u", order);
+        return rc;
+    }
+
+    /* give back the unused tail of the block */
+    if (pages < ((size_t) 1 << order)) {
+        slab_range_free(heap, page + pages, ((size_t) 1 << order) - pages);
+    }
+
+    addr = (unsigned long) heap->symmetric_heap + (page << MEMHEAP_SLAB_PAGE_ORDER);
+    rc = opal_hash_table_set_value_uint64(heap->symmetric_heap_hashtable,
+                                          addr,
+                                          (void *) (unsigned long) pages);
+    if (OPAL_SUCCESS != rc) {
+        MEMHEAP_VERBOSE(5, "Failed to insert size to hashtable");
+        slab_range_free(heap, page, pages);
+        return OSHMEM_ERROR;
+    }
+
+    *p_buff = (void *) addr;
+    *p_size = pages << MEMHEAP_SLAB_PAGE_ORDER;
+    return OSHMEM_SUCCESS;
+}
+
+static int slab_small_alloc(mca_memheap_slab_heap_t *heap,
+                            int size_class,
+                            void **p_buff,
+                            size_t *p_size)
+{
+    int rc;
+    size_t nr;
+    size_t page;
+    size_t span;
+    mca_memheap_slab_span_t *s;
+
+    span = slab_bitmap_find_first(heap->partial[size_class]);
+    if (span >= heap->num_spans) {
+        /* carve a new span */
+        rc = slab_block_alloc(heap, MEMHEAP_SLAB_SPAN_PAGES_ORDER, &page);
+        if (OSHMEM_SUCCESS != rc) {
+            MEMHEAP_VERBOSE(5, "No free span for size class %d", size_class);
+            return rc;
+        }
+
+        span = page >> MEMHEAP_SLAB_SPAN_PAGES_ORDER;
+        s = &heap->spans[span];
+        s->num_free = (1UL << MEMHEAP_SLAB_SPAN_ORDER) / slab_class_size[size_class];
+        s->objects = slab_bitmap_create(s->num_free);
+        if (NULL == s->objects) {
+            slab_block_free(heap, page, MEMHEAP_SLAB_SPAN_PAGES_ORDER);
+            return OSHMEM_ERR_OUT_OF_RESOURCE;
+        }
+        slab_bitmap_fill(s->objects);
+        s->size_class = size_class;
+        slab_bitmap_set(heap->partial[size_class], span);
+    }
+
+    s = &heap->spans[span];
+    nr = slab_bitmap_find_first(s->objects);
+    slab_bitmap_clear(s->objects, nr);
+    if (0 == --s->num_free) {
+        slab_bitmap_clear(heap->partial[size_class], span);
+    }
+
+    *p_buff = (void *) ((unsigned char *) heap->symmetric_heap
+            + (span << MEMHEAP_SLAB_SPAN_ORDER)
+            + nr * slab_class_size[size_class]);
+    *p_size = slab_class_size[size_class];
+    return OSHMEM_SUCCESS;
+}
+
+static int slab_small_free(mca_memheap_slab_heap_t *heap,
+                           size_t span,
+                           size_t offset)
+{
+    mca_memheap_slab_span_t *s = &heap->spans[span];
+    int size_class = s->size_class;
+    size_t nr;
+
+    if (offset % slab_class_size[size_class]) {
+        return OSHMEM_ERROR;
+    }
+
+    nr = offset / slab_class_size[size_class];
+    if (slab_bitmap_test(s->objects, nr)) {
+        return OSHMEM_ERROR;
+    }
+
+    slab_bitmap_set(s->objects, nr);
+    if (1 == ++s->num_free) {
+        slab_bitmap_set(heap->partial[size_class], span);
+    }
+
+    if (s->num_free == s->objects->nbits) {
+        /* the span is empty, return it to the buddy allocator */
+        slab_bitmap_clear(heap->partial[size_class], span);
+        slab_bitmap_destroy(s->objects);
+        s->objects = NULL;
+        s->num_free = 0;
+        s->size_class = MEMHEAP_SLAB_NO_CLASS;
+        slab_block_free(heap, span << MEMHEAP_SLAB_SPAN_PAGES_ORDER,
+                        MEMHEAP_SLAB_SPAN_PAGES_ORDER);
+    }
+
+    return OSHMEM_SUCCESS;
+}
+
+/*
+ * Look up the block containing ptr and return its usable size.
+ */
+static int slab_block_size(mca_memheap_slab_heap_t *heap,
+                           void *ptr,
+                           size_t *size)
+{
+    int rc;
+    size_t offset;
+    size_t span;
+    void *pages;
+
+    if (((unsigned char *) ptr < (unsigned char *) heap->symmetric_heap)
+            || ((unsigned char *) ptr >= (unsigned char *) heap->symmetric_heap
+                    + (heap->num_pages << MEMHEAP_SLAB_PAGE_ORDER))) {
+        return OSHMEM_ERROR;
+    }
+
+    offset = (unsigned char *) ptr - (unsigned char *) heap->symmetric_heap;
+    span = offset >> MEMHEAP_SLAB_SPAN_ORDER;
+    if ((span < heap->num_spans)
+            && (MEMHEAP_SLAB_NO_CLASS != heap->spans[span].size_class)) {
+        *size = slab_class_size[heap->spans[span].size_class];
+        return OSHMEM_SUCCESS;
+    }
+
+    rc = opal_hash_table_get_value_uint64(heap->symmetric_heap_hashtable,
+                                          (unsigned long) ptr,
+                                          &pages);
+    if (OPAL_SUCCESS != rc) {
+        return OSHMEM_ERROR;
+    }
+
+    *size = ((size_t) (unsigned long) pages) << MEMHEAP_SLAB_PAGE_ORDER;
+    return OSHMEM_SUCCESS;
+}
+
+static int slab_do_free(mca_memheap_slab_heap_t *heap, void *ptr)
+{
+    int rc;
+    size_t offset;
+    size_t span;
+    void *pages;
+
+    if (((unsigned char *) ptr < (unsigned char *) heap->symmetric_heap)
+            || ((unsigned char *) ptr >= (unsigned char *) heap->symmetric_heap
+                    + (heap->num_pages << MEMHEAP_SLAB_PAGE_ORDER))) {
+        return OSHMEM_ERROR;
+    }
+
+    offset = (unsigned char *) ptr - (unsigned char *) heap->symmetric_heap;
+    span = offset >> MEMHEAP_SLAB_SPAN_ORDER;
+    if ((span < heap->num_spans)
+            && (MEMHEAP_SLAB_NO_CLASS != heap->spans[span].size_class)) {
+        return slab_small_free(heap, span,
+                               offset & ((1UL << MEMHEAP_SLAB_SPAN_ORDER) - 1));
+    }
+
+    rc = opal_hash_table_get_value_uint64(heap->symmetric_heap_hashtable,
+                                          (unsigned long) ptr,
+                                          &pages);
+    if (OPAL_SUCCESS != rc) {
+        return OSHMEM_ERROR;
+    }
+
+    slab_range_free(heap, offset >> MEMHEAP_SLAB_PAGE_ORDER,
+                    (size_t) (unsigned long) pages);
+    opal_hash_table_remove_value_uint64(heap->symmetric_heap_hashtable,
+                                        (unsigned long) ptr);
+
+    return OSHMEM_SUCCESS;
+}
+
+/*
+ * Allocate size bytes aligned to align (a power of two) without taking
+ * the lock.
+ */
+static int slab_do_alloc(mca_memheap_slab_heap_t *heap,
+                         size_t size,
+                         size_t align,
+                         void **p_buff,
+                         size_t *p_size)
+{
+    int size_class;
+    unsigned min_order = 0;
+
+    if ((size <= MEMHEAP_SLAB_MAX_SMALL) && (align <= MEMHEAP_SLAB_MAX_SMALL)) {
+        /* objects are aligned to the largest power of two dividing their size */
+        size_class = slab_class_index[(size + 7) >> 3];
+        while ((size_class < MEMHEAP_SLAB_NUM_CLASSES)
+                && (slab_class_size[size_class] & (align - 1))) {
+            ++size_class;
+        }
+        if (size_class < MEMHEAP_SLAB_NUM_CLASSES) {
+            return slab_small_alloc(heap, size_class, p_buff, p_size);
+        }
+    }
+
+    if (align > (1UL << MEMHEAP_SLAB_PAGE_ORDER)) {
+        min_order = memheap_log2(align >> MEMHEAP_SLAB_PAGE_ORDER);
+    }
+
+    return slab_large_alloc(heap, size, min_order, p_buff, p_size);
+}
+
+static int _do_alloc(mca_memheap_slab_heap_t *heap,
+                     size_t size,
+                     size_t align,
+                     void **p_buff)
+{
+    int rc;
+    size_t usable = 0;
+
+    *p_buff = NULL;
+
+    OPAL_THREAD_LOCK(&memheap_slab.lock);
+    rc = slab_do_alloc(heap, size, align, p_buff, &usable);
+    OPAL_THREAD_UNLOCK(&memheap_slab.lock);
+
+    if (OSHMEM_SUCCESS != rc) {
+        *p_buff = NULL;
+        return rc;
+    }
+
+    MCA_SPML_CALL(memuse_hook(*p_buff, usable));
+    return OSHMEM_SUCCESS;
+}
+
+static int slab_heap_init(mca_memheap_slab_heap_t *heap,
+                          void *base,
+                          size_t size)
+{
+    unsigned i;
+
+    heap->symmetric_heap = base;
+    heap->num_pages = size >> MEMHEAP_SLAB_PAGE_ORDER;
+    if (0 == heap->num_pages) {
+        return OSHMEM_ERR_BAD_PARAM;
+    }
+    heap->max_order = slab_floor_order(heap->num_pages);
+    heap->num_spans = heap->num_pages >> MEMHEAP_SLAB_SPAN_PAGES_ORDER;
+
+    heap->symmetric_heap_hashtable = OBJ_NEW(opal_hash_table_t);
+    if (NULL == heap->symmetric_heap_hashtable) {
+        MEMHEAP_ERROR("Opal failed to allocate hashtable object");
+        return OSHMEM_ERROR;
+    }
+    opal_hash_table_init(heap->symmetric_heap_hashtable, DEFAULT_HASHTABLE_SIZE);
+
+    heap->free_blocks = (memheap_slab_bitmap_t **) calloc(heap->max_order + 1,
+                                                          sizeof(memheap_slab_bitmap_t *));
+    heap->spans = (mca_memheap_slab_span_t *) calloc(heap->num_spans + 1,
+                                                     sizeof(mca_memheap_slab_span_t));
+    if ((NULL == heap->free_blocks) || (NULL == heap->spans)) {
+        MEMHEAP_ERROR("Failed to allocate slab allocator");
+        return OSHMEM_ERROR;
+    }
+
+    for (i = 0; i <= heap->max_order; ++i) {
+        heap->free_blocks[i] = slab_bitmap_create(heap->num_pages >> i);
+        if (NULL == heap->free_blocks[i]) {
+            MEMHEAP_ERROR("Failed to allocate slab allocator");
+            return OSHMEM_ERROR;
+        }
+    }
+
+    for (i = 0; i < heap->num_spans; ++i) {
+        heap->spans[i].size_class = MEMHEAP_SLAB_NO_CLASS;
+    }
+
+    for (i = 0; i < MEMHEAP_SLAB_NUM_CLASSES; ++i) {
+        heap->partial[i] = slab_bitmap_create(heap->num_spans);
+        if (NULL == heap->partial[i]) {
+            MEMHEAP_ERROR("Failed to allocate slab allocator");
+            return OSHMEM_ERROR;
+        }
+    }
+
+    slab_range_free(heap, 0, heap->num_pages);
+
+    MEMHEAP_VERBOSE(5,
+                    "heap %p: %llu pages, max order %u, %llu spans",
+                    base, (unsigned long long) heap->num_pages,
+                    heap->max_order, (unsigned long long) heap->num_spans);
+
+    return OSHMEM_SUCCESS;
+}
+
+static void slab_heap_cleanup(mca_memheap_slab_heap_t *heap)
+{
+    size_t i;
+
+    if (NULL != heap->spans) {
+        for (i = 0; i < heap->num_spans; ++i) {
+            if (NULL != heap->spans[i].objects) {
+                slab_bitmap_destroy(heap->spans[i].objects);
+            }
+        }
+        free(heap->spans);
+        heap->spans = NULL;
+    }
+
+    for (i = 0; i < MEMHEAP_SLAB_NUM_CLASSES; ++i) {
+        if (NULL != heap->partial[i]) {
+            slab_bitmap_destroy(heap->partial[i]);
+            heap->partial[i] = NULL;
+        }
+    }
+
+    if (NULL != heap->free_blocks) {
+        for (i = 0; i <= heap->max_order; ++i) {
+            if (NULL != heap->free_blocks[i]) {
+                slab_bitmap_destroy(heap->free_blocks[i]);
+            }
+        }
+        free(heap->free_blocks);
+        heap->free_blocks = NULL;
+    }
+
+    if (NULL != heap->symmetric_heap_hashtable) {
+        OBJ_RELEASE(heap->symmetric_heap_hashtable);
+        heap->symmetric_heap_hashtable = NULL;
+    }
+}
+
+/**
+ * Initialize the Memory Heap
+ */
+int mca_memheap_slab_module_init(memheap_context_t *context)
+{
+    size_t i;
+    int size_class = 0;
+
+    if (!context || !context->user_size || !context->private_size) {
+        return OSHMEM_ERR_BAD_PARAM;
+    }
+
+    OBJ_CONSTRUCT(&memheap_slab.lock, opal_mutex_t);
+    memheap_slab.super.memheap_size = context->user_size;
+
+    for (i = 0; i <= (MEMHEAP_SLAB_MAX_SMALL >> 3); ++i) {
+        while (slab_class_size[size_class] < (i << 3)) {
+            ++size_class;
+        }
+        slab_class_index[i] = size_class;
+    }
+
+    if ((OSHMEM_SUCCESS != slab_heap_init(&memheap_slab.heap,
+                                          context->user_base_addr,
+                                          context->user_size))
+            || (OSHMEM_SUCCESS != slab_heap_init(&memheap_slab.private_heap,
+                                                 context->private_base_addr,
+                                                 context->private_size))) {
+        MEMHEAP_ERROR("Failed to setup MEMHEAP slab allocator");
+        mca_memheap_slab_finalize();
+        return OSHMEM_ERROR;
+    }
+
+    MEMHEAP_VERBOSE(1,
+                    "symmetric heap memory (user+private): %llu bytes",
+                    (unsigned long long)(context->user_size + context->private_size));
+
+    return OSHMEM_SUCCESS;
+}
+
+int mca_memheap_slab_alloc(size_t size, void** p_buff)
+{
+    return _do_alloc(&memheap_slab.heap, size, 1, p_buff);
+}
+
+int mca_memheap_slab_private_alloc(size_t size, void** p_buff)
+{
+    int status;
+
+    status = _do_alloc(&memheap_slab.private_heap, size, 1, p_buff);
+
+    MEMHEAP_VERBOSE(20, "private alloc addr: %p", *p_buff);
+
+    return status;
+}
+
+int mca_memheap_slab_align(size_t align, size_t size, void **p_buff)
+{
+    /* check that align is a non zero power of 2 */
+    if ((0 == align) || (align & (align - 1))) {
+        *p_buff = NULL;
+        return OSHMEM_ERROR;
+    }
+
+    return _do_alloc(&memheap_slab.heap, size, align, p_buff);
+}
+
+int mca_memheap_slab_realloc(size_t new_size, void *p_buff, void **p_new_buff)
+{
+    int rc;
+    size_t old_size;
+    size_t usable = 0;
+
+    /* equiv to alloc if old ptr is null */
+    if (NULL == p_buff) {
+        return mca_memheap_slab_alloc(new_size, p_new_buff);
+    }
+
+    /* equiv to free if new_size is 0 */
+    if (0 == new_size) {
+        *p_new_buff = NULL;
+        return mca_memheap_slab_free(p_buff);
+    }
+
+    OPAL_THREAD_LOCK(&memheap_slab.lock);
+    rc = slab_block_size(&memheap_slab.heap, p_buff, &old_size);
+    if (OSHMEM_SUCCESS != rc) {
+        OPAL_THREAD_UNLOCK(&memheap_slab.lock);
+        *p_new_buff = NULL;
+        return rc;
+    }
+
+    /* do nothing if the block is already large enough */
+    if (new_size <= old_size) {
+        OPAL_THREAD_UNLOCK(&memheap_slab.lock);
+        *p_new_buff = p_buff;
+        return OSHMEM_SUCCESS;
+    }
+
+    /* alloc and copy data to new buffer, free old one */
+    rc = slab_do_alloc(&memheap_slab.heap, new_size, 1, p_new_buff, &usable);
+    if (OSHMEM_SUCCESS != rc) {
+        OPAL_THREAD_UNLOCK(&memheap_slab.lock);
+        *p_new_buff = NULL;
+        return rc;
+    }
+
+    memcpy(*p_new_buff, p_buff, old_size);
+    slab_do_free(&memheap_slab.heap, p_buff);
+    OPAL_THREAD_UNLOCK(&memheap_slab.lock);
+
+    MCA_SPML_CALL(memuse_hook(*p_new_buff, usable));
+    return OSHMEM_SUCCESS;
+}
+
+/*
+ * Free a variable allocated on the
+ * symmetric heap.
+ */
+int mca_memheap_slab_free(void* ptr)
+{
+    int rc;
+
+    OPAL_THREAD_LOCK(&memheap_slab.lock);
+    rc = slab_do_free(&memheap_slab.heap, ptr);
+    OPAL_THREAD_UNLOCK(&memheap_slab.lock);
+
+    return rc;
+}
+
+int mca_memheap_slab_private_free(void* ptr)
+{
+    int rc;
+
+    if (NULL == ptr) {
+        return OSHMEM_SUCCESS;
+    }
+
+    OPAL_THREAD_LOCK(&memheap_slab.lock);
+    rc = slab_do_free(&memheap_slab.private_heap, ptr);
+    OPAL_THREAD_UNLOCK(&memheap_slab.lock);
+
+    return rc;
+}
+
+int mca_memheap_slab_finalize()
+{
+    MEMHEAP_VERBOSE(5, "deregistering symmetric heap");
+
+    /* was not initialized - do nothing */
+    if (0 == memheap_slab.super.memheap_size) {
+        return OSHMEM_SUCCESS;
+    }
+
+    slab_heap_cleanup(&memheap_slab.heap);
+    slab_heap_cleanup(&memheap_slab.private_heap);
+    OBJ_DESTRUCT(&memheap_slab.lock);
+    memheap_slab.super.memheap_size = 0;
+
+    return OSHMEM_SUCCESS;
+}
@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2026      NVIDIA Corporation.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+/**
+ * @file
+ * Size-class allocator for the symmetric heap.
+ *
+ * Small requests are served from 64KB spans carved into objects of a
+ * single size class, larger ones from a binary buddy over 4KB pages
+ * whose unused tail is returned to the free lists right away. All free
+ * lists are hierarchical bitmaps searched with word-level bit scans and
+ * every search returns the lowest free address, so PEs issuing the same
+ * sequence of calls get the same offsets without communicating.
+ */
+#ifndef MCA_MEMHEAP_SLAB_H
+#define MCA_MEMHEAP_SLAB_H
+
+#include "oshmem_config.h"
+#include "oshmem/mca/mca.h"
+#include "opal/mca/threads/mutex.h"
+#include "oshmem/mca/memheap/memheap.h"
+#include "oshmem/mca/memheap/base/base.h"
+#include "oshmem/mca/spml/spml.h"
+#include "oshmem/util/oshmem_util.h"
+#include "opal/class/opal_hash_table.h"
+#include <string.h>
+#include <sys/types.h>
+
+#define MEMHEAP_SLAB_PAGE_ORDER          12  /* granularity of large allocations */
+#define MEMHEAP_SLAB_SPAN_ORDER          16  /* size of a span of small objects */
+#define MEMHEAP_SLAB_SPAN_PAGES_ORDER    (MEMHEAP_SLAB_SPAN_ORDER - MEMHEAP_SLAB_PAGE_ORDER)
+#define MEMHEAP_SLAB_MAX_SMALL           2048
+#define MEMHEAP_SLAB_NUM_CLASSES         25
+#define MEMHEAP_SLAB_BITMAP_MAX_LEVELS   6
+#define MEMHEAP_SLAB_NO_CLASS            (-1)
+#define DEFAULT_HASHTABLE_SIZE           100
+
+BEGIN_C_DECLS
+
+/**
+ * Bitmap with one summary level per 64 bits of the level below: a bit
+ * of level l+1 is set when the corresponding word of level l is non
+ * zero. Searching for the first set bit touches one word per level.
+ */
+struct memheap_slab_bitmap_t {
+    size_t nbits;
+    unsigned levels;
+    uint64_t *level[MEMHEAP_SLAB_BITMAP_MAX_LEVELS]; /** level[0] holds one bit per item */
+};
+typedef struct memheap_slab_bitmap_t memheap_slab_bitmap_t;
+
+/* Out of band descriptor of a 64KB span of the heap */
+struct mca_memheap_slab_span_t {
+    int16_t size_class; /** Size class of the objects or MEMHEAP_SLAB_NO_CLASS */
+    uint16_t num_free; /** Free objects left in the span */
+    memheap_slab_bitmap_t *objects; /** Free objects of the span */
+};
+typedef struct mca_memheap_slab_span_t mca_memheap_slab_span_t;
+
+struct mca_memheap_slab_heap_t {
+    void* symmetric_heap; /** Symmetric Heap */
+    size_t num_pages; /** Heap size in pages */
+    unsigned max_order; /** Log2 of the largest block in pages */
+    memheap_slab_bitmap_t **free_blocks; /** Free buddy blocks, one bitmap per order */
+    size_t num_spans;
+    mca_memheap_slab_span_t *spans;
+    memheap_slab_bitmap_t *partial[MEMHEAP_SLAB_NUM_CLASSES]; /** Spans with free objects */
+    opal_hash_table_t* symmetric_heap_hashtable; /** Size in pages of large allocations */
+};
+typedef struct mca_memheap_slab_heap_t mca_memheap_slab_heap_t;
+
+/* Structure for managing shmem symmetric heap */
+struct mca_memheap_slab_module_t {
+    mca_memheap_base_module_t super;
+
+    int priority; /** Module's Priority */
+    mca_memheap_slab_heap_t heap;
+    mca_memheap_slab_heap_t private_heap;
+    opal_mutex_t lock;
+};
+typedef struct mca_memheap_slab_module_t mca_memheap_slab_module_t;
+OSHMEM_DECLSPEC extern mca_memheap_slab_module_t memheap_slab;
+
+OSHMEM_DECLSPEC extern int mca_memheap_slab_module_init(memheap_context_t *);
+OSHMEM_DECLSPEC extern int mca_memheap_slab_alloc(size_t, void**);
+OSHMEM_DECLSPEC extern int mca_memheap_slab_realloc(size_t, void*, void **);
+OSHMEM_DECLSPEC extern int mca_memheap_slab_align(size_t, size_t, void**);
+OSHMEM_DECLSPEC extern int mca_memheap_slab_free(void*);
+OSHMEM_DECLSPEC extern int mca_memheap_slab_finalize(void);
+
+/* private alloc/free functions */
+OSHMEM_DECLSPEC extern int mca_memheap_slab_private_alloc(size_t, void**);
+OSHMEM_DECLSPEC extern int mca_memheap_slab_private_free(void*);
+
+END_C_DECLS
+
+#endif /* MCA_MEMHEAP_SLAB_H */
@@ -36,7 +36,7 @@ OSHMEM_DECLSPEC int mca_scoll_base_find_available(bool enable_progress_threads,
 
 OSHMEM_DECLSPEC int mca_scoll_base_select(struct oshmem_group_t *group);
 
-int mca_scoll_base_group_unselect(struct oshmem_group_t *group);
+OSHMEM_DECLSPEC int mca_scoll_base_group_unselect(struct oshmem_group_t *group);
 
 OSHMEM_DECLSPEC int mca_scoll_enable(void);
 
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026      NVIDIA Corporation.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+#ifndef MCA_SCOLL_SM_H
+#define MCA_SCOLL_SM_H
+
+#include "oshmem_config.h"
+
+#include "opal/sys/atomic.h"
+#include "opal/runtime/opal_progress.h"
+
+#include "oshmem/mca/mca.h"
+#include "oshmem/mca/scoll/scoll.h"
+#include "oshmem/mca/spml/spml.h"
+#include "oshmem/util/oshmem_util.h"
+#include "oshmem/proc/proc.h"
+
+BEGIN_C_DECLS
+
+/**
+ * Globally exported structure
+ *
+ * Every PE owns a control block in the private symmetric heap made of
+ * two arrays of cache lines indexed by the rank of a PE on its node:
+ * the arrival lines are written by the members of the groups this PE
+ * leads, the release lines by the leaders of the groups it belongs to.
+ * Each line carries a counter that is kept per pair of PEs, so that a
+ * stale value left by a previous collective on another group can never
+ * satisfy a wait.
+ */
+struct mca_scoll_sm_component_t {
+    /** Base coll component */
+    mca_scoll_base_component_1_0_0_t super;
+
+    /** MCA parameter: Priority of this component */
+    int sm_priority;
+
+    /** MCA parameter: Enable shared memory collectives */
+    int sm_enable;
+
+    /* Node layout of the job, set up by the first query */
+    bool      initialized;
+    int       init_status;
+    uint32_t *node_ids;       /* node of every PE */
+    int      *local_ranks;    /* rank of every PE on its node */
+    int       num_nodes;
+    int       max_local;      /* largest number of PEs on a node */
+    size_t    line_size;
+    char     *ctl;            /* control block of this PE */
+    uint64_t *arrive_seq;     /* arrivals signaled to each local leader */
+    uint64_t *arrive_expect;  /* arrivals expected from each local member */
+    uint64_t *release_seq;    /* releases signaled to each local member */
+    uint64_t *release_expect; /* releases expected from each local leader */
+};
+typedef struct mca_scoll_sm_component_t mca_scoll_sm_component_t;
+
+OSHMEM_DECLSPEC extern mca_scoll_sm_component_t mca_scoll_sm_component;
+
+/**
+ * Group hierarchy: the members of the group on this node, the first
+ * of them (lowest PE) being the node leader, and the group of all node
+ * leaders used for the inter-node phase.
+ */
+struct mca_scoll_sm_module_t {
+    mca_scoll_base_module_t super;
+
+    int             my_rank;       /* rank of this PE on the node */
+    int             local_count;   /* members of the group on this node */
+    int            *local_pes;     /* leader first */
+    char          **local_ctl;     /* control blocks of the local members */
+    int             leader;
+    int             n_leaders;
+    int            *leader_pes;
+    oshmem_group_t *leaders;       /* NULL if not a leader or single node */
+
+    /* Saved handlers - for fallback */
+    mca_scoll_base_module_reduce_fn_t previous_reduce;
+    mca_scoll_base_module_t *previous_reduce_module;
+    mca_scoll_base_module_broadcast_fn_t previous_broadcast;
+    mca_scoll_base_module_t *previous_broadcast_module;
+    mca_scoll_base_module_barrier_fn_t previous_barrier;
+    mca_scoll_base_module_t *previous_barrier_module;
+};
+typedef struct mca_scoll_sm_module_t mca_scoll_sm_module_t;
+
+OBJ_CLASS_DECLARATION(mca_scoll_sm_module_t);
+
+/* API functions */
+
+int mca_scoll_sm_init(bool enable_progress_threads, bool enable_threads);
+mca_scoll_base_module_t*
+mca_scoll_sm_query(struct oshmem_group_t *group, int *priority);
+void mca_scoll_sm_ctl_fini(void);
+
+void *mca_scoll_sm_ptr(const void *va, int pe);
+
+int mca_scoll_sm_barrier(struct oshmem_group_t *group, long *pSync, int alg);
+int mca_scoll_sm_broadcast(struct oshmem_group_t *group,
+                           int PE_root,
+                           void *target,
+                           const void *source,
+                           size_t nlong,
+                           long *pSync,
+                           bool nlong_type,
+                           int alg);
+int mca_scoll_sm_reduce(struct oshmem_group_t *group,
+                        struct oshmem_op_t *op,
+                        void *target,
+                        const void *source,
+                        size_t nlong,
+                        long *pSync,
+                        void *pWrk,
+                        int alg);
+
+static inline volatile uint64_t *scoll_sm_arrive_flag(char *ctl, int rank)
+{
+    return (volatile uint64_t *)(ctl + (size_t)rank *
+                                 mca_scoll_sm_component.line_size);
+}
+
+static inline volatile uint64_t *scoll_sm_release_flag(char *ctl, int rank)
+{
+    return (volatile uint64_t *)(ctl + (size_t)(mca_scoll_sm_component.max_local + rank) *
+                                 mca_scoll_sm_component.line_size);
+}
+
+static inline void scoll_sm_wait_flag(volatile uint64_t *flag, uint64_t value)
+{
+    while (*flag < value) {
+        opal_progress();
+    }
+    opal_atomic_rmb();
+}
+
+/* Member side: notify the leader, all previous accesses are complete */
+static inline void scoll_sm_signal_leader(mca_scoll_sm_module_t *module)
+{
+    mca_scoll_sm_component_t *cm = &mca_scoll_sm_component;
+    int leader_rank = cm->local_ranks[module->leader];
+
+    opal_atomic_mb();
+    *scoll_sm_arrive_flag(module->local_ctl[0], module->my_rank) =
+        ++cm->arrive_seq[leader_rank];
+}
+
+/* Member side: wait until the leader releases us */
+static inline void scoll_sm_wait_leader(mca_scoll_sm_module_t *module)
+{
+    mca_scoll_sm_component_t *cm = &mca_scoll_sm_component;
+    int leader_rank = cm->local_ranks[module->leader];
+
+    scoll_sm_wait_flag(scoll_sm_release_flag(cm->ctl, leader_rank),
+                       ++cm->release_expect[leader_rank]);
+}
+
+/* Leader side: wait for the i-th local member of the group */
+static inline void scoll_sm_wait_member(mca_scoll_sm_module_t *module, int i)
+{
+    mca_scoll_sm_component_t *cm = &mca_scoll_sm_component;
+    int rank = cm->local_ranks[module->local_pes[i]];
+
+    scoll_sm_wait_flag(scoll_sm_arrive_flag(cm->ctl, rank),
+                       ++cm->arrive_expect[rank]);
+}
+
+/* Leader side: release the i-th local member of the group */
+static inline void scoll_sm_release_member(mca_scoll_sm_module_t *module, int i)
+{
+    mca_scoll_sm_component_t *cm = &mca_scoll_sm_component;
+    int rank = cm->local_ranks[module->local_pes[i]];
+
+    opal_atomic_wmb();
+    *scoll_sm_release_flag(module->local_ctl[i], module->my_rank) =
+        ++cm->release_seq[rank];
+}
+
+/* Copy size bytes of the symmetric object va from the local PE pe */
+static inline int scoll_sm_copy_from(void *dst, const void *va, size_t size, int pe)
+{
+    void *ptr = mca_scoll_sm_ptr(va, pe);
+
+    if (OPAL_LIKELY(NULL != ptr)) {
+        memcpy(dst, ptr, size);
+        return OSHMEM_SUCCESS;
+    }
+    return MCA_SPML_CALL(get(oshmem_ctx_default, (void *)va, size, dst, pe));
+}
+
+END_C_DECLS
+
+#endif /* MCA_SCOLL_SM_H */
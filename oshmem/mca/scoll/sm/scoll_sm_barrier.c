@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026      NVIDIA Corporation.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+#include "oshmem_config.h"
+
+#include "oshmem/constants.h"
+#include "oshmem/mca/spml/spml.h"
+#include "oshmem/mca/scoll/scoll.h"
+#include "oshmem/mca/scoll/base/base.h"
+#include "scoll_sm.h"
+
+/*
+ * Members signal their arrival to the node leader, the leaders run a
+ * barrier among themselves and then release the members of their node.
+ */
+int mca_scoll_sm_barrier(struct oshmem_group_t *group, long *pSync, int alg)
+{
+    mca_scoll_sm_module_t *sm_module;
+    int rc = OSHMEM_SUCCESS;
+    int i;
+
+    sm_module = (mca_scoll_sm_module_t *) group->g_scoll.scoll_barrier_module;
+
+    SCOLL_VERBOSE(12, "[#%d] Barrier: %d local PEs, %d nodes",
+                  group->my_pe, sm_module->local_count, sm_module->n_leaders);
+
+    /* remote updates issued before the barrier must be complete */
+    MCA_SPML_CALL(quiet(oshmem_ctx_default));
+
+    if (sm_module->leader != group->my_pe) {
+        scoll_sm_signal_leader(sm_module);
+        scoll_sm_wait_leader(sm_module);
+        return OSHMEM_SUCCESS;
+    }
+
+    for (i = 1; i < sm_module->local_count; i++) {
+        scoll_sm_wait_member(sm_module, i);
+    }
+
+    if (NULL != sm_module->leaders) {
+        rc = sm_module->leaders->g_scoll.scoll_barrier(sm_module->leaders,
+                                                       pSync, alg);
+    }
+
+    for (i = 1; i < sm_module->local_count; i++) {
+        scoll_sm_release_member(sm_module, i);
+    }
+
+    return rc;
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026      NVIDIA Corporation.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+#include "oshmem_config.h"
+
+#include "oshmem/constants.h"
+#include "oshmem/mca/spml/spml.h"
+#include "oshmem/mca/scoll/scoll.h"
+#include "oshmem/mca/scoll/base/base.h"
+#include "scoll_sm.h"
+
+/*
+ * The leader of the root node fetches the data from the root, the
+ * leaders broadcast it among themselves into their target and the
+ * members of every node copy it from their leader. The leader returns
+ * once all its members are done reading, as its buffer may be reused
+ * right after.
+ */
+int mca_scoll_sm_broadcast(struct oshmem_group_t *group,
+                           int PE_root,
+                           void *target,
+                           const void *source,
+                           size_t nlong,
+                           long *pSync,
+                           bool nlong_type,
+                           int alg)
+{
+    mca_scoll_sm_component_t *cm = &mca_scoll_sm_component;
+    mca_scoll_sm_module_t *sm_module;
+    const void *data;
+    bool root_local;
+    int root_id = 0;
+    int rc = OSHMEM_SUCCESS;
+    int i;
+
+    sm_module = (mca_scoll_sm_module_t *) group->g_scoll.scoll_broadcast_module;
+
+    /* members need the size to copy the data from their leader */
+    if (OPAL_UNLIKELY(!nlong_type)) {
+        PREVIOUS_SCOLL_FN(sm_module, broadcast, group,
+                PE_root,
+                target,
+                source,
+                nlong,
+                pSync,
+                nlong_type,
+                alg);
+        return rc;
+    }
+
+    /* Do nothing on zero-length request */
+    if (OPAL_UNLIKELY(!nlong)) {
+        return OSHMEM_SUCCESS;
+    }
+
+    SCOLL_VERBOSE(12, "[#%d] Broadcast from #%d: %d local PEs, %d nodes",
+                  group->my_pe, PE_root, sm_module->local_count,
+                  sm_module->n_leaders);
+
+    root_local = (cm->node_ids[PE_root] == cm->node_ids[group->my_pe]);
+
+    if (sm_module->leader != group->my_pe) {
+        if (PE_root == group->my_pe) {
+            /* the leader reads our source before releasing us */
+            scoll_sm_signal_leader(sm_module);
+            scoll_sm_wait_leader(sm_module);
+            return OSHMEM_SUCCESS;
+        }
+
+        scoll_sm_wait_leader(sm_module);
+        data = (sm_module->leader == PE_root) ? source : target;
+        rc = scoll_sm_copy_from(target, data, nlong, sm_module->leader);
+        scoll_sm_signal_leader(sm_module);
+        return rc;
+    }
+
+    data = target;
+    if (sm_module->leader == PE_root) {
+        data = source;
+    } else if (root_local) {
+        for (i = 1; sm_module->local_pes[i] != PE_root; i++);
+        scoll_sm_wait_member(sm_module, i);
+        rc = scoll_sm_copy_from(target, source, nlong, PE_root);
+    }
+
+    if ((OSHMEM_SUCCESS == rc) && (NULL != sm_module->leaders)) {
+        for (i = 0; i < sm_module->n_leaders; i++) {
+            if (cm->node_ids[sm_module->leader_pes[i]] == cm->node_ids[PE_root]) {
+                root_id = i;
+                break;
+            }
+        }
+
+        rc = sm_module->leaders->g_scoll.scoll_broadcast(sm_module->leaders,
+                sm_module->leader_pes[root_id],
+                target,
+                data,
+                nlong,
+                pSync,
+                nlong_type,
+                alg);
+    }
+
+    for (i = 1; i < sm_module->local_count; i++) {
+        scoll_sm_release_member(sm_module, i);
+    }
+
+    for (i = 1; i < sm_module->local_count; i++) {
+        if (sm_module->local_pes[i] != PE_root) {
+            scoll_sm_wait_member(sm_module, i);
+        }
+    }
+
+    return rc;
+}
@@ -0,0 +1,95 @@
+/* -*- Mode: C; c-basic-offset:4 ; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2026      NVIDIA Corporation.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+#include "oshmem_config.h"
+
+#include "oshmem/constants.h"
+#include "oshmem/mca/scoll/scoll.h"
+#include "oshmem/mca/scoll/base/base.h"
+#include "scoll_sm.h"
+
+/*
+ * Public string showing the scoll sm component version number
+ */
+const char *mca_scoll_sm_component_version_string =
+"Open SHMEM sm collective MCA component version " OSHMEM_VERSION;
+
+/*
+ * Local function
+ */
+static int sm_register(void);
+static int sm_close(void);
+
+/*
+ * Instantiate the public struct with all of our public information
+ * and pointers to our public functions in it
+ */
+
+mca_scoll_sm_component_t mca_scoll_sm_component = {
+
+    /* First, the mca_component_t struct containing meta information
+       about the component itself */
+    .super = {
+        .scoll_version = {
+            MCA_SCOLL_BASE_VERSION_2_0_0,
+
+            /* Component name and version */
+            .mca_component_name = "sm",
+            MCA_BASE_MAKE_VERSION(component, OSHMEM_MAJOR_VERSION, OSHMEM_MINOR_VERSION,
+                                  OSHMEM_RELEASE_VERSION),
+
+            /* Component open and close functions */
+            .mca_close_component = sm_close,
+            .mca_register_component_params = sm_register,
+        },
+        .scoll_data = {
+            /* The component is checkpoint ready */
+            MCA_BASE_METADATA_PARAM_CHECKPOINT
+        },
+
+        /* Initialization / querying functions */
+
+        .scoll_init = mca_scoll_sm_init,
+        .scoll_query = mca_scoll_sm_query,
+    },
+    .sm_priority = 85,
+    .sm_enable = 1,
+};
+MCA_BASE_COMPONENT_INIT(oshmem, scoll, sm)
+
+static int sm_register(void)
+{
+    mca_base_component_t *comp = &mca_scoll_sm_component.super.scoll_version;
+
+    (void) mca_base_component_var_register(comp,
+                                           "priority",
+                                           "Priority of the scoll:sm component",
+                                           MCA_BASE_VAR_TYPE_INT, NULL, 0, MCA_BASE_VAR_FLAG_SETTABLE,
+                                           OPAL_INFO_LVL_9,
+                                           MCA_BASE_VAR_SCOPE_READONLY,
+                                           &mca_scoll_sm_component.sm_priority);
+
+    (void) mca_base_component_var_register(comp,
+                                           "enable",
+                                           "[1|0|] Enable/Disable the shared memory phase of "
+                                           "barrier, broadcast and reduce",
+                                           MCA_BASE_VAR_TYPE_INT, NULL, 0, MCA_BASE_VAR_FLAG_SETTABLE,
+                                           OPAL_INFO_LVL_9,
+                                           MCA_BASE_VAR_SCOPE_READONLY,
+                                           &mca_scoll_sm_component.sm_enable);
+
+    return OSHMEM_SUCCESS;
+}
+
+static int sm_close(void)
+{
+    mca_scoll_sm_ctl_fini();
+    return OSHMEM_SUCCESS;
+}
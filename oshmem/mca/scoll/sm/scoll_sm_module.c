@@ -0,0 +1,427 @@
+/*
+ * Copyright (c) 2026      NVIDIA Corporation.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+#include "oshmem_config.h"
+#include <stdio.h>
+
+#include "opal/runtime/opal.h"
+#include "opal/mca/pmix/pmix-internal.h"
+
+#include "ompi/communicator/communicator.h"
+
+#include "oshmem/constants.h"
+#include "oshmem/mca/scoll/scoll.h"
+#include "oshmem/mca/scoll/base/base.h"
+#include "oshmem/mca/memheap/memheap.h"
+#include "oshmem/mca/memheap/base/base.h"
+#include "scoll_sm.h"
+
+/*
+ * Initial query function that is invoked during initialization, allowing
+ * this module to indicate what level of thread support it provides.
+ */
+int mca_scoll_sm_init(bool enable_progress_threads, bool enable_threads)
+{
+    /* The control block needs the memheap, it is set up by the first query */
+    return OSHMEM_SUCCESS;
+}
+
+/*
+ * Find the node of every PE, allocate the control block and check that
+ * the control blocks of the other PEs of the node are mapped
+ */
+static int mca_scoll_sm_ctl_setup(void)
+{
+    mca_scoll_sm_component_t *cm = &mca_scoll_sm_component;
+    opal_process_name_t name;
+    uint32_t node_id, *pnode_id = &node_id;
+    int *node_count = NULL;
+    int npes = oshmem_num_procs();
+    int my_pe = oshmem_my_proc_id();
+    void *ptr = NULL;
+    size_t size;
+    int i, rc;
+
+    cm->node_ids    = (uint32_t *) malloc(npes * sizeof(*cm->node_ids));
+    cm->local_ranks = (int *) malloc(npes * sizeof(*cm->local_ranks));
+    if ((NULL == cm->node_ids) || (NULL == cm->local_ranks)) {
+        return OSHMEM_ERR_OUT_OF_RESOURCE;
+    }
+
+    cm->num_nodes = 0;
+    name.jobid = OMPI_PROC_MY_NAME->jobid;
+    for (i = 0; i < npes; i++) {
+        name.vpid = i;
+        OPAL_MODEX_RECV_VALUE_OPTIONAL(rc, PMIX_NODEID, &name, &pnode_id, PMIX_UINT32);
+        if (PMIX_SUCCESS != rc) {
+            SCOLL_VERBOSE(5, "unable to get the node of PE %d", i);
+            return OSHMEM_ERROR;
+        }
+        cm->node_ids[i] = node_id;
+        if ((int)node_id >= cm->num_nodes) {
+            cm->num_nodes = (int)node_id + 1;
+        }
+    }
+
+    node_count = (int *) calloc(cm->num_nodes, sizeof(*node_count));
+    if (NULL == node_count) {
+        return OSHMEM_ERR_OUT_OF_RESOURCE;
+    }
+
+    cm->max_local = 0;
+    for (i = 0; i < npes; i++) {
+        cm->local_ranks[i] = node_count[cm->node_ids[i]]++;
+        if (node_count[cm->node_ids[i]] > cm->max_local) {
+            cm->max_local = node_count[cm->node_ids[i]];
+        }
+    }
+    free(node_count);
+
+    /* max_local is the same on all PEs, so is the size of the block */
+    cm->line_size = (size_t)opal_cache_line_size;
+    size = 2 * cm->max_local * cm->line_size;
+    rc = MCA_MEMHEAP_CALL(private_alloc(size, &ptr));
+    if (OSHMEM_SUCCESS != rc) {
+        SCOLL_VERBOSE(5, "failed to allocate %zu bytes of control block", size);
+        return rc;
+    }
+    cm->ctl = (char *) ptr;
+    memset(cm->ctl, 0, size);
+
+    cm->arrive_seq     = (uint64_t *) calloc(cm->max_local, sizeof(uint64_t));
+    cm->arrive_expect  = (uint64_t *) calloc(cm->max_local, sizeof(uint64_t));
+    cm->release_seq    = (uint64_t *) calloc(cm->max_local, sizeof(uint64_t));
+    cm->release_expect = (uint64_t *) calloc(cm->max_local, sizeof(uint64_t));
+    if ((NULL == cm->arrive_seq) || (NULL == cm->arrive_expect) ||
+        (NULL == cm->release_seq) || (NULL == cm->release_expect)) {
+        return OSHMEM_ERR_OUT_OF_RESOURCE;
+    }
+
+    for (i = 0; i < npes; i++) {
+        if ((cm->node_ids[i] == cm->node_ids[my_pe]) &&
+            (NULL == mca_scoll_sm_ptr(cm->ctl, i))) {
+            SCOLL_VERBOSE(5, "control block of PE %d is not mapped", i);
+            return OSHMEM_ERROR;
+        }
+    }
+
+    return OSHMEM_SUCCESS;
+}
+
+/*
+ * Set up the control block. This is called by the first query, which is
+ * done for oshmem_group_all by every PE, so the private heap allocation
+ * stays symmetric. The result is agreed on by all the PEs: a PE which
+ * could not map the control block of a local peer disables the component
+ * everywhere, instead of leaving the PEs with different scoll modules.
+ */
+static int mca_scoll_sm_ctl_init(void)
+{
+    mca_scoll_sm_component_t *cm = &mca_scoll_sm_component;
+    ompi_communicator_t *comm = &ompi_mpi_comm_world.comm;
+    int ok, rc;
+
+    if (cm->initialized) {
+        return cm->init_status;
+    }
+    cm->initialized = true;
+
+    ok = (OSHMEM_SUCCESS == mca_scoll_sm_ctl_setup());
+    rc = comm->c_coll->coll_allreduce(MPI_IN_PLACE, &ok, 1, MPI_INT, MPI_MIN,
+                                      comm, comm->c_coll->coll_allreduce_module);
+    if ((OMPI_SUCCESS != rc) || !ok) {
+        SCOLL_VERBOSE(5, "shared memory collectives are disabled on all PEs");
+        cm->init_status = OSHMEM_ERROR;
+    } else {
+        cm->init_status = OSHMEM_SUCCESS;
+    }
+
+    return cm->init_status;
+}
+
+void mca_scoll_sm_ctl_fini(void)
+{
+    mca_scoll_sm_component_t *cm = &mca_scoll_sm_component;
+
+    if (NULL != cm->ctl) {
+        MCA_MEMHEAP_CALL(private_free(cm->ctl));
+        cm->ctl = NULL;
+    }
+
+    free(cm->node_ids);
+    free(cm->local_ranks);
+    free(cm->arrive_seq);
+    free(cm->arrive_expect);
+    free(cm->release_seq);
+    free(cm->release_expect);
+    cm->node_ids       = NULL;
+    cm->local_ranks    = NULL;
+    cm->arrive_seq     = NULL;
+    cm->arrive_expect  = NULL;
+    cm->release_seq    = NULL;
+    cm->release_expect = NULL;
+    cm->initialized    = false;
+}
+
+/*
+ * Address of the symmetric object va of the local PE pe in our address
+ * space, or NULL if the segment is not mapped
+ */
+void *mca_scoll_sm_ptr(const void *va, int pe)
+{
+    sshmem_mkey_t *mkey;
+    void *rva;
+    int i;
+
+    if (pe == oshmem_my_proc_id()) {
+        return (void *)va;
+    }
+
+    for (i = 0; i < mca_memheap_base_num_transports(); i++) {
+        mkey = mca_memheap_base_get_cached_mkey(oshmem_ctx_default, pe,
+                                                (void *)va, i, &rva);
+        if (NULL == mkey) {
+            continue;
+        }
+
+        if (mca_memheap_base_mkey_is_shm(mkey)) {
+            return rva;
+        }
+
+        rva = MCA_SPML_CALL(rmkey_ptr(va, mkey, pe));
+        if (NULL != rva) {
+            return rva;
+        }
+    }
+
+    return NULL;
+}
+
+static void mca_scoll_sm_module_construct(mca_scoll_sm_module_t *sm_module)
+{
+    sm_module->local_count = 0;
+    sm_module->local_pes   = NULL;
+    sm_module->local_ctl   = NULL;
+    sm_module->n_leaders   = 0;
+    sm_module->leader_pes  = NULL;
+    sm_module->leaders     = NULL;
+    sm_module->previous_barrier          = NULL;
+    sm_module->previous_barrier_module   = NULL;
+    sm_module->previous_broadcast        = NULL;
+    sm_module->previous_broadcast_module = NULL;
+    sm_module->previous_reduce           = NULL;
+    sm_module->previous_reduce_module    = NULL;
+}
+
+static void mca_scoll_sm_module_destruct(mca_scoll_sm_module_t *sm_module)
+{
+    if (NULL != sm_module->leaders) {
+        mca_scoll_base_group_unselect(sm_module->leaders);
+        free(sm_module->leaders->proc_vpids);
+        OBJ_RELEASE(sm_module->leaders);
+    }
+
+    if (NULL != sm_module->previous_barrier_module) {
+        OBJ_RELEASE(sm_module->previous_barrier_module);
+    }
+    if (NULL != sm_module->previous_broadcast_module) {
+        OBJ_RELEASE(sm_module->previous_broadcast_module);
+    }
+    if (NULL != sm_module->previous_reduce_module) {
+        OBJ_RELEASE(sm_module->previous_reduce_module);
+    }
+
+    free(sm_module->local_pes);
+    free(sm_module->local_ctl);
+    free(sm_module->leader_pes);
+}
+
+#define SM_SAVE_PREV_SCOLL_API(__api) do {\
+    sm_module->previous_ ## __api            = osh_group->g_scoll.scoll_ ## __api;\
+    sm_module->previous_ ## __api ## _module = osh_group->g_scoll.scoll_ ## __api ## _module;\
+    if (!osh_group->g_scoll.scoll_ ## __api || !osh_group->g_scoll.scoll_ ## __api ## _module) {\
+        SCOLL_VERBOSE(1, "no underlying " # __api"; disqualifying myself");\
+        return OSHMEM_ERROR;\
+    }\
+    OBJ_RETAIN(sm_module->previous_ ## __api ## _module);\
+} while(0)
+
+/*
+ * The leaders group is not a strided active set, so it is built here
+ * rather than with oshmem_proc_group_create() and is not cached. The
+ * components selected for it run the inter-node phase.
+ */
+static int mca_scoll_sm_leaders_create(mca_scoll_sm_module_t *sm_module,
+                                       oshmem_group_t *osh_group)
+{
+    oshmem_group_t *leaders;
+    int i;
+
+    leaders = OBJ_NEW(oshmem_group_t);
+    if (NULL == leaders) {
+        return OSHMEM_ERR_OUT_OF_RESOURCE;
+    }
+
+    leaders->proc_vpids = (opal_vpid_t *) malloc(sm_module->n_leaders *
+                                                 sizeof(leaders->proc_vpids[0]));
+    if (NULL == leaders->proc_vpids) {
+        OBJ_RELEASE(leaders);
+        return OSHMEM_ERR_OUT_OF_RESOURCE;
+    }
+
+    for (i = 0; i < sm_module->n_leaders; i++) {
+        leaders->proc_vpids[i] = sm_module->leader_pes[i];
+    }
+    leaders->id         = -1;
+    leaders->my_pe      = osh_group->my_pe;
+    leaders->proc_count = sm_module->n_leaders;
+    leaders->is_member  = 1;
+    leaders->ompi_comm  = NULL;
+    memset(&leaders->g_scoll, 0, sizeof(mca_scoll_base_group_scoll_t));
+
+    if (OSHMEM_SUCCESS != mca_scoll_base_select(leaders)) {
+        SCOLL_ERROR("no collective modules for the node leaders");
+        free(leaders->proc_vpids);
+        OBJ_RELEASE(leaders);
+        return OSHMEM_ERROR;
+    }
+
+    sm_module->leaders = leaders;
+    return OSHMEM_SUCCESS;
+}
+
+static int mca_scoll_sm_module_enable(mca_scoll_base_module_t *module,
+                                      oshmem_group_t *osh_group)
+{
+    mca_scoll_sm_module_t *sm_module = (mca_scoll_sm_module_t *) module;
+
+    SM_SAVE_PREV_SCOLL_API(barrier);
+    SM_SAVE_PREV_SCOLL_API(broadcast);
+    SM_SAVE_PREV_SCOLL_API(reduce);
+
+    if ((sm_module->leader == osh_group->my_pe) && (sm_module->n_leaders > 1)) {
+        return mca_scoll_sm_leaders_create(sm_module, osh_group);
+    }
+
+    return OSHMEM_SUCCESS;
+}
+
+/*
+ * Invoked when there's a new group that has been created.
+ * Look at the group and decide which set of functions and
+ * priority we want to return.
+ *
+ * The decision has to be the same on every PE of the group, so it only
+ * depends on the group layout and on the control blocks being mapped,
+ * which holds for all the PEs of a node or for none.
+ */
+mca_scoll_base_module_t *
+mca_scoll_sm_query(struct oshmem_group_t *group, int *priority)
+{
+    mca_scoll_sm_component_t *cm = &mca_scoll_sm_component;
+    mca_scoll_sm_module_t *sm_module;
+    int *node_count;
+    uint32_t my_node;
+    uint32_t node;
+    bool shared = false;
+    int i, pe;
+
+    *priority = cm->sm_priority;
+
+    if (!cm->sm_enable) {
+        return NULL;
+    }
+
+    /* Groups created before the memheap (oshmem_group_all and
+     * oshmem_group_self) are selected again by mca_scoll_enable() */
+    if (NULL == mca_scoll_sync_array) {
+        return NULL;
+    }
+
+    if (OSHMEM_SUCCESS != mca_scoll_sm_ctl_init()) {
+        return NULL;
+    }
+
+    if (group->proc_count < 2) {
+        return NULL;
+    }
+
+    node_count = (int *) calloc(cm->num_nodes, sizeof(*node_count));
+    if (NULL == node_count) {
+        return NULL;
+    }
+
+    for (i = 0; i < group->proc_count; i++) {
+        node = cm->node_ids[oshmem_proc_pe_vpid(group, i)];
+        if (++node_count[node] > 1) {
+            shared = true;
+        }
+    }
+
+    if (!shared) {
+        SCOLL_VERBOSE(5, "no two PEs of group %d share a node", group->id);
+        free(node_count);
+        return NULL;
+    }
+
+    sm_module = OBJ_NEW(mca_scoll_sm_module_t);
+    if (NULL == sm_module) {
+        free(node_count);
+        return NULL;
+    }
+
+    my_node = cm->node_ids[group->my_pe];
+    sm_module->my_rank    = cm->local_ranks[group->my_pe];
+    sm_module->local_pes  = (int *) malloc(node_count[my_node] * sizeof(int));
+    sm_module->local_ctl  = (char **) malloc(node_count[my_node] * sizeof(char *));
+    sm_module->leader_pes = (int *) malloc(group->proc_count * sizeof(int));
+    if ((NULL == sm_module->local_pes) || (NULL == sm_module->local_ctl) ||
+        (NULL == sm_module->leader_pes)) {
+        goto err;
+    }
+
+    /* The first PE of the group seen on a node leads it */
+    for (i = 0; i < group->proc_count; i++) {
+        pe   = oshmem_proc_pe_vpid(group, i);
+        node = cm->node_ids[pe];
+        if (node_count[node] > 0) {
+            sm_module->leader_pes[sm_module->n_leaders++] = pe;
+            node_count[node] = -node_count[node];
+        }
+        if (node == my_node) {
+            sm_module->local_ctl[sm_module->local_count] = mca_scoll_sm_ptr(cm->ctl, pe);
+            if (NULL == sm_module->local_ctl[sm_module->local_count]) {
+                SCOLL_VERBOSE(5, "control block of PE %d is not mapped", pe);
+                goto err;
+            }
+            sm_module->local_pes[sm_module->local_count++] = pe;
+        }
+    }
+    sm_module->leader = sm_module->local_pes[0];
+    free(node_count);
+
+    sm_module->super.scoll_module_enable = mca_scoll_sm_module_enable;
+    sm_module->super.scoll_barrier       = mca_scoll_sm_barrier;
+    sm_module->super.scoll_broadcast     = mca_scoll_sm_broadcast;
+    sm_module->super.scoll_reduce        = mca_scoll_sm_reduce;
+    sm_module->super.scoll_collect       = NULL;
+    sm_module->super.scoll_alltoall      = NULL;
+
+    return &sm_module->super;
+
+err:
+    free(node_count);
+    OBJ_RELEASE(sm_module);
+    return NULL;
+}
+
+OBJ_CLASS_INSTANCE(mca_scoll_sm_module_t,
+                   mca_scoll_base_module_t,
+                   mca_scoll_sm_module_construct,
+                   mca_scoll_sm_module_destruct);
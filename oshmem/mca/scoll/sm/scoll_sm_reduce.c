@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026      NVIDIA Corporation.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+#include "oshmem_config.h"
+#include <stdlib.h>
+
+#include "oshmem/constants.h"
+#include "oshmem/op/op.h"
+#include "oshmem/mca/spml/spml.h"
+#include "oshmem/mca/scoll/scoll.h"
+#include "oshmem/mca/scoll/base/base.h"
+#include "scoll_sm.h"
+
+/*
+ * Combine the source of the local member i into target. The source is
+ * read in place when it is mapped, otherwise it is fetched into tmp.
+ */
+static int _sm_reduce_member(mca_scoll_sm_module_t *sm_module,
+                             struct oshmem_op_t *op,
+                             void *target,
+                             const void *source,
+                             size_t nlong,
+                             void **tmp,
+                             int i)
+{
+    int pe = sm_module->local_pes[i];
+    void *ptr;
+    int rc;
+
+    ptr = mca_scoll_sm_ptr(source, pe);
+    if (NULL == ptr) {
+        if (NULL == *tmp) {
+            *tmp = malloc(nlong);
+            if (NULL == *tmp) {
+                return OSHMEM_ERR_OUT_OF_RESOURCE;
+            }
+        }
+        rc = MCA_SPML_CALL(get(oshmem_ctx_default, (void *)source, nlong, *tmp, pe));
+        if (OSHMEM_SUCCESS != rc) {
+            return rc;
+        }
+        ptr = *tmp;
+    }
+
+    op->o_func.c_fn(ptr, target, nlong / op->dt_size);
+    return OSHMEM_SUCCESS;
+}
+
+/*
+ * The leader combines the sources of the PEs of its node into its
+ * target, the leaders reduce their partial results in place and the
+ * members copy the result from their leader.
+ */
+int mca_scoll_sm_reduce(struct oshmem_group_t *group,
+                        struct oshmem_op_t *op,
+                        void *target,
+                        const void *source,
+                        size_t nlong,
+                        long *pSync,
+                        void *pWrk,
+                        int alg)
+{
+    mca_scoll_sm_module_t *sm_module;
+    void *tmp = NULL;
+    int rc = OSHMEM_SUCCESS;
+    int i;
+
+    sm_module = (mca_scoll_sm_module_t *) group->g_scoll.scoll_reduce_module;
+
+    SCOLL_VERBOSE(12, "[#%d] Reduce: %d local PEs, %d nodes",
+                  group->my_pe, sm_module->local_count, sm_module->n_leaders);
+
+    if (sm_module->leader != group->my_pe) {
+        /* our source is read by the leader before the release */
+        scoll_sm_signal_leader(sm_module);
+        scoll_sm_wait_leader(sm_module);
+        rc = scoll_sm_copy_from(target, target, nlong, sm_module->leader);
+        scoll_sm_signal_leader(sm_module);
+        return rc;
+    }
+
+    if (target != source) {
+        memcpy(target, source, nlong);
+    }
+
+    for (i = 1; i < sm_module->local_count; i++) {
+        scoll_sm_wait_member(sm_module, i);
+        if (OSHMEM_SUCCESS == rc) {
+            rc = _sm_reduce_member(sm_module, op, target, source, nlong, &tmp, i);
+        }
+    }
+    free(tmp);
+
+    if ((OSHMEM_SUCCESS == rc) && (NULL != sm_module->leaders)) {
+        rc = sm_module->leaders->g_scoll.scoll_reduce(sm_module->leaders,
+                op,
+                target,
+                target,
+                nlong,
+                pSync,
+                pWrk,
+                alg);
+    }
+
+    for (i = 1; i < sm_module->local_count; i++) {
+        scoll_sm_release_member(sm_module, i);
+    }
+
+    for (i = 1; i < sm_module->local_count; i++) {
+        scoll_sm_wait_member(sm_module, i);
+    }
+
+    return rc;
+}
@@ -72,6 +72,46 @@ OSHMEM_DECLSPEC int mca_spml_base_test(void* addr,
                                        void* value,
                                        int datatype,
                                        int *out_value);
+OSHMEM_DECLSPEC void mca_spml_base_wait_until_all(void *ivars, int cmp,
+                                                  void *cmp_value, size_t nelems,
+                                                  const int *status, int datatype);
+OSHMEM_DECLSPEC size_t mca_spml_base_wait_until_any(void *ivars, int cmp,
+                                                    void *cmp_value, size_t nelems,
+                                                    const int *status, int datatype);
+OSHMEM_DECLSPEC size_t mca_spml_base_wait_until_some(void *ivars, int cmp,
+                                                     void *cmp_value, size_t nelems,
+                                                     size_t *indices,
+                                                     const int *status, int datatype);
+OSHMEM_DECLSPEC void mca_spml_base_wait_until_all_vector(void *ivars, int cmp,
+                                                         void *cmp_values, size_t nelems,
+                                                         const int *status, int datatype);
+OSHMEM_DECLSPEC size_t mca_spml_base_wait_until_any_vector(void *ivars, int cmp,
+                                                           void *cmp_values, size_t nelems,
+                                                           const int *status, int datatype);
+OSHMEM_DECLSPEC size_t mca_spml_base_wait_until_some_vector(void *ivars, int cmp,
+                                                            void *cmp_values, size_t nelems,
+                                                            size_t *indices,
+                                                            const int *status, int datatype);
+OSHMEM_DECLSPEC int mca_spml_base_test_all(void *ivars, int cmp,
+                                           void *cmp_value, size_t nelems,
+                                           const int *status, int datatype);
+OSHMEM_DECLSPEC size_t mca_spml_base_test_any(void *ivars, int cmp,
+                                              void *cmp_value, size_t nelems,
+                                              const int *status, int datatype);
+OSHMEM_DECLSPEC size_t mca_spml_base_test_some(void *ivars, int cmp,
+                                               void *cmp_value, size_t nelems,
+                                               size_t *indices,
+                                               const int *status, int datatype);
+OSHMEM_DECLSPEC int mca_spml_base_test_all_vector(void *ivars, int cmp,
+                                                  void *cmp_values, size_t nelems,
+                                                  const int *status, int datatype);
+OSHMEM_DECLSPEC size_t mca_spml_base_test_any_vector(void *ivars, int cmp,
+                                                     void *cmp_values, size_t nelems,
+                                                     const int *status, int datatype);
+OSHMEM_DECLSPEC size_t mca_spml_base_test_some_vector(void *ivars, int cmp,
+                                                      void *cmp_values, size_t nelems,
+                                                      size_t *indices,
+                                                      const int *status, int datatype);
 OSHMEM_DECLSPEC int mca_spml_base_oob_get_mkeys(shmem_ctx_t ctx,
                                                 int pe,
                                                 uint32_t seg,
@@ -12,8 +12,13 @@
  */
 
 #include "oshmem_config.h"
+
+#include <stdint.h>
+#include <string.h>
+
 #include "ompi/mca/bml/base/base.h"
 #include "opal/datatype/opal_convertor.h"
+#include "opal/util/minmax.h"
 #include "oshmem/proc/proc.h"
 #include "oshmem/mca/spml/base/base.h"
 #include "opal/mca/btl/btl.h"
@@ -121,6 +126,521 @@ int mca_spml_base_wait(void* addr, int cmp, void* value, int datatype)
     return OSHMEM_SUCCESS;
 }
 
+/*
+ * Wait sets (shmem_wait_until_{all,any,some} and the test variants) are
+ * scanned in blocks: every element of a block is compared with a loop
+ * that has no branch and no early exit so the compiler turns it into
+ * vector compares, the status mask is applied and the matches counted the
+ * same way. Only a block with matches is looked at element by element.
+ */
+#define SPML_BASE_WAIT_BLOCK            256
+
+/* Upper bound on the number of progress calls between two scans */
+#define SPML_BASE_WAIT_MAX_BACKOFF      16
+
+typedef void (*spml_base_match_fn_t)(const void *ivars, int cmp,
+                                     const void *cmp_value, bool vector,
+                                     size_t start, size_t count,
+                                     uint8_t *match);
+
+typedef struct spml_base_wait_set {
+    spml_base_match_fn_t match;
+    const void *ivars;
+    int cmp;
+    const void *cmp_value;
+    bool vector;
+    size_t nelems;
+    const int *status;
+} spml_base_wait_set_t;
+
+#define SPML_BASE_MATCH_LOOP(_addr, _op, _value, _values, _count, _match) \
+    if (NULL == (_values)) { \
+        for (i = 0; i < (_count); i++) { \
+            (_match)[i] = (_addr)[i] _op (_value); \
+        } \
+    } else { \
+        for (i = 0; i < (_count); i++) { \
+            (_match)[i] = (_addr)[i] _op (_values)[i]; \
+        } \
+    }
+
+#define SPML_BASE_MATCH_FN(_name, _type) \
+static void spml_base_match_##_name(const void *ivars, int cmp, \
+                                    const void *cmp_value, bool vector, \
+                                    size_t start, size_t count, \
+                                    uint8_t *match) \
+{ \
+    const _type *addr = (const _type *)ivars + start; \
+    const _type *values = vector ? (const _type *)cmp_value + start : NULL; \
+    _type value = vector ? 0 : *(const _type *)cmp_value; \
+    size_t i; \
+    \
+    switch (cmp) { \
+        case SHMEM_CMP_EQ: \
+            SPML_BASE_MATCH_LOOP(addr, ==, value, values, count, match); \
+            break; \
+        case SHMEM_CMP_NE: \
+            SPML_BASE_MATCH_LOOP(addr, !=, value, values, count, match); \
+            break; \
+        case SHMEM_CMP_GT: \
+            SPML_BASE_MATCH_LOOP(addr, >, value, values, count, match); \
+            break; \
+        case SHMEM_CMP_LE: \
+            SPML_BASE_MATCH_LOOP(addr, <=, value, values, count, match); \
+            break; \
+        case SHMEM_CMP_LT: \
+            SPML_BASE_MATCH_LOOP(addr, <, value, values, count, match); \
+            break; \
+        case SHMEM_CMP_GE: \
+            SPML_BASE_MATCH_LOOP(addr, >=, value, values, count, match); \
+            break; \
+        default: \
+            memset(match, 0, count); \
+            break; \
+    } \
+}
+
+SPML_BASE_MATCH_FN(int, int)
+SPML_BASE_MATCH_FN(uint, unsigned int)
+SPML_BASE_MATCH_FN(long, long)
+SPML_BASE_MATCH_FN(ulong, unsigned long)
+SPML_BASE_MATCH_FN(short, short)
+SPML_BASE_MATCH_FN(ushort, unsigned short)
+SPML_BASE_MATCH_FN(llong, long long)
+SPML_BASE_MATCH_FN(ullong, unsigned long long)
+SPML_BASE_MATCH_FN(int32, int32_t)
+SPML_BASE_MATCH_FN(uint32, uint32_t)
+SPML_BASE_MATCH_FN(int64, int64_t)
+SPML_BASE_MATCH_FN(uint64, uint64_t)
+SPML_BASE_MATCH_FN(size, size_t)
+SPML_BASE_MATCH_FN(ptrdiff, ptrdiff_t)
+SPML_BASE_MATCH_FN(fint, ompi_fortran_integer_t)
+SPML_BASE_MATCH_FN(fint4, ompi_fortran_integer4_t)
+SPML_BASE_MATCH_FN(fint8, ompi_fortran_integer8_t)
+
+static spml_base_match_fn_t spml_base_match_fn(int datatype)
+{
+    switch (datatype) {
+        case SHMEM_INT:       return spml_base_match_int;
+        case SHMEM_UINT:      return spml_base_match_uint;
+        case SHMEM_LONG:      return spml_base_match_long;
+        case SHMEM_ULONG:     return spml_base_match_ulong;
+        case SHMEM_SHORT:     return spml_base_match_short;
+        case SHMEM_USHORT:    return spml_base_match_ushort;
+        case SHMEM_LLONG:     return spml_base_match_llong;
+        case SHMEM_ULLONG:    return spml_base_match_ullong;
+        case SHMEM_INT32_T:   return spml_base_match_int32;
+        case SHMEM_UINT32_T:  return spml_base_match_uint32;
+        case SHMEM_INT64_T:   return spml_base_match_int64;
+        case SHMEM_UINT64_T:  return spml_base_match_uint64;
+        case SHMEM_SIZE_T:    return spml_base_match_size;
+        case SHMEM_PTRDIFF_T: return spml_base_match_ptrdiff;
+        case SHMEM_FINT:      return spml_base_match_fint;
+        case SHMEM_FINT4:     return spml_base_match_fint4;
+        case SHMEM_FINT8:     return spml_base_match_fint8;
+    }
+
+    return NULL;
+}
+
+static inline bool spml_base_wait_set_init(spml_base_wait_set_t *set,
+                                           void *ivars, int cmp,
+                                           void *cmp_value, bool vector,
+                                           size_t nelems, const int *status,
+                                           int datatype)
+{
+    set->match     = spml_base_match_fn(datatype);
+    set->ivars     = ivars;
+    set->cmp       = cmp;
+    set->cmp_value = cmp_value;
+    set->vector    = vector;
+    set->nelems    = nelems;
+    set->status    = status;
+
+    return (NULL != set->match);
+}
+
+/*
+ * Compare the elements [start, start + count) of the set and return the
+ * number of matches. Elements excluded by the status mask never match,
+ * unless excluded_match is set in which case they always do: a block is
+ * then complete for wait_until_all when every element matched.
+ */
+static inline size_t spml_base_wait_set_scan(const spml_base_wait_set_t *set,
+                                             size_t start, size_t count,
+                                             bool excluded_match,
+                                             uint8_t *match)
+{
+    size_t i, hits = 0;
+
+    set->match(set->ivars, set->cmp, set->cmp_value, set->vector,
+               start, count, match);
+
+    if (NULL != set->status) {
+        const int *status = set->status + start;
+        if (excluded_match) {
+            for (i = 0; i < count; i++) {
+                match[i] |= (0 != status[i]);
+            }
+        } else {
+            for (i = 0; i < count; i++) {
+                match[i] &= (0 == status[i]);
+            }
+        }
+    }
+
+    for (i = 0; i < count; i++) {
+        hits += match[i];
+    }
+
+    return hits;
+}
+
+static inline bool spml_base_wait_set_empty(const spml_base_wait_set_t *set)
+{
+    size_t i;
+
+    if (NULL == set->status) {
+        return (0 == set->nelems);
+    }
+
+    for (i = 0; i < set->nelems; i++) {
+        if (0 == set->status[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Check the elements from *first on and advance *first past the leading
+ * blocks that are complete, an element that satisfied the condition is
+ * not looked at again by the following scans.
+ */
+static bool spml_base_wait_set_all(const spml_base_wait_set_t *set, size_t *first)
+{
+    uint8_t match[SPML_BASE_WAIT_BLOCK];
+    size_t start, count;
+
+    for (start = *first; start < set->nelems; start += count) {
+        count = opal_min(set->nelems - start, SPML_BASE_WAIT_BLOCK);
+        if (spml_base_wait_set_scan(set, start, count, true, match) != count) {
+            *first = start;
+            return false;
+        }
+    }
+
+    *first = set->nelems;
+    return true;
+}
+
+static size_t spml_base_wait_set_any(const spml_base_wait_set_t *set)
+{
+    uint8_t match[SPML_BASE_WAIT_BLOCK];
+    size_t start, count, i;
+
+    for (start = 0; start < set->nelems; start += count) {
+        count = opal_min(set->nelems - start, SPML_BASE_WAIT_BLOCK);
+        if (0 != spml_base_wait_set_scan(set, start, count, false, match)) {
+            for (i = 0; 0 == match[i]; i++);
+            return start + i;
+        }
+    }
+
+    return SIZE_MAX;
+}
+
+static size_t spml_base_wait_set_some(const spml_base_wait_set_t *set, size_t *indices)
+{
+    uint8_t match[SPML_BASE_WAIT_BLOCK];
+    size_t start, count, i, found = 0;
+
+    for (start = 0; start < set->nelems; start += count) {
+        count = opal_min(set->nelems - start, SPML_BASE_WAIT_BLOCK);
+        if (0 != spml_base_wait_set_scan(set, start, count, false, match)) {
+            for (i = 0; i < count; i++) {
+                if (match[i]) {
+                    indices[found++] = start + i;
+                }
+            }
+        }
+    }
+
+    return found;
+}
+
+/*
+ * Called after a scan of the set found nothing: progress is called once
+ * after the first failed scans and twice as many times after each one
+ * that follows up to SPML_BASE_WAIT_MAX_BACKOFF, so that a large set is
+ * not rescanned (and its cache lines pulled away from the producers)
+ * faster than the network can update it.
+ */
+static inline void spml_base_wait_backoff(unsigned *backoff)
+{
+    unsigned i;
+
+    for (i = 0; i < *backoff; i++) {
+        opal_progress();
+    }
+
+    if (*backoff < SPML_BASE_WAIT_MAX_BACKOFF) {
+        *backoff <<= 1;
+    }
+}
+
+static void spml_base_wait_until_all_set(const spml_base_wait_set_t *set)
+{
+    unsigned backoff = 1;
+    size_t first = 0;
+
+    while (!spml_base_wait_set_all(set, &first)) {
+        spml_base_wait_backoff(&backoff);
+    }
+    opal_atomic_rmb();
+}
+
+static size_t spml_base_wait_until_any_set(const spml_base_wait_set_t *set)
+{
+    unsigned backoff = 1;
+    size_t index;
+
+    if (spml_base_wait_set_empty(set)) {
+        return SIZE_MAX;
+    }
+
+    while (SIZE_MAX == (index = spml_base_wait_set_any(set))) {
+        spml_base_wait_backoff(&backoff);
+    }
+    opal_atomic_rmb();
+
+    return index;
+}
+
+static size_t spml_base_wait_until_some_set(const spml_base_wait_set_t *set,
+                                            size_t *indices)
+{
+    unsigned backoff = 1;
+    size_t found;
+
+    if (spml_base_wait_set_empty(set)) {
+        return 0;
+    }
+
+    while (0 == (found = spml_base_wait_set_some(set, indices))) {
+        spml_base_wait_backoff(&backoff);
+    }
+    opal_atomic_rmb();
+
+    return found;
+}
+
+/* A failed test progresses the transports once, like a wait would */
+static int spml_base_test_all_set(const spml_base_wait_set_t *set)
+{
+    size_t first = 0;
+
+    if (!spml_base_wait_set_all(set, &first)) {
+        opal_progress();
+        return 0;
+    }
+    opal_atomic_rmb();
+
+    return 1;
+}
+
+static size_t spml_base_test_any_set(const spml_base_wait_set_t *set)
+{
+    size_t index;
+
+    index = spml_base_wait_set_any(set);
+    if (SIZE_MAX == index) {
+        opal_progress();
+    } else {
+        opal_atomic_rmb();
+    }
+
+    return index;
+}
+
+static size_t spml_base_test_some_set(const spml_base_wait_set_t *set,
+                                      size_t *indices)
+{
+    size_t found;
+
+    found = spml_base_wait_set_some(set, indices);
+    if (0 == found) {
+        opal_progress();
+    } else {
+        opal_atomic_rmb();
+    }
+
+    return found;
+}
+
+void mca_spml_base_wait_until_all(void *ivars, int cmp, void *cmp_value,
+                                  size_t nelems, const int *status,
+                                  int datatype)
+{
+    spml_base_wait_set_t set;
+
+    if (spml_base_wait_set_init(&set, ivars, cmp, cmp_value, false,
+                                nelems, status, datatype)) {
+        spml_base_wait_until_all_set(&set);
+    }
+}
+
+size_t mca_spml_base_wait_until_any(void *ivars, int cmp, void *cmp_value,
+                                    size_t nelems, const int *status,
+                                    int datatype)
+{
+    spml_base_wait_set_t set;
+
+    if (!spml_base_wait_set_init(&set, ivars, cmp, cmp_value, false,
+                                 nelems, status, datatype)) {
+        return SIZE_MAX;
+    }
+
+    return spml_base_wait_until_any_set(&set);
+}
+
+size_t mca_spml_base_wait_until_some(void *ivars, int cmp, void *cmp_value,
+                                     size_t nelems, size_t *indices,
+                                     const int *status, int datatype)
+{
+    spml_base_wait_set_t set;
+
+    if (!spml_base_wait_set_init(&set, ivars, cmp, cmp_value, false,
+                                 nelems, status, datatype)) {
+        return 0;
+    }
+
+    return spml_base_wait_until_some_set(&set, indices);
+}
+
+void mca_spml_base_wait_until_all_vector(void *ivars, int cmp,
+                                         void *cmp_values, size_t nelems,
+                                         const int *status, int datatype)
+{
+    spml_base_wait_set_t set;
+
+    if (spml_base_wait_set_init(&set, ivars, cmp, cmp_values, true,
+                                nelems, status, datatype)) {
+        spml_base_wait_until_all_set(&set);
+    }
+}
+
+size_t mca_spml_base_wait_until_any_vector(void *ivars, int cmp,
+                                           void *cmp_values, size_t nelems,
+                                           const int *status, int datatype)
+{
+    spml_base_wait_set_t set;
+
+    if (!spml_base_wait_set_init(&set, ivars, cmp, cmp_values, true,
+                                 nelems, status, datatype)) {
+        return SIZE_MAX;
+    }
+
+    return spml_base_wait_until_any_set(&set);
+}
+
+size_t mca_spml_base_wait_until_some_vector(void *ivars, int cmp,
+                                            void *cmp_values, size_t nelems,
+                                            size_t *indices,
+                                            const int *status, int datatype)
+{
+    spml_base_wait_set_t set;
+
+    if (!spml_base_wait_set_init(&set, ivars, cmp, cmp_values, true,
+                                 nelems, status, datatype)) {
+        return 0;
+    }
+
+    return spml_base_wait_until_some_set(&set, indices);
+}
+
+int mca_spml_base_test_all(void *ivars, int cmp, void *cmp_value,
+                           size_t nelems, const int *status, int datatype)
+{
+    spml_base_wait_set_t set;
+
+    if (!spml_base_wait_set_init(&set, ivars, cmp, cmp_value, false,
+                                 nelems, status, datatype)) {
+        return 0;
+    }
+
+    return spml_base_test_all_set(&set);
+}
+
+size_t mca_spml_base_test_any(void *ivars, int cmp, void *cmp_value,
+                              size_t nelems, const int *status, int datatype)
+{
+    spml_base_wait_set_t set;
+
+    if (!spml_base_wait_set_init(&set, ivars, cmp, cmp_value, false,
+                                 nelems, status, datatype)) {
+        return SIZE_MAX;
+    }
+
+    return spml_base_test_any_set(&set);
+}
+
+size_t mca_spml_base_test_some(void *ivars, int cmp, void *cmp_value,
+                               size_t nelems, size_t *indices,
+                               const int *status, int datatype)
+{
+    spml_base_wait_set_t set;
+
+    if (!spml_base_wait_set_init(&set, ivars, cmp, cmp_value, false,
+                                 nelems, status, datatype)) {
+        return 0;
+    }
+
+    return spml_base_test_some_set(&set, indices);
+}
+
+int mca_spml_base_test_all_vector(void *ivars, int cmp, void *cmp_values,
+                                  size_t nelems, const int *status,
+                                  int datatype)
+{
+    spml_base_wait_set_t set;
+
+    if (!spml_base_wait_set_init(&set, ivars, cmp, cmp_values, true,
+                                 nelems, status, datatype)) {
+        return 0;
+    }
+
+    return spml_base_test_all_set(&set);
+}
+
+size_t mca_spml_base_test_any_vector(void *ivars, int cmp, void *cmp_values,
+                                     size_t nelems, const int *status,
+                                     int datatype)
+{
+    spml_base_wait_set_t set;
+
+    if (!spml_base_wait_set_init(&set, ivars, cmp, cmp_values, true,
+                                 nelems, status, datatype)) {
+        return SIZE_MAX;
+    }
+
+    return spml_base_test_any_set(&set);
+}
+
+size_t mca_spml_base_test_some_vector(void *ivars, int cmp, void *cmp_values,
+                                      size_t nelems, size_t *indices,
+                                      const int *status, int datatype)
+{
+    spml_base_wait_set_t set;
+
+    if (!spml_base_wait_set_init(&set, ivars, cmp, cmp_values, true,
+                                 nelems, status, datatype)) {
+        return 0;
+    }
+
+    return spml_base_test_some_set(&set, indices);
+}
 
 /**
  * Waits for completion of a non-blocking put or get issued by the calling PE.
@@ -0,0 +1,871 @@
+/*
+ * Copyright (c) 2026      NVIDIA Corporation.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+#include "oshmem_config.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "opal/sys/atomic.h"
+#include "ompi/datatype/ompi_datatype.h"
+#include "ompi/communicator/communicator.h"
+#include "ompi/mca/pml/pml.h"
+
+#include "oshmem/mca/spml/sm/spml_sm.h"
+#include "oshmem/include/shmem.h"
+#include "oshmem/mca/memheap/memheap.h"
+#include "oshmem/mca/memheap/base/base.h"
+#include "oshmem/proc/proc.h"
+#include "oshmem/mca/spml/base/base.h"
+#include "oshmem/mca/atomic/atomic.h"
+#include "oshmem/runtime/runtime.h"
+
+#include "oshmem/mca/spml/sm/spml_sm_component.h"
+
+mca_spml_sm_t mca_spml_sm = {
+    .super = {
+        /* Init mca_spml_base_module_t */
+        .spml_add_procs     = mca_spml_sm_add_procs,
+        .spml_del_procs     = mca_spml_sm_del_procs,
+        .spml_enable        = mca_spml_sm_enable,
+        .spml_register      = mca_spml_sm_register,
+        .spml_deregister    = mca_spml_sm_deregister,
+        .spml_oob_get_mkeys = mca_spml_base_oob_get_mkeys,
+        .spml_ctx_create    = mca_spml_sm_ctx_create,
+        .spml_ctx_destroy   = mca_spml_sm_ctx_destroy,
+        .spml_put           = mca_spml_sm_put,
+        .spml_put_nb        = mca_spml_sm_put_nb,
+        .spml_put_signal    = mca_spml_sm_put_signal,
+        .spml_put_signal_nb = mca_spml_sm_put_signal_nb,
+        .spml_get           = mca_spml_sm_get,
+        .spml_get_nb        = mca_spml_sm_get_nb,
+        .spml_recv          = mca_spml_sm_recv,
+        .spml_send          = mca_spml_sm_send,
+        .spml_fence         = mca_spml_sm_fence,
+        .spml_quiet         = mca_spml_sm_quiet,
+        .spml_rmkey_unpack  = mca_spml_sm_rmkey_unpack,
+        .spml_rmkey_free    = mca_spml_sm_rmkey_free,
+        .spml_rmkey_ptr     = mca_spml_sm_rmkey_ptr,
+        .spml_memuse_hook   = mca_spml_base_memuse_hook,
+        .spml_put_all_nb    = mca_spml_sm_put_all_nb,
+        .spml_wait                      = mca_spml_base_wait,
+        .spml_wait_nb                   = mca_spml_base_wait_nb,
+        .spml_wait_until_all            = mca_spml_base_wait_until_all,
+        .spml_wait_until_any            = mca_spml_base_wait_until_any,
+        .spml_wait_until_some           = mca_spml_base_wait_until_some,
+        .spml_wait_until_all_vector     = mca_spml_base_wait_until_all_vector,
+        .spml_wait_until_any_vector     = mca_spml_base_wait_until_any_vector,
+        .spml_wait_until_some_vector    = mca_spml_base_wait_until_some_vector,
+        .spml_test                      = mca_spml_base_test,
+        .spml_test_all                  = mca_spml_base_test_all,
+        .spml_test_any                  = mca_spml_base_test_any,
+        .spml_test_some                 = mca_spml_base_test_some,
+        .spml_test_all_vector           = mca_spml_base_test_all_vector,
+        .spml_test_any_vector           = mca_spml_base_test_any_vector,
+        .spml_test_some_vector          = mca_spml_base_test_some_vector,
+        .spml_team_sync                 = mca_spml_sm_team_sync,
+        .spml_team_my_pe                = mca_spml_sm_team_my_pe,
+        .spml_team_n_pes                = mca_spml_sm_team_n_pes,
+        .spml_team_get_config           = mca_spml_sm_team_get_config,
+        .spml_team_translate_pe         = mca_spml_sm_team_translate_pe,
+        .spml_team_split_strided        = mca_spml_sm_team_split_strided,
+        .spml_team_split_2d             = mca_spml_sm_team_split_2d,
+        .spml_team_destroy              = mca_spml_sm_team_destroy,
+        .spml_team_get                  = mca_spml_sm_team_get,
+        .spml_team_create_ctx           = mca_spml_sm_team_create_ctx,
+        .spml_team_alltoall             = mca_spml_sm_team_alltoall,
+        .spml_team_alltoalls            = mca_spml_sm_team_alltoalls,
+        .spml_team_broadcast            = mca_spml_sm_team_broadcast,
+        .spml_team_collect              = mca_spml_sm_team_collect,
+        .spml_team_fcollect             = mca_spml_sm_team_fcollect,
+        .spml_team_reduce               = mca_spml_sm_team_reduce,
+        .self                           = (void*)&mca_spml_sm
+    },
+
+    .peers                  = NULL,
+    .enabled                = false
+};
+
+mca_spml_sm_ctx_t mca_spml_sm_ctx_default = {
+    .options = 0
+};
+
+int mca_spml_sm_enable(bool enable)
+{
+    SPML_SM_VERBOSE(50, "*** sm ENABLED ****");
+    if (false == enable) {
+        return OSHMEM_SUCCESS;
+    }
+
+    mca_spml_sm.enabled = true;
+
+    return OSHMEM_SUCCESS;
+}
+
+static void mca_spml_sm_mkey_release(spml_sm_mkey_t *sm_mkey)
+{
+    if (NULL != sm_mkey->map_ctx) {
+        MCA_SMSC_CALL(unmap_peer_region, sm_mkey->map_ctx);
+    }
+    sm_mkey->map_ctx    = NULL;
+    sm_mkey->local_base = NULL;
+    sm_mkey->reg_data   = NULL;
+}
+
+int mca_spml_sm_add_procs(oshmem_group_t* group, size_t nprocs)
+{
+    int my_pe = oshmem_my_proc_id();
+    size_t i;
+
+    mca_spml_sm.peers = (spml_sm_peer_t *) calloc(nprocs, sizeof(*mca_spml_sm.peers));
+    if (NULL == mca_spml_sm.peers) {
+        return OSHMEM_ERR_OUT_OF_RESOURCE;
+    }
+
+    for (i = 0; i < nprocs; i++) {
+        if (!oshmem_proc_on_local_node(i)) {
+            SPML_SM_ERROR("PE %d is not on the local node, "
+                          "spml/sm only supports single node jobs", (int)i);
+            return OSHMEM_ERR_NOT_SUPPORTED;
+        }
+
+        if ((int)i == my_pe || NULL == mca_smsc) {
+            continue;
+        }
+
+        mca_spml_sm.peers[i].endpoint =
+            MCA_SMSC_CALL(get_endpoint, &oshmem_proc_find(i)->super);
+        if (NULL == mca_spml_sm.peers[i].endpoint) {
+            SPML_SM_VERBOSE(5, "no single-copy endpoint for PE %d, only shared "
+                            "segments can be accessed", (int)i);
+        }
+    }
+
+    SPML_SM_VERBOSE(50, "*** SM PROCS ADDED ***");
+    return OSHMEM_SUCCESS;
+}
+
+int mca_spml_sm_del_procs(oshmem_group_t* group, size_t nprocs)
+{
+    spml_sm_peer_t *peer;
+    size_t i, j;
+
+    oshmem_shmem_barrier();
+
+    if (NULL == mca_spml_sm.peers) {
+        return OSHMEM_SUCCESS;
+    }
+
+    for (i = 0; i < nprocs; i++) {
+        peer = &mca_spml_sm.peers[i];
+        for (j = 0; j < peer->mkeys_cnt; j++) {
+            if (NULL != peer->mkeys[j]) {
+                mca_spml_sm_mkey_release(peer->mkeys[j]);
+                free(peer->mkeys[j]);
+            }
+        }
+        free(peer->mkeys);
+
+        if (NULL != peer->endpoint) {
+            MCA_SMSC_CALL(return_endpoint, peer->endpoint);
+        }
+    }
+
+    free(mca_spml_sm.peers);
+    mca_spml_sm.peers = NULL;
+
+    return OSHMEM_SUCCESS;
+}
+
+sshmem_mkey_t *mca_spml_sm_register(void* addr,
+                                    size_t size,
+                                    uint64_t shmid,
+                                    int *count)
+{
+    sshmem_mkey_t *mkeys;
+    ssize_t reg_size;
+
+    *count = 0;
+    mkeys = (sshmem_mkey_t *) calloc(SPML_SM_TRANSP_CNT, sizeof(*mkeys));
+    if (NULL == mkeys) {
+        return NULL;
+    }
+
+    if (MAP_SEGMENT_SHM_INVALID != shmid) {
+        /* peers attach the segment during the key exchange */
+        mkeys[SPML_SM_TRANSP_IDX].va_base = 0;
+        mkeys[SPML_SM_TRANSP_IDX].len     = 0;
+        mkeys[SPML_SM_TRANSP_IDX].u.key   = shmid;
+    } else {
+        mkeys[SPML_SM_TRANSP_IDX].va_base = addr;
+        mkeys[SPML_SM_TRANSP_IDX].len     = 0;
+        mkeys[SPML_SM_TRANSP_IDX].u.key   = MAP_SEGMENT_SHM_INVALID;
+
+        reg_size = mca_smsc_base_registration_data_size();
+        if (0 < reg_size) {
+            if (reg_size >= 0xffff) {
+                SPML_SM_ERROR("smsc registration data is too long: %lld >= %d",
+                              (long long)reg_size, 0xffff);
+                free(mkeys);
+                return NULL;
+            }
+            mkeys[SPML_SM_TRANSP_IDX].u.data = MCA_SMSC_CALL(register_region, addr, size);
+            if (NULL == mkeys[SPML_SM_TRANSP_IDX].u.data) {
+                SPML_SM_ERROR("failed to register %p - %p with smsc",
+                              addr, (void *)((uintptr_t)addr + size));
+                free(mkeys);
+                return NULL;
+            }
+            mkeys[SPML_SM_TRANSP_IDX].len = (uint16_t)reg_size;
+        }
+    }
+
+    *count = SPML_SM_TRANSP_CNT;
+    return mkeys;
+}
+
+int mca_spml_sm_deregister(sshmem_mkey_t *mkeys)
+{
+    MCA_SPML_CALL(quiet(oshmem_ctx_default));
+    if (!mkeys) {
+        return OSHMEM_SUCCESS;
+    }
+
+    if (0 != mkeys[SPML_SM_TRANSP_IDX].va_base &&
+        0 < mkeys[SPML_SM_TRANSP_IDX].len) {
+        MCA_SMSC_CALL(deregister_region, mkeys[SPML_SM_TRANSP_IDX].u.data);
+    }
+
+    free(mkeys);
+
+    return OSHMEM_SUCCESS;
+}
+
+void mca_spml_sm_rmkey_unpack(shmem_ctx_t ctx, sshmem_mkey_t *mkey, uint32_t segno, int pe, int tr_id)
+{
+    spml_sm_peer_t *peer = &mca_spml_sm.peers[pe];
+    spml_sm_mkey_t *sm_mkey, **mkeys;
+    map_segment_t *seg;
+    size_t size;
+
+    if (segno >= peer->mkeys_cnt) {
+        mkeys = (spml_sm_mkey_t **) realloc(peer->mkeys, (segno + 1) * sizeof(*mkeys));
+        if (NULL == mkeys) {
+            goto error_fatal;
+        }
+        memset(mkeys + peer->mkeys_cnt, 0,
+               (segno + 1 - peer->mkeys_cnt) * sizeof(*mkeys));
+        peer->mkeys     = mkeys;
+        peer->mkeys_cnt = segno + 1;
+    }
+
+    sm_mkey = peer->mkeys[segno];
+    if (NULL == sm_mkey) {
+        sm_mkey = (spml_sm_mkey_t *) calloc(1, sizeof(*sm_mkey));
+        if (NULL == sm_mkey) {
+            goto error_fatal;
+        }
+        peer->mkeys[segno] = sm_mkey;
+    } else {
+        mca_spml_sm_mkey_release(sm_mkey);
+    }
+
+    if (0 < mkey->len) {
+        sm_mkey->reg_data = mkey->u.data;
+    }
+
+    /* Map the whole segment when smsc can do it, so that it is accessed
+     * with load/store as the shared segments. Segments are symmetric, the
+     * local one gives the size. */
+    if (NULL != peer->endpoint && mca_smsc_base_has_feature(MCA_SMSC_FEATURE_CAN_MAP)) {
+        seg  = memheap_find_seg(segno);
+        size = (uintptr_t)seg->super.va_end - (uintptr_t)seg->super.va_base;
+        sm_mkey->map_ctx = MCA_SMSC_CALL(map_peer_region, peer->endpoint, 0,
+                                         mkey->va_base, size, &sm_mkey->local_base);
+        if (NULL == sm_mkey->map_ctx) {
+            sm_mkey->local_base = NULL;
+        }
+    }
+
+    mkey->spml_context = sm_mkey;
+    return;
+
+error_fatal:
+    SPML_SM_ERROR("failed to allocate the key of segment %u of PE %d", segno, pe);
+    oshmem_shmem_abort(-1);
+}
+
+void mca_spml_sm_rmkey_free(sshmem_mkey_t *mkey, int pe)
+{
+    if (!mkey->spml_context) {
+        return;
+    }
+
+    /* the key entry itself is released with the peer */
+    mca_spml_sm_mkey_release((spml_sm_mkey_t *)mkey->spml_context);
+    mkey->spml_context = NULL;
+}
+
+/*
+ * Local address of rva, or NULL when the memory of the peer can only be
+ * accessed through smsc copies.
+ */
+static inline void *mca_spml_sm_local_ptr(sshmem_mkey_t *mkey, void *rva)
+{
+    spml_sm_mkey_t *sm_mkey = (spml_sm_mkey_t *)mkey->spml_context;
+
+    /* own memory or shared segment attached by memheap */
+    if (NULL == sm_mkey) {
+        return rva;
+    }
+
+    if (NULL != sm_mkey->local_base) {
+        return (void *)((uintptr_t)sm_mkey->local_base +
+                        ((uintptr_t)rva - (uintptr_t)mkey->va_base));
+    }
+
+    return NULL;
+}
+
+void *mca_spml_sm_rmkey_ptr(const void *dst_addr, sshmem_mkey_t *mkey, int pe)
+{
+    map_segment_t *seg;
+    void *rva;
+
+    if (NULL == mkey->spml_context) {
+        return NULL;
+    }
+
+    seg = memheap_find_va((void *)dst_addr);
+    if (NULL == seg) {
+        return NULL;
+    }
+
+    rva = memheap_va2rva((void *)dst_addr, seg->super.va_base, mkey->va_base);
+    return mca_spml_sm_local_ptr(mkey, rva);
+}
+
+static inline sshmem_mkey_t *mca_spml_sm_mkey(shmem_ctx_t ctx, int pe, void *va, void **rva)
+{
+    sshmem_mkey_t *mkey;
+
+    mkey = mca_memheap_base_get_cached_mkey(ctx, pe, va, SPML_SM_TRANSP_IDX, rva);
+    if (OPAL_UNLIKELY(NULL == mkey)) {
+        SPML_SM_ERROR("pe=%d: %p is not address of shared variable", pe, va);
+        oshmem_shmem_abort(-1);
+    }
+
+    return mkey;
+}
+
+static inline int mca_spml_sm_copy(shmem_ctx_t ctx, void *remote_addr, size_t size,
+                                   void *local_addr, int pe, bool is_put)
+{
+    mca_smsc_endpoint_t *endpoint;
+    spml_sm_mkey_t *sm_mkey;
+    sshmem_mkey_t *mkey;
+    void *rva, *ptr;
+    int rc;
+
+    if (OPAL_UNLIKELY(0 == size)) {
+        return OSHMEM_SUCCESS;
+    }
+
+    mkey = mca_spml_sm_mkey(ctx, pe, remote_addr, &rva);
+    if (OPAL_UNLIKELY(NULL == mkey)) {
+        return OSHMEM_ERROR;
+    }
+
+    ptr = mca_spml_sm_local_ptr(mkey, rva);
+    if (OPAL_LIKELY(NULL != ptr)) {
+        if (is_put) {
+            memcpy(ptr, local_addr, size);
+        } else {
+            memcpy(local_addr, ptr, size);
+        }
+        return OSHMEM_SUCCESS;
+    }
+
+    sm_mkey  = (spml_sm_mkey_t *)mkey->spml_context;
+    endpoint = mca_spml_sm.peers[pe].endpoint;
+    if (OPAL_UNLIKELY(NULL == endpoint)) {
+        SPML_SM_ERROR("pe=%d: no single-copy mechanism to access %p", pe, remote_addr);
+        return OSHMEM_ERR_NOT_AVAILABLE;
+    }
+
+    if (is_put) {
+        rc = MCA_SMSC_CALL(copy_to, endpoint, local_addr, rva, size, sm_mkey->reg_data);
+    } else {
+        rc = MCA_SMSC_CALL(copy_from, endpoint, local_addr, rva, size, sm_mkey->reg_data);
+    }
+
+    return (OPAL_SUCCESS == rc) ? OSHMEM_SUCCESS : OSHMEM_ERROR;
+}
+
+int mca_spml_sm_ctx_create(long options, shmem_ctx_t *ctx)
+{
+    mca_spml_sm_ctx_t *sm_ctx;
+
+    sm_ctx = (mca_spml_sm_ctx_t *) malloc(sizeof(*sm_ctx));
+    if (NULL == sm_ctx) {
+        return OSHMEM_ERR_OUT_OF_RESOURCE;
+    }
+    sm_ctx->options = options;
+
+    (*ctx) = (shmem_ctx_t)sm_ctx;
+    return OSHMEM_SUCCESS;
+}
+
+void mca_spml_sm_ctx_destroy(shmem_ctx_t ctx)
+{
+    MCA_SPML_CALL(quiet(ctx));
+
+    if (ctx != (shmem_ctx_t)&mca_spml_sm_ctx_default) {
+        free(ctx);
+    }
+}
+
+int mca_spml_sm_get(shmem_ctx_t ctx, void *src_addr, size_t size, void *dst_addr, int src)
+{
+    return mca_spml_sm_copy(ctx, src_addr, size, dst_addr, src, false);
+}
+
+/* all the transfers complete immediately */
+int mca_spml_sm_get_nb(shmem_ctx_t ctx, void *src_addr, size_t size, void *dst_addr, int src, void **handle)
+{
+    return mca_spml_sm_copy(ctx, src_addr, size, dst_addr, src, false);
+}
+
+int mca_spml_sm_put(shmem_ctx_t ctx, void* dst_addr, size_t size, void* src_addr, int dst)
+{
+    return mca_spml_sm_copy(ctx, dst_addr, size, src_addr, dst, true);
+}
+
+int mca_spml_sm_put_nb(shmem_ctx_t ctx, void* dst_addr, size_t size, void* src_addr, int dst, void **handle)
+{
+    return mca_spml_sm_copy(ctx, dst_addr, size, src_addr, dst, true);
+}
+
+int mca_spml_sm_fence(shmem_ctx_t ctx)
+{
+    opal_atomic_wmb();
+    return OSHMEM_SUCCESS;
+}
+
+int mca_spml_sm_quiet(shmem_ctx_t ctx)
+{
+    opal_atomic_mb();
+    return OSHMEM_SUCCESS;
+}
+
+/* blocking receive */
+int mca_spml_sm_recv(void* buf, size_t size, int src)
+{
+    int rc = OSHMEM_SUCCESS;
+
+    rc = MCA_PML_CALL(recv(buf,
+                size,
+                &(ompi_mpi_unsigned_char.dt),
+                src,
+                0,
+                &(ompi_mpi_comm_world.comm),
+                NULL));
+
+    return rc;
+}
+
+/* for now only do blocking copy send */
+int mca_spml_sm_send(void* buf,
+                     size_t size,
+                     int dst,
+                     mca_spml_base_put_mode_t mode)
+{
+    int rc = OSHMEM_SUCCESS;
+
+    rc = MCA_PML_CALL(send(buf,
+                size,
+                &(ompi_mpi_unsigned_char.dt),
+                dst,
+                0,
+                (mca_pml_base_send_mode_t)mode,
+                &(ompi_mpi_comm_world.comm)));
+
+    return rc;
+}
+
+/*
+ * Update a signal mapped in our address space. The caller orders the
+ * update after the payload.
+ */
+static inline void mca_spml_sm_signal_update(void *ptr, uint64_t signal, int sig_op)
+{
+    if (sig_op == SHMEM_SIGNAL_SET) {
+#if SIZEOF_VOID_P == 8
+        /* aligned 64-bit stores are single-copy atomic, no need for the
+         * locked exchange */
+        *(volatile uint64_t *)ptr = signal;
+#else
+        (void) opal_atomic_swap_64((opal_atomic_int64_t *)ptr, (int64_t)signal);
+#endif
+    } else {
+        (void) opal_atomic_add_fetch_64((opal_atomic_int64_t *)ptr, (int64_t)signal);
+    }
+}
+
+static inline int mca_spml_sm_signal(shmem_ctx_t ctx,
+                                     uint64_t *sig_addr,
+                                     uint64_t signal,
+                                     int sig_op,
+                                     int dst)
+{
+    sshmem_mkey_t *mkey;
+    void *rva, *ptr;
+
+    mkey = mca_spml_sm_mkey(ctx, dst, (void *)sig_addr, &rva);
+    if (OPAL_UNLIKELY(NULL == mkey)) {
+        return OSHMEM_ERROR;
+    }
+
+    /* update the signal directly when it is mapped, the data was already
+     * ordered by the caller */
+    ptr = mca_spml_sm_local_ptr(mkey, rva);
+    if (OPAL_LIKELY(NULL != ptr)) {
+        mca_spml_sm_signal_update(ptr, signal, sig_op);
+        return OSHMEM_SUCCESS;
+    }
+
+    if (sig_op == SHMEM_SIGNAL_SET) {
+        return MCA_ATOMIC_CALL(set(ctx, (void*)sig_addr, signal,
+                                   sizeof(uint64_t), dst));
+    }
+
+    return MCA_ATOMIC_CALL(add(ctx, (void*)sig_addr, signal,
+                               sizeof(uint64_t), dst));
+}
+
+/*
+ * When both the payload and the signal are mapped the whole operation is
+ * a copy, a store barrier and a single store or atomic add on the signal.
+ * Anything reached through smsc takes the generic put, fence and signal
+ * path.
+ */
+int mca_spml_sm_put_signal(shmem_ctx_t ctx, void* dst_addr, size_t size, void*
+        src_addr, uint64_t *sig_addr, uint64_t signal, int sig_op, int dst)
+{
+    sshmem_mkey_t *mkey;
+    void *rva, *data_ptr, *sig_ptr;
+    int res;
+
+    if ((sig_op != SHMEM_SIGNAL_SET) && (sig_op != SHMEM_SIGNAL_ADD)) {
+        SPML_SM_ERROR("Invalid signal operation: %d", sig_op);
+        return OSHMEM_ERR_NOT_IMPLEMENTED;
+    }
+
+    mkey = mca_spml_sm_mkey(ctx, dst, (void *)sig_addr, &rva);
+    if (OPAL_UNLIKELY(NULL == mkey)) {
+        return OSHMEM_ERROR;
+    }
+    sig_ptr = mca_spml_sm_local_ptr(mkey, rva);
+
+    data_ptr = sig_ptr;
+    if (0 != size) {
+        mkey = mca_spml_sm_mkey(ctx, dst, dst_addr, &rva);
+        if (OPAL_UNLIKELY(NULL == mkey)) {
+            return OSHMEM_ERROR;
+        }
+        data_ptr = mca_spml_sm_local_ptr(mkey, rva);
+    }
+
+    if (OPAL_LIKELY((NULL != sig_ptr) && (NULL != data_ptr))) {
+        memcpy(data_ptr, src_addr, size);
+        opal_atomic_wmb();
+        mca_spml_sm_signal_update(sig_ptr, signal, sig_op);
+        return OSHMEM_SUCCESS;
+    }
+
+    res = mca_spml_sm_put(ctx, dst_addr, size, src_addr, dst);
+    if (OPAL_UNLIKELY(OSHMEM_SUCCESS != res)) {
+        return res;
+    }
+
+    mca_spml_sm_fence(ctx);
+
+    return mca_spml_sm_signal(ctx, sig_addr, signal, sig_op, dst);
+}
+
+int mca_spml_sm_put_signal_nb(shmem_ctx_t ctx, void* dst_addr, size_t size,
+        void* src_addr, uint64_t *sig_addr, uint64_t signal, int sig_op, int
+        dst)
+{
+    return mca_spml_sm_put_signal(ctx, dst_addr, size, src_addr, sig_addr,
+                                  signal, sig_op, dst);
+}
+
+int mca_spml_sm_put_all_nb(void *dest, const void *source, size_t size, long *counter)
+{
+    int my_pe = oshmem_my_proc_id();
+    long val  = 1;
+    int peer, dst_pe, rc;
+
+    for (peer = 0; peer < oshmem_num_procs(); peer++) {
+        dst_pe = (peer + my_pe) % oshmem_num_procs();
+        rc = mca_spml_sm_put(oshmem_ctx_default,
+                             (void*)((uintptr_t)dest + my_pe * size),
+                             size,
+                             (void*)((uintptr_t)source + dst_pe * size),
+                             dst_pe);
+        RUNTIME_CHECK_RC(rc);
+
+        mca_spml_sm_fence(oshmem_ctx_default);
+
+        rc = MCA_ATOMIC_CALL(add(oshmem_ctx_default, (void*)counter, val, sizeof(val), dst_pe));
+        RUNTIME_CHECK_RC(rc);
+    }
+
+    return OSHMEM_SUCCESS;
+}
+
+/* This routine is not implemented */
+int mca_spml_sm_team_sync(shmem_team_t team)
+{
+    return OSHMEM_ERR_NOT_IMPLEMENTED;
+}
+
+int mca_spml_sm_team_my_pe(shmem_team_t team)
+{
+    mca_spml_sm_team_t *sm_team = (mca_spml_sm_team_t *)team;
+
+    if (team == SHMEM_TEAM_WORLD) {
+        return oshmem_my_proc_id();
+    }
+
+    return sm_team->my_pe;
+}
+
+int mca_spml_sm_team_n_pes(shmem_team_t team)
+{
+    mca_spml_sm_team_t *sm_team = (mca_spml_sm_team_t *)team;
+
+    if (team == SHMEM_TEAM_WORLD) {
+        return oshmem_num_procs();
+    }
+
+    return sm_team->n_pes;
+}
+
+int mca_spml_sm_team_get_config(shmem_team_t team, long config_mask,
+        shmem_team_config_t *config)
+{
+    mca_spml_sm_team_t *sm_team = (mca_spml_sm_team_t *)team;
+    SPML_SM_VALIDATE_TEAM(team);
+
+    memcpy(config, &sm_team->config->super, sizeof(shmem_team_config_t));
+
+    return SHMEM_SUCCESS;
+}
+
+static inline int mca_spml_sm_is_pe_in_strided_team(int src_pe, int start,
+                                                    int stride, int size)
+{
+    return (src_pe >= start) && (src_pe < start + size * stride)
+           && ((src_pe - start) % stride == 0);
+}
+
+int mca_spml_sm_team_translate_pe(shmem_team_t src_team, int src_pe,
+                                  shmem_team_t dest_team)
+{
+    mca_spml_sm_team_t *sm_src_team  = (mca_spml_sm_team_t*) src_team;
+    mca_spml_sm_team_t *sm_dest_team = (mca_spml_sm_team_t*) dest_team;
+    int global_pe;
+
+    if ((src_pe == SPML_SM_PE_NOT_IN_TEAM) || (src_team == dest_team)) {
+        return src_pe;
+    }
+
+    global_pe = (src_team == SHMEM_TEAM_WORLD) ? src_pe :
+                sm_src_team->start + src_pe * sm_src_team->stride;
+
+    if (dest_team == SHMEM_TEAM_WORLD) {
+        return global_pe;
+    }
+
+    if (!mca_spml_sm_is_pe_in_strided_team(global_pe, sm_dest_team->start, sm_dest_team->stride,
+                                           sm_dest_team->n_pes)) {
+        return SPML_SM_PE_NOT_IN_TEAM;
+    }
+
+    return (global_pe - sm_dest_team->start) / sm_dest_team->stride;
+}
+
+int mca_spml_sm_team_split_strided(shmem_team_t parent_team, int start, int
+        stride, int size, const shmem_team_config_t *config, long config_mask,
+        shmem_team_t *new_team)
+{
+    mca_spml_sm_team_t *sm_parent_team;
+    mca_spml_sm_team_t *sm_new_team;
+    int parent_pe;
+    int parent_start;
+    int parent_stride;
+    int my_pe;
+
+    assert(((start + size * stride) <= oshmem_num_procs()) &&
+           (stride > 0) && (size > 0));
+
+    if (parent_team == SHMEM_TEAM_WORLD) {
+        parent_pe = oshmem_my_proc_id();
+        parent_start = 0;
+        parent_stride = 1;
+    } else {
+        sm_parent_team = (mca_spml_sm_team_t*) parent_team;
+        parent_pe = sm_parent_team->my_pe;
+        parent_start = sm_parent_team->start;
+        parent_stride = sm_parent_team->stride;
+    }
+
+    if (mca_spml_sm_is_pe_in_strided_team(parent_pe, start, stride, size)) {
+        my_pe = (parent_pe - start) / stride;
+    } else {
+        /* not in team, SHMEM_TEAM_INVALID is NULL which could be taken
+         * for the first PE, therefore -1 is used */
+        my_pe = SPML_SM_PE_NOT_IN_TEAM;
+    }
+
+    /* start and stride are relative to the world team to simplify the
+     * translations */
+    sm_new_team = (mca_spml_sm_team_t *)malloc(sizeof(mca_spml_sm_team_t));
+    if (NULL == sm_new_team) {
+        return OSHMEM_ERR_OUT_OF_RESOURCE;
+    }
+    sm_new_team->start = parent_start + (start * parent_stride);
+    sm_new_team->stride = parent_stride * stride;
+
+    sm_new_team->n_pes = size;
+    sm_new_team->my_pe = my_pe;
+
+    sm_new_team->config = calloc(1, sizeof(mca_spml_sm_team_config_t));
+    if (NULL == sm_new_team->config) {
+        free(sm_new_team);
+        return OSHMEM_ERR_OUT_OF_RESOURCE;
+    }
+
+    if (config != NULL) {
+        memcpy(&sm_new_team->config->super, config, sizeof(shmem_team_config_t));
+    }
+
+    sm_new_team->parent_team = (mca_spml_sm_team_t*)parent_team;
+
+    *new_team = (shmem_team_t)sm_new_team;
+
+    return OSHMEM_SUCCESS;
+}
+
+int mca_spml_sm_team_split_2d(shmem_team_t parent_team, int xrange, const
+        shmem_team_config_t *xaxis_config, long xaxis_mask, shmem_team_t
+        *xaxis_team, const shmem_team_config_t *yaxis_config, long yaxis_mask,
+        shmem_team_t *yaxis_team)
+{
+    mca_spml_sm_team_t *sm_parent_team = (mca_spml_sm_team_t*) parent_team;
+    int parent_n_pes = (parent_team == SHMEM_TEAM_WORLD) ?
+                                        oshmem_num_procs() :
+                                        sm_parent_team->n_pes;
+    int parent_my_pe = (parent_team == SHMEM_TEAM_WORLD) ?
+                                        oshmem_my_proc_id() :
+                                        sm_parent_team->my_pe;
+    int yrange = parent_n_pes / xrange;
+    int pe_x = parent_my_pe % xrange;
+    int pe_y = parent_my_pe / xrange;
+    int rc;
+
+    /* Create x-team of my_pe */
+    rc = mca_spml_sm_team_split_strided(parent_team, pe_y * xrange, 1, xrange,
+                                        xaxis_config, xaxis_mask, xaxis_team);
+    if (rc != OSHMEM_SUCCESS) {
+        SPML_SM_ERROR("mca_spml_sm_team_split_strided failed (x-axis team creation)");
+        return rc;
+    }
+
+    /* Create y-team of my_pe */
+    rc = mca_spml_sm_team_split_strided(parent_team, pe_x, xrange, yrange,
+                                        yaxis_config, yaxis_mask, yaxis_team);
+    if (rc != OSHMEM_SUCCESS) {
+        SPML_SM_ERROR("mca_spml_sm_team_split_strided failed (y-axis team creation)");
+        mca_spml_sm_team_destroy(*xaxis_team);
+        return rc;
+    }
+
+    return OSHMEM_SUCCESS;
+}
+
+int mca_spml_sm_team_destroy(shmem_team_t team)
+{
+    mca_spml_sm_team_t *sm_team = (mca_spml_sm_team_t *)team;
+
+    SPML_SM_VALIDATE_TEAM(team);
+
+    free(sm_team->config);
+    free(team);
+
+    return OSHMEM_SUCCESS;
+}
+
+/* This routine is not implemented */
+int mca_spml_sm_team_get(shmem_ctx_t ctx, shmem_team_t *team)
+{
+    return OSHMEM_ERR_NOT_IMPLEMENTED;
+}
+
+/* This routine is not implemented */
+int mca_spml_sm_team_create_ctx(shmem_team_t team, long options, shmem_ctx_t *ctx)
+{
+    return OSHMEM_ERR_NOT_IMPLEMENTED;
+}
+
+/* This routine is not implemented */
+int mca_spml_sm_team_alltoall(shmem_team_t team, void
+        *dest, const void *source, size_t nelems, int datatype)
+{
+    return OSHMEM_ERR_NOT_IMPLEMENTED;
+}
+
+/* This routine is not implemented */
+int mca_spml_sm_team_alltoalls(shmem_team_t team, void
+        *dest, const void *source, ptrdiff_t dst, ptrdiff_t sst, size_t nelems,
+        int datatype)
+{
+    return OSHMEM_ERR_NOT_IMPLEMENTED;
+}
+
+/* This routine is not implemented */
+int mca_spml_sm_team_broadcast(shmem_team_t team, void
+        *dest, const void *source, size_t nelems, int PE_root, int datatype)
+{
+    return OSHMEM_ERR_NOT_IMPLEMENTED;
+}
+
+/* This routine is not implemented */
+int mca_spml_sm_team_collect(shmem_team_t team, void
+        *dest, const void *source, size_t nelems, int datatype)
+{
+    return OSHMEM_ERR_NOT_IMPLEMENTED;
+}
+
+/* This routine is not implemented */
+int mca_spml_sm_team_fcollect(shmem_team_t team, void
+        *dest, const void *source, size_t nelems, int datatype)
+{
+    return OSHMEM_ERR_NOT_IMPLEMENTED;
+}
+
+/* This routine is not implemented */
+int mca_spml_sm_team_reduce(shmem_team_t team, void
+        *dest, const void *source, size_t nreduce, int operation, int datatype)
+{
+    return OSHMEM_ERR_NOT_IMPLEMENTED;
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026      NVIDIA Corporation.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+/**
+ * @file
+ */
+#ifndef MCA_SPML_SM_H
+#define MCA_SPML_SM_H
+
+#include "oshmem_config.h"
+#include "oshmem/request/request.h"
+#include "oshmem/mca/spml/spml.h"
+#include "oshmem/mca/spml/base/base.h"
+#include "oshmem/util/oshmem_util.h"
+#include "oshmem/proc/proc.h"
+#include "oshmem/runtime/runtime.h"
+
+#include "oshmem/mca/memheap/memheap.h"
+#include "oshmem/mca/memheap/base/base.h"
+
+#include "opal/mca/smsc/smsc.h"
+
+BEGIN_C_DECLS
+
+#define SPML_SM_ERROR(...)          SPML_ERROR(__VA_ARGS__)
+#define SPML_SM_WARN(...)           SPML_WARNING(__VA_ARGS__)
+#define SPML_SM_VERBOSE(level, ...) SPML_VERBOSE(level, __VA_ARGS__)
+#define SPML_SM_TRANSP_IDX 0
+#define SPML_SM_TRANSP_CNT 1
+#define SPML_SM_PE_NOT_IN_TEAM -1
+
+#define SPML_SM_VALIDATE_TEAM(_team)                        \
+    do {                                                    \
+        if (OPAL_UNLIKELY((_team) == SHMEM_TEAM_INVALID)) { \
+            SPML_SM_ERROR("Invalid team at %s", __func__);  \
+            return OSHMEM_ERROR;                            \
+        }                                                   \
+    } while (0)
+
+/**
+ * Shared memory SPML module
+ *
+ * Segments created by sshmem as shared segments are attached by memheap
+ * during the key exchange and are accessed with load/store. The other
+ * segments (the data segment of the executable and heaps that could not
+ * be shared) are accessed through the single-copy mechanism selected by
+ * smsc, either by mapping them into our address space or by copying.
+ */
+struct spml_sm_mkey {
+    void *local_base;   /* peer segment mapped into our address space */
+    void *map_ctx;      /* smsc mapping, released with the key */
+    void *reg_data;     /* peer registration data if smsc requires it */
+};
+typedef struct spml_sm_mkey spml_sm_mkey_t;
+
+struct spml_sm_peer {
+    mca_smsc_endpoint_t *endpoint;
+    spml_sm_mkey_t     **mkeys;
+    size_t               mkeys_cnt;
+};
+typedef struct spml_sm_peer spml_sm_peer_t;
+
+struct mca_spml_sm_ctx {
+    long options;
+};
+typedef struct mca_spml_sm_ctx mca_spml_sm_ctx_t;
+
+extern mca_spml_sm_ctx_t mca_spml_sm_ctx_default;
+
+typedef struct mca_spml_sm_team_config {
+    shmem_team_config_t super;
+} mca_spml_sm_team_config_t;
+
+typedef struct mca_spml_sm_team {
+    int                        n_pes;
+    int                        my_pe;
+    int                        stride;
+    int                        start;
+    mca_spml_sm_team_config_t *config;
+    struct mca_spml_sm_team   *parent_team;
+} mca_spml_sm_team_t;
+
+struct mca_spml_sm {
+    mca_spml_base_module_t  super;
+    spml_sm_peer_t         *peers;
+    int                     priority; /* component priority */
+    bool                    enabled;
+};
+typedef struct mca_spml_sm mca_spml_sm_t;
+
+extern mca_spml_sm_t mca_spml_sm;
+
+extern int mca_spml_sm_enable(bool enable);
+extern int mca_spml_sm_ctx_create(long options,
+                                  shmem_ctx_t *ctx);
+extern void mca_spml_sm_ctx_destroy(shmem_ctx_t ctx);
+extern int mca_spml_sm_get(shmem_ctx_t ctx,
+                           void* dst_addr,
+                           size_t size,
+                           void* src_addr,
+                           int src);
+extern int mca_spml_sm_get_nb(shmem_ctx_t ctx,
+                              void* dst_addr,
+                              size_t size,
+                              void* src_addr,
+                              int src,
+                              void **handle);
+extern int mca_spml_sm_put(shmem_ctx_t ctx,
+                           void* dst_addr,
+                           size_t size,
+                           void* src_addr,
+                           int dst);
+extern int mca_spml_sm_put_nb(shmem_ctx_t ctx,
+                              void* dst_addr,
+                              size_t size,
+                              void* src_addr,
+                              int dst,
+                              void **handle);
+extern int mca_spml_sm_put_signal(shmem_ctx_t ctx,
+                                  void* dst_addr,
+                                  size_t size,
+                                  void* src_addr,
+                                  uint64_t *sig_addr,
+                                  uint64_t signal,
+                                  int sig_op,
+                                  int dst);
+extern int mca_spml_sm_put_signal_nb(shmem_ctx_t ctx,
+                                     void* dst_addr,
+                                     size_t size,
+                                     void* src_addr,
+                                     uint64_t *sig_addr,
+                                     uint64_t signal,
+                                     int sig_op,
+                                     int dst);
+extern int mca_spml_sm_recv(void* buf, size_t size, int src);
+extern int mca_spml_sm_send(void* buf,
+                            size_t size,
+                            int dst,
+                            mca_spml_base_put_mode_t mode);
+extern int mca_spml_sm_put_all_nb(void *target, const void *source,
+                                  size_t size, long *counter);
+
+extern sshmem_mkey_t *mca_spml_sm_register(void* addr,
+                                           size_t size,
+                                           uint64_t shmid,
+                                           int *count);
+extern int mca_spml_sm_deregister(sshmem_mkey_t *mkeys);
+extern void mca_spml_sm_rmkey_unpack(shmem_ctx_t ctx, sshmem_mkey_t *mkey,
+                                     uint32_t segno, int pe, int tr_id);
+extern void mca_spml_sm_rmkey_free(sshmem_mkey_t *mkey, int pe);
+extern void *mca_spml_sm_rmkey_ptr(const void *dst_addr, sshmem_mkey_t *mkey, int pe);
+
+extern int mca_spml_sm_add_procs(oshmem_group_t* group, size_t nprocs);
+extern int mca_spml_sm_del_procs(oshmem_group_t* group, size_t nprocs);
+extern int mca_spml_sm_fence(shmem_ctx_t ctx);
+extern int mca_spml_sm_quiet(shmem_ctx_t ctx);
+
+extern int mca_spml_sm_team_sync(shmem_team_t team);
+extern int mca_spml_sm_team_my_pe(shmem_team_t team);
+extern int mca_spml_sm_team_n_pes(shmem_team_t team);
+extern int mca_spml_sm_team_get_config(shmem_team_t team, long config_mask,
+                                       shmem_team_config_t *config);
+extern int mca_spml_sm_team_translate_pe(shmem_team_t src_team, int src_pe,
+                                         shmem_team_t dest_team);
+extern int mca_spml_sm_team_split_strided(shmem_team_t parent_team, int start,
+                                          int stride, int size,
+                                          const shmem_team_config_t *config,
+                                          long config_mask, shmem_team_t *new_team);
+extern int mca_spml_sm_team_split_2d(shmem_team_t parent_team, int xrange,
+                                     const shmem_team_config_t *xaxis_config,
+                                     long xaxis_mask, shmem_team_t *xaxis_team,
+                                     const shmem_team_config_t *yaxis_config,
+                                     long yaxis_mask, shmem_team_t *yaxis_team);
+extern int mca_spml_sm_team_destroy(shmem_team_t team);
+extern int mca_spml_sm_team_get(shmem_ctx_t ctx, shmem_team_t *team);
+extern int mca_spml_sm_team_create_ctx(shmem_team_t team, long options,
+                                       shmem_ctx_t *ctx);
+extern int mca_spml_sm_team_alltoall(shmem_team_t team, void *dest,
+                                     const void *source, size_t nelems,
+                                     int datatype);
+extern int mca_spml_sm_team_alltoalls(shmem_team_t team, void *dest,
+                                      const void *source, ptrdiff_t dst,
+                                      ptrdiff_t sst, size_t nelems,
+                                      int datatype);
+extern int mca_spml_sm_team_broadcast(shmem_team_t team, void *dest,
+                                      const void *source, size_t nelems,
+                                      int PE_root, int datatype);
+extern int mca_spml_sm_team_collect(shmem_team_t team, void *dest,
+                                    const void *source, size_t nelems,
+                                    int datatype);
+extern int mca_spml_sm_team_fcollect(shmem_team_t team, void *dest,
+                                     const void *source, size_t nelems,
+                                     int datatype);
+extern int mca_spml_sm_team_reduce(shmem_team_t team, void *dest,
+                                   const void *source, size_t nreduce,
+                                   int operation, int datatype);
+
+END_C_DECLS
+
+#endif
@@ -73,19 +73,19 @@ mca_spml_ucx_t mca_spml_ucx = {
         .spml_put_all_nb    = mca_spml_ucx_put_all_nb,
         .spml_wait                      = mca_spml_base_wait,
         .spml_wait_nb                   = mca_spml_base_wait_nb,
-        .spml_wait_until_all            = mca_spml_ucx_wait_until_all,
-        .spml_wait_until_any            = mca_spml_ucx_wait_until_any,
-        .spml_wait_until_some           = mca_spml_ucx_wait_until_some,
-        .spml_wait_until_all_vector     = mca_spml_ucx_wait_until_all_vector,
-        .spml_wait_until_any_vector     = mca_spml_ucx_wait_until_any_vector,
-        .spml_wait_until_some_vector    = mca_spml_ucx_wait_until_some_vector,
+        .spml_wait_until_all            = mca_spml_base_wait_until_all,
+        .spml_wait_until_any            = mca_spml_base_wait_until_any,
+        .spml_wait_until_some           = mca_spml_base_wait_until_some,
+        .spml_wait_until_all_vector     = mca_spml_base_wait_until_all_vector,
+        .spml_wait_until_any_vector     = mca_spml_base_wait_until_any_vector,
+        .spml_wait_until_some_vector    = mca_spml_base_wait_until_some_vector,
         .spml_test                      = mca_spml_base_test,
-        .spml_test_all          	= mca_spml_ucx_test_all,
-        .spml_test_any          	= mca_spml_ucx_test_any,
-        .spml_test_some         	= mca_spml_ucx_test_some,
-        .spml_test_all_vector   	= mca_spml_ucx_test_all_vector,
-        .spml_test_any_vector   	= mca_spml_ucx_test_any_vector,
-        .spml_test_some_vector  	= mca_spml_ucx_test_some_vector,
+        .spml_test_all          	= mca_spml_base_test_all,
+        .spml_test_any          	= mca_spml_base_test_any,
+        .spml_test_some         	= mca_spml_base_test_some,
+        .spml_test_all_vector   	= mca_spml_base_test_all_vector,
+        .spml_test_any_vector   	= mca_spml_base_test_any_vector,
+        .spml_test_some_vector  	= mca_spml_base_test_some_vector,
         .spml_team_sync                 = mca_spml_ucx_team_sync,
         .spml_team_my_pe                = mca_spml_ucx_team_my_pe,
         .spml_team_n_pes                = mca_spml_ucx_team_n_pes,
@@ -1663,9 +1663,68 @@ static inline int mca_spml_ucx_signal(shmem_ctx_t ctx,
     return OSHMEM_ERR_NOT_IMPLEMENTED;
 }
 
+/*
+ * Order the signal after the payload. Both go through the endpoint to the
+ * destination PE which belongs to the first worker of the context, so the
+ * fence of the other workers and of the other endpoints is not needed
+ * unless strong ordering was requested.
+ */
+static inline int mca_spml_ucx_signal_fence(mca_spml_ucx_ctx_t *ucx_ctx)
+{
+    ucs_status_t err;
+
+    if (ucx_ctx->strong_sync != SPML_UCX_STRONG_ORDERING_NONE) {
+        return mca_spml_ucx_fence((shmem_ctx_t)ucx_ctx);
+    }
+
+    opal_atomic_wmb();
+
+    err = ucp_worker_fence(ucx_ctx->ucp_worker[0]);
+    if (UCS_OK != err) {
+        SPML_UCX_ERROR("fence failed: %s", ucs_status_string(err));
+        oshmem_shmem_abort(-1);
+        return OSHMEM_ERROR;
+    }
+
+    return OSHMEM_SUCCESS;
+}
+
 int mca_spml_ucx_put_signal(shmem_ctx_t ctx, void* dst_addr, size_t size, void*
         src_addr, uint64_t *sig_addr, uint64_t signal, int sig_op, int dst)
 {
+#if HAVE_DECL_UCP_PUT_NBX
+    mca_spml_ucx_ctx_t *ucx_ctx = (mca_spml_ucx_ctx_t *)ctx;
+    spml_ucx_mkey_t *ucx_mkey;
+    ucs_status_ptr_t request;
+    void *rva = NULL;
+    int res, wait_res;
+
+    if ((sig_op != SHMEM_SIGNAL_SET) && (sig_op != SHMEM_SIGNAL_ADD)) {
+        SPML_UCX_ERROR("Invalid signal operation: %d", sig_op);
+        return OSHMEM_ERR_NOT_IMPLEMENTED;
+    }
+
+    ucx_mkey = mca_spml_ucx_ctx_mkey_by_va(ctx, dst, dst_addr, &rva, &mca_spml_ucx);
+    assert(NULL != ucx_mkey);
+
+    /* the payload and the signal are posted back to back, the source
+     * buffer only has to be released before returning */
+    request = ucp_put_nbx(ucx_ctx->ucp_peers[dst].ucp_conn, src_addr, size,
+                          (uint64_t)rva, ucx_mkey->rkey, &mca_spml_ucx_request_param_b);
+    if (OPAL_UNLIKELY(UCS_PTR_IS_ERR(request))) {
+        return ucx_status_to_oshmem(UCS_PTR_STATUS(request));
+    }
+    mca_spml_ucx_remote_op_posted(ucx_ctx, dst);
+
+    res = mca_spml_ucx_signal_fence(ucx_ctx);
+    if (OPAL_LIKELY(OSHMEM_SUCCESS == res)) {
+        res = mca_spml_ucx_signal(ctx, sig_addr, signal, sig_op, dst);
+    }
+
+    wait_res = opal_common_ucx_wait_request(request, ucx_ctx->ucp_worker[0], "ucp_put_nbx");
+
+    return (OSHMEM_SUCCESS != res) ? res : wait_res;
+#else
     int res;
 
     res = mca_spml_ucx_put(ctx, dst_addr, size, src_addr, dst);
@@ -1679,6 +1738,7 @@ int mca_spml_ucx_put_signal(shmem_ctx_t ctx, void* dst_addr, size_t size, void*
     }
 
     return mca_spml_ucx_signal(ctx, sig_addr, signal, sig_op, dst);
+#endif
 }
 
 int mca_spml_ucx_put_signal_nb(shmem_ctx_t ctx, void* dst_addr, size_t size,
@@ -1692,7 +1752,7 @@ int mca_spml_ucx_put_signal_nb(shmem_ctx_t ctx, void* dst_addr, size_t size,
         return res;
     }
 
-    res = mca_spml_ucx_fence(ctx);
+    res = mca_spml_ucx_signal_fence((mca_spml_ucx_ctx_t *)ctx);
     if (OPAL_UNLIKELY(OSHMEM_SUCCESS != res)) {
         return res;
     }
@@ -1700,96 +1760,6 @@ int mca_spml_ucx_put_signal_nb(shmem_ctx_t ctx, void* dst_addr, size_t size,
     return mca_spml_ucx_signal(ctx, sig_addr, signal, sig_op, dst);
 }
 
-/* This routine is not implemented */
-void mca_spml_ucx_wait_until_all(void *ivars, int cmp, void
-        *cmp_value, size_t nelems, const int *status, int datatype)
-{
-    RUNTIME_SHMEM_NOT_IMPLEMENTED_API_ABORT();
-}
-
-/* This routine is not implemented */
-size_t mca_spml_ucx_wait_until_any(void *ivars, int cmp, void
-        *cmp_value, size_t nelems, const int *status, int datatype)
-{
-    RUNTIME_SHMEM_NOT_IMPLEMENTED_API_ABORT_RET_SIZE_T();
-}
-
-/* This routine is not implemented */
-size_t mca_spml_ucx_wait_until_some(void *ivars, int cmp, void
-        *cmp_value, size_t nelems, size_t *indices, const int *status, int
-        datatype)
-{
-    RUNTIME_SHMEM_NOT_IMPLEMENTED_API_ABORT_RET_SIZE_T();
-}
-
-/* This routine is not implemented */ 
-void mca_spml_ucx_wait_until_all_vector(void *ivars, int cmp, void
-        *cmp_values, size_t nelems, const int *status, int datatype)
-{
-    RUNTIME_SHMEM_NOT_IMPLEMENTED_API_ABORT();
-}
-
-/* This routine is not implemented */
-size_t mca_spml_ucx_wait_until_any_vector(void *ivars, int cmp, void
-        *cmp_value, size_t nelems, const int *status, int datatype)
-{
-    RUNTIME_SHMEM_NOT_IMPLEMENTED_API_ABORT_RET_SIZE_T();
-}
-
-/* This routine is not implemented */
-size_t mca_spml_ucx_wait_until_some_vector(void *ivars, int cmp, void
-        *cmp_value, size_t nelems, size_t *indices, const int *status, int
-        datatype)
-{
-    RUNTIME_SHMEM_NOT_IMPLEMENTED_API_ABORT_RET_SIZE_T();
-}
-
-/* This routine is not implemented */
-int mca_spml_ucx_test_all(void *ivars, int cmp, void *cmp_value,
-        size_t nelems, const int *status, int datatype)
-{
-    return OSHMEM_ERR_NOT_IMPLEMENTED;
-}
-
-/* This routine is not implemented */
-size_t mca_spml_ucx_test_any(void *ivars, int cmp, void *cmp_value,
-        size_t nelems, const int *status, int datatype)
-{
-    RUNTIME_SHMEM_NOT_IMPLEMENTED_API_ABORT_RET_SIZE_T();
-}
-
-/* This routine is not implemented */
-size_t mca_spml_ucx_test_some(void *ivars, int cmp, void *cmp_value,
-        size_t nelems, size_t *indices, const int *status, int datatype)
-{
-    RUNTIME_SHMEM_NOT_IMPLEMENTED_API_ABORT_RET_SIZE_T();
-}
-
-/* This routine is not implemented */
-int mca_spml_ucx_test_all_vector(void *ivars, int cmp, void *cmp_values,
-                                 size_t nelems, const int *status,
-                                 int datatype)
-{
-    return OSHMEM_ERR_NOT_IMPLEMENTED;
-}
-
-/* This routine is not implemented */
-size_t mca_spml_ucx_test_any_vector(void *ivars, int cmp,
-                                    void *cmp_values, size_t nelems,
-                                    const int *status, int datatype)
-{
-    RUNTIME_SHMEM_NOT_IMPLEMENTED_API_ABORT_RET_SIZE_T();
-}
-
-/* This routine is not implemented */
-size_t mca_spml_ucx_test_some_vector(void *ivars, int cmp,
-                                     void *cmp_values, size_t nelems,
-                                     size_t *indices, const int *status,
-                                     int datatype)
-{
-    RUNTIME_SHMEM_NOT_IMPLEMENTED_API_ABORT_RET_SIZE_T();
-}
-
 /* This routine is not implemented */
 int mca_spml_ucx_team_sync(shmem_team_t team)
 {
@@ -24,6 +24,12 @@ BEGIN_C_DECLS
 
 extern void* mca_sshmem_base_start_address;
 extern char* mca_sshmem_base_backing_file_dir;
+extern size_t mca_sshmem_base_hugepage_size;
+/* huge page size the symmetric heap has to be sized and aligned to, set by
+ * the selected component when it backs the heap with huge pages (0 otherwise) */
+extern size_t mca_sshmem_base_hugepage_align;
+extern bool mca_sshmem_base_numa_bind;
+extern bool mca_sshmem_base_report;
 
 /* ////////////////////////////////////////////////////////////////////////// */
 /* Public API for the sshmem framework */
@@ -151,6 +157,26 @@ OSHMEM_DECLSPEC extern void shmem_ds_reset(map_segment_t *ds_buf);
  */
 OSHMEM_DECLSPEC extern char * oshmem_get_unique_file_name(uint64_t pe);
 
+/*
+ * Huge page size requested with sshmem_base_hugepage_size or the
+ * default huge page size of the system
+ */
+OSHMEM_DECLSPEC extern size_t mca_sshmem_base_get_hugepage_size(void);
+
+/*
+ * Log2 of a huge page size, as expected by MAP_HUGE_SHIFT/SHM_HUGE_SHIFT
+ */
+OSHMEM_DECLSPEC extern int mca_sshmem_base_get_hugepage_shift(size_t page_size);
+
+/*
+ * Apply the NUMA placement policy to a newly created segment and report
+ * its page size and placement
+ */
+OSHMEM_DECLSPEC extern int mca_sshmem_base_segment_place(map_segment_t *ds_buf,
+                                                         const char *component,
+                                                         size_t page_size,
+                                                         bool transparent);
+
 END_C_DECLS
 
 #endif /* MCA_SSHMEM_BASE_H */
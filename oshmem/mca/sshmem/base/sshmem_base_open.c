@@ -12,6 +12,7 @@
 
 #include "opal/constants.h"
 #include "opal/util/output.h"
+#include "opal/util/show_help.h"
 #include "oshmem/mca/mca.h"
 #include "opal/mca/base/base.h"
 #include "opal/mca/base/mca_base_var.h"
@@ -35,6 +36,14 @@ void *mca_sshmem_base_start_address = (void *)UINTPTR_MAX;
 
 char * mca_sshmem_base_backing_file_dir = NULL;
 
+size_t mca_sshmem_base_hugepage_size = 0;
+
+size_t mca_sshmem_base_hugepage_align = 0;
+
+bool mca_sshmem_base_numa_bind = false;
+
+bool mca_sshmem_base_report = false;
+
 /* ////////////////////////////////////////////////////////////////////////// */
 /**
  * Register some sshmem-wide MCA params
@@ -74,6 +83,55 @@ mca_sshmem_base_register (mca_base_register_flag_t flags)
                                  OPAL_INFO_LVL_9,
                                  MCA_BASE_VAR_SCOPE_READONLY,
                                  &mca_sshmem_base_backing_file_dir);
+
+    mca_sshmem_base_hugepage_size = 0;
+    (void) mca_base_var_register("oshmem",
+                                 "sshmem",
+                                 "base",
+                                 "hugepage_size",
+                                 "Size of the huge pages backing the symmetric heap "
+                                 "when huge pages are enabled in the sshmem component, "
+                                 "e.g. 2097152 or 1073741824. The symmetric heap is "
+                                 "rounded up to a multiple of it (default: 0, the "
+                                 "default huge page size of the system)",
+                                 MCA_BASE_VAR_TYPE_SIZE_T,
+                                 NULL,
+                                 0,
+                                 MCA_BASE_VAR_FLAG_SETTABLE,
+                                 OPAL_INFO_LVL_5,
+                                 MCA_BASE_VAR_SCOPE_ALL_EQ,
+                                 &mca_sshmem_base_hugepage_size);
+
+    mca_sshmem_base_numa_bind = false;
+    (void) mca_base_var_register("oshmem",
+                                 "sshmem",
+                                 "base",
+                                 "numa_bind",
+                                 "Bind the symmetric heap of each PE to the NUMA node(s) "
+                                 "local to the cores the PE is bound to instead of "
+                                 "relying on first-touch placement (default: false)",
+                                 MCA_BASE_VAR_TYPE_BOOL,
+                                 NULL,
+                                 0,
+                                 MCA_BASE_VAR_FLAG_SETTABLE,
+                                 OPAL_INFO_LVL_5,
+                                 MCA_BASE_VAR_SCOPE_READONLY,
+                                 &mca_sshmem_base_numa_bind);
+
+    mca_sshmem_base_report = false;
+    (void) mca_base_var_register("oshmem",
+                                 "sshmem",
+                                 "base",
+                                 "report",
+                                 "Report the page size and NUMA placement of the "
+                                 "symmetric heap of every PE at startup (default: false)",
+                                 MCA_BASE_VAR_TYPE_BOOL,
+                                 NULL,
+                                 0,
+                                 MCA_BASE_VAR_FLAG_SETTABLE,
+                                 OPAL_INFO_LVL_5,
+                                 MCA_BASE_VAR_SCOPE_READONLY,
+                                 &mca_sshmem_base_report);
     return OSHMEM_SUCCESS;
 }
 
@@ -81,6 +139,13 @@ static int mca_sshmem_base_open(mca_base_open_flag_t flags)
 {
     oshmem_framework_open_output(&oshmem_sshmem_base_framework);
 
+    /* MAP_HUGE_SHIFT and SHM_HUGE_SHIFT take the log2 of the page size */
+    if (mca_sshmem_base_hugepage_size & (mca_sshmem_base_hugepage_size - 1)) {
+        opal_show_help("help-oshmem-sshmem.txt", "invalid hugepage size", true,
+                       (unsigned long long) mca_sshmem_base_hugepage_size);
+        return OSHMEM_ERR_BAD_PARAM;
+    }
+
     /* Open up all available components */
     if (OPAL_SUCCESS !=
         mca_base_framework_components_open(&oshmem_sshmem_base_framework, flags)) {
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026      NVIDIA Corporation.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+#include "oshmem_config.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "opal/constants.h"
+#include "opal/util/output.h"
+#include "opal/util/sys_limits.h"
+#include "opal/mca/hwloc/base/base.h"
+
+#include "oshmem/proc/proc.h"
+#include "oshmem/mca/sshmem/sshmem.h"
+#include "oshmem/mca/sshmem/base/base.h"
+
+size_t mca_sshmem_base_get_hugepage_size(void)
+{
+    static size_t huge_page_size = 0;
+    char buf[256];
+    int size_kb;
+    FILE *f;
+
+    if (0 != mca_sshmem_base_hugepage_size) {
+        return mca_sshmem_base_hugepage_size;
+    }
+
+    /* Cache the default huge page size of the system */
+    if (huge_page_size == 0) {
+        f = fopen("/proc/meminfo", "r");
+        if (f != NULL) {
+            while (fgets(buf, sizeof(buf), f)) {
+                if (sscanf(buf, "Hugepagesize: %d kB", &size_kb) == 1) {
+                    huge_page_size = size_kb * 1024L;
+                    break;
+                }
+            }
+            fclose(f);
+        }
+
+        if (huge_page_size == 0) {
+            huge_page_size = 2 * 1024L *1024L;
+        }
+    }
+
+    return huge_page_size;
+}
+
+int mca_sshmem_base_get_hugepage_shift(size_t page_size)
+{
+    int shift = 0;
+
+    while ((page_size >>= 1) != 0) {
+        shift++;
+    }
+
+    return shift;
+}
+
+/*
+ * Bind the pages of the segment to the NUMA nodes local to the cores the
+ * PE is bound to. Nothing is done for PEs that are not bound or that may
+ * run on every node, first-touch placement is as good as it gets then.
+ */
+static int sshmem_base_segment_bind(map_segment_t *ds_buf, char **nodes)
+{
+    hwloc_cpuset_t cpuset = NULL;
+    hwloc_nodeset_t nodeset = NULL;
+    int rc = OSHMEM_ERR_NOT_AVAILABLE;
+
+    if (OPAL_SUCCESS != opal_hwloc_base_get_topology()) {
+        return OSHMEM_ERR_NOT_AVAILABLE;
+    }
+
+    cpuset = hwloc_bitmap_alloc();
+    nodeset = hwloc_bitmap_alloc();
+    if ((NULL == cpuset) || (NULL == nodeset)) {
+        rc = OSHMEM_ERR_OUT_OF_RESOURCE;
+        goto out;
+    }
+
+    if (0 != hwloc_get_cpubind(opal_hwloc_topology, cpuset, HWLOC_CPUBIND_PROCESS)) {
+        goto out;
+    }
+    hwloc_cpuset_to_nodeset(opal_hwloc_topology, cpuset, nodeset);
+    if (hwloc_bitmap_iszero(nodeset) ||
+        hwloc_bitmap_isequal(nodeset,
+                             hwloc_topology_get_topology_nodeset(opal_hwloc_topology))) {
+        goto out;
+    }
+
+    if (0 != hwloc_set_area_membind(opal_hwloc_topology,
+                                    ds_buf->super.va_base, ds_buf->seg_size,
+                                    cpuset, HWLOC_MEMBIND_BIND,
+                                    HWLOC_MEMBIND_MIGRATE)) {
+        SSHMEM_WARN("failed to bind segment %p/%llu to the local NUMA node(s): %s",
+                    ds_buf->super.va_base, (unsigned long long)ds_buf->seg_size,
+                    strerror(errno));
+        rc = OSHMEM_ERROR;
+        goto out;
+    }
+
+    hwloc_bitmap_list_asprintf(nodes, nodeset);
+    rc = OSHMEM_SUCCESS;
+
+out:
+    if (NULL != cpuset) {
+        hwloc_bitmap_free(cpuset);
+    }
+    if (NULL != nodeset) {
+        hwloc_bitmap_free(nodeset);
+    }
+    return rc;
+}
+
+int mca_sshmem_base_segment_place(map_segment_t *ds_buf,
+                                  const char *component,
+                                  size_t page_size,
+                                  bool transparent)
+{
+    char *nodes = NULL;
+    char placement[128];
+
+    if (mca_sshmem_base_numa_bind) {
+        (void) sshmem_base_segment_bind(ds_buf, &nodes);
+    }
+
+    if (NULL != nodes) {
+        snprintf(placement, sizeof(placement), "bound to NUMA node(s) %s", nodes);
+        free(nodes);
+    } else {
+        snprintf(placement, sizeof(placement), "first-touch placement");
+    }
+
+    opal_output_verbose((mca_sshmem_base_report ? 0 : 5),
+                        oshmem_sshmem_base_framework.framework_output,
+                        "PE %d: %s segment %p-%p (%llu bytes), %llu kB %s pages, %s",
+                        oshmem_my_proc_id(), component,
+                        ds_buf->super.va_base, ds_buf->super.va_end,
+                        (unsigned long long)ds_buf->seg_size,
+                        (unsigned long long)(page_size >> 10),
+                        transparent ? "transparent huge" :
+                        (page_size > (size_t)opal_getpagesize() ? "huge" : "regular"),
+                        placement);
+
+    return OSHMEM_SUCCESS;
+}
@@ -27,6 +27,7 @@ typedef struct mca_sshmem_mmap_component_t {
     int priority;
     int is_anonymous;
     int is_start_addr_fixed;
+    int hugepages;
 } mca_sshmem_mmap_component_t;
 
 OSHMEM_DECLSPEC extern mca_sshmem_mmap_component_t
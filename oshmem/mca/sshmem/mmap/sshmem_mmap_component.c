@@ -121,6 +121,18 @@ mmap_register(void)
                                     OPAL_INFO_LVL_4,
                                     MCA_BASE_VAR_SCOPE_ALL_EQ,
                                     &mca_sshmem_mmap_component.is_start_addr_fixed);
+
+   mca_sshmem_mmap_component.hugepages = 0;
+   mca_base_component_var_register (&mca_sshmem_mmap_component.super.base_version,
+                                    "hugepages", "Pages backing the symmetric heap "
+                                    "[0 - regular pages, 1 - huge pages (MAP_HUGETLB), "
+                                    "2 - transparent huge pages (madvise), -1 - huge pages "
+                                    "if available, regular pages otherwise] (default: 0)",
+                                    MCA_BASE_VAR_TYPE_INT,
+                                    NULL, 0, MCA_BASE_VAR_FLAG_SETTABLE,
+                                    OPAL_INFO_LVL_4,
+                                    MCA_BASE_VAR_SCOPE_ALL_EQ,
+                                    &mca_sshmem_mmap_component.hugepages);
     return OSHMEM_SUCCESS;
 }
 
@@ -38,6 +38,7 @@
 #include "opal/util/output.h"
 #include "opal/util/path.h"
 #include "opal/util/show_help.h"
+#include "opal/util/sys_limits.h"
 
 #include "oshmem/proc/proc.h"
 #include "oshmem/mca/sshmem/sshmem.h"
@@ -96,7 +97,13 @@ mca_sshmem_mmap_module_t mca_sshmem_mmap_module = {
 static int
 module_init(void)
 {
-    /* nothing to do */
+#if defined(MAP_HUGETLB)
+    /* MAP_HUGETLB needs a heap that starts and ends on a huge page boundary */
+    if ((1 == mca_sshmem_mmap_component.hugepages) ||
+        (-1 == mca_sshmem_mmap_component.hugepages)) {
+        mca_sshmem_base_hugepage_align = mca_sshmem_base_get_hugepage_size();
+    }
+#endif
     return OSHMEM_SUCCESS;
 }
 
@@ -109,6 +116,35 @@ module_finalize(void)
 }
 
 
+/*
+ * mmap() flags backing the segment with huge pages. The segment replaces
+ * the region reserved by memheap, so huge pages are only usable when the
+ * region starts and ends on a huge page boundary.
+ */
+static int
+hugepage_flags(size_t size, size_t *page_size)
+{
+#if defined(MAP_HUGETLB)
+    size_t hp_size = mca_sshmem_base_get_hugepage_size();
+    int flags = MAP_HUGETLB;
+
+    if (((uintptr_t)mca_sshmem_base_start_address % hp_size) || (size % hp_size)) {
+        return 0;
+    }
+
+#if defined(MAP_HUGE_SHIFT)
+    if (0 != mca_sshmem_base_hugepage_size) {
+        flags |= mca_sshmem_base_get_hugepage_shift(hp_size) << MAP_HUGE_SHIFT;
+    }
+#endif
+
+    *page_size = hp_size;
+    return flags;
+#else
+    return 0;
+#endif
+}
+
 static int
 segment_create(map_segment_t *ds_buf,
                const char *file_name,
@@ -116,6 +152,10 @@ segment_create(map_segment_t *ds_buf,
 {
     int rc = OSHMEM_SUCCESS;
     void *addr = NULL;
+    int try_hp;
+    int hp_flags = 0;
+    size_t page_size;
+    bool transparent = false;
 
     assert(ds_buf);
 
@@ -126,6 +166,23 @@ segment_create(map_segment_t *ds_buf,
     /* init the contents of map_segment_t */
     shmem_ds_reset(ds_buf);
 
+    page_size = (size_t)opal_getpagesize();
+    try_hp = mca_sshmem_mmap_component.hugepages;
+    if ((1 == try_hp) || (-1 == try_hp)) {
+        hp_flags = hugepage_flags(size, &page_size);
+        if ((0 == hp_flags) && (1 == try_hp)) {
+            opal_show_help("help-oshmem-sshmem-mmap.txt",
+                           "mmap:hugepages unavailable",
+                           true,
+                           ompi_process_info.nodename,
+                           (unsigned long long) mca_sshmem_base_get_hugepage_size(),
+                           mca_sshmem_base_start_address,
+                           (unsigned long long) size);
+            return OSHMEM_ERR_NOT_AVAILABLE;
+        }
+    }
+
+retry_alloc:
     addr = mmap((void *)mca_sshmem_base_start_address,
                 size,
                 PROT_READ | PROT_WRITE,
@@ -133,10 +190,23 @@ segment_create(map_segment_t *ds_buf,
 #if defined(MAP_ANONYMOUS)
                 MAP_ANONYMOUS |
 #endif
-                MAP_FIXED,
+                MAP_FIXED | hp_flags,
                 -1,
                 0);
 
+    if ((MAP_FAILED == addr) && (0 != hp_flags) && (-1 == try_hp)) {
+        /* hugepage alloc was set to auto. Hopefully it failed because there are no
+         * enough hugepages on the system. Turn it off and retry.
+         */
+        OPAL_OUTPUT_VERBOSE(
+                (10, oshmem_sshmem_base_framework.framework_output,
+                 "failed to allocate %llu bytes with huge pages. "
+                 "Using regular pages", (unsigned long long)size));
+        hp_flags = 0;
+        page_size = (size_t)opal_getpagesize();
+        goto retry_alloc;
+    }
+
     if (MAP_FAILED == addr) {
         opal_show_help("help-oshmem-sshmem.txt",
                 "create segment failure",
@@ -150,6 +220,20 @@ segment_create(map_segment_t *ds_buf,
         return OSHMEM_ERR_OUT_OF_RESOURCE;
     }
 
+#if defined(MADV_HUGEPAGE)
+    if (2 == try_hp) {
+        if (0 == madvise(addr, size, MADV_HUGEPAGE)) {
+            page_size = mca_sshmem_base_get_hugepage_size();
+            transparent = true;
+        } else {
+            OPAL_OUTPUT_VERBOSE(
+                    (10, oshmem_sshmem_base_framework.framework_output,
+                     "madvise(MADV_HUGEPAGE) failed: %s. Using regular pages",
+                     strerror(errno)));
+        }
+    }
+#endif
+
     ds_buf->type = MAP_SEGMENT_ALLOC_MMAP;
     if (mca_sshmem_mmap_component.is_anonymous) {
         /*
@@ -168,6 +252,8 @@ segment_create(map_segment_t *ds_buf,
     ds_buf->seg_size      = size;
     ds_buf->super.va_end  = (void*)((uintptr_t)ds_buf->super.va_base + ds_buf->seg_size);
 
+    mca_sshmem_base_segment_place(ds_buf, "mmap", page_size, transparent);
+
     OPAL_OUTPUT_VERBOSE(
           (70, oshmem_sshmem_base_framework.framework_output,
            "%s: %s: create %s "
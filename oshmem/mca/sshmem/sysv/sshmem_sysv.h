@@ -38,7 +38,7 @@ typedef struct mca_sshmem_sysv_module_t {
 } mca_sshmem_sysv_module_t;
 extern mca_sshmem_sysv_module_t mca_sshmem_sysv_module;
 
-OSHMEM_DECLSPEC extern size_t sshmem_sysv_gethugepagesize(void);
+OSHMEM_DECLSPEC extern int sshmem_sysv_hugepage_flags(void);
 
 END_C_DECLS
 
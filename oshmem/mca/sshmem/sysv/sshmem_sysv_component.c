@@ -112,8 +112,8 @@ sysv_runtime_query(mca_base_module_t **module,
 
 #if defined (SHM_HUGETLB)
     if (mca_sshmem_sysv_component.use_hp != 0) {
-         flags = IPC_CREAT | IPC_EXCL | S_IRUSR | S_IWUSR | SHM_HUGETLB;
-        if (-1 == (shmid = shmget(IPC_PRIVATE, sshmem_sysv_gethugepagesize(), flags))) {
+        flags = IPC_CREAT | IPC_EXCL | S_IRUSR | S_IWUSR | sshmem_sysv_hugepage_flags();
+        if (-1 == (shmid = shmget(IPC_PRIVATE, mca_sshmem_base_get_hugepage_size(), flags))) {
             if (mca_sshmem_sysv_component.use_hp == 1) {
                 mca_sshmem_sysv_component.use_hp = 0;
                 ret = OSHMEM_ERR_NOT_AVAILABLE;
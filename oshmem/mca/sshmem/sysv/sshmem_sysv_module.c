@@ -93,7 +93,12 @@ mca_sshmem_sysv_module_t mca_sshmem_sysv_module = {
 static int
 module_init(void)
 {
-    /* nothing to do */
+#if defined (SHM_HUGETLB)
+    /* SHM_HUGETLB segments are attached on a huge page boundary */
+    if (0 != mca_sshmem_sysv_component.use_hp) {
+        mca_sshmem_base_hugepage_align = mca_sshmem_base_get_hugepage_size();
+    }
+#endif
     return OSHMEM_SUCCESS;
 }
 
@@ -117,6 +122,7 @@ segment_create(map_segment_t *ds_buf,
     int shmid = MAP_SEGMENT_SHM_INVALID;
     int flags;
     int try_hp;
+    size_t page_size;
 
     assert(ds_buf);
 
@@ -136,9 +142,13 @@ segment_create(map_segment_t *ds_buf,
      */
     flags = IPC_CREAT | IPC_EXCL | S_IRUSR | S_IWUSR;
     try_hp = mca_sshmem_sysv_component.use_hp;
+    page_size = (size_t)opal_getpagesize();
 #if defined (SHM_HUGETLB)
-    flags |= ((0 != try_hp) ? SHM_HUGETLB : 0);
-    size = ((size + sshmem_sysv_gethugepagesize() - 1) / sshmem_sysv_gethugepagesize()) * sshmem_sysv_gethugepagesize();
+    flags |= ((0 != try_hp) ? sshmem_sysv_hugepage_flags() : 0);
+    size = ((size + mca_sshmem_base_get_hugepage_size() - 1) / mca_sshmem_base_get_hugepage_size()) * mca_sshmem_base_get_hugepage_size();
+    if (0 != try_hp) {
+        page_size = mca_sshmem_base_get_hugepage_size();
+    }
 #endif
 
     /* Create a new shared memory segment and save the shmid. */
@@ -155,6 +165,7 @@ retry_alloc:
                      "Using regular pages", (unsigned long long)size));
             flags = IPC_CREAT | IPC_EXCL | S_IRUSR | S_IWUSR;
             try_hp = 0;
+            page_size = (size_t)opal_getpagesize();
             goto retry_alloc;
         }
         opal_show_help("help-oshmem-sshmem.txt",
@@ -194,6 +205,8 @@ retry_alloc:
     ds_buf->seg_size = size;
     ds_buf->super.va_end = (void*)((uintptr_t)ds_buf->super.va_base + ds_buf->seg_size);
 
+    mca_sshmem_base_segment_place(ds_buf, "sysv", page_size, false);
+
     OPAL_OUTPUT_VERBOSE(
           (70, oshmem_sshmem_base_framework.framework_output,
            "%s: %s: create %s "
@@ -300,36 +313,22 @@ segment_unlink(map_segment_t *ds_buf)
     return OSHMEM_SUCCESS;
 }
 
+#if defined (SHM_HUGETLB)
 /*
- * Get current huge page size
- *
+ * shmget() flags selecting the huge page size requested with
+ * sshmem_base_hugepage_size, the kernel uses its default size otherwise
  */
-size_t sshmem_sysv_gethugepagesize(void)
+int sshmem_sysv_hugepage_flags(void)
 {
-    static size_t huge_page_size = 0;
-    char buf[256];
-    int size_kb;
-    FILE *f;
-
-    /* Cache the huge page size value */
-    if (huge_page_size == 0) {
-        f = fopen("/proc/meminfo", "r");
-        if (f != NULL) {
-            while (fgets(buf, sizeof(buf), f)) {
-                if (sscanf(buf, "Hugepagesize: %d kB", &size_kb) == 1) {
-                    huge_page_size = size_kb * 1024L;
-                    break;
-                }
-            }
-            fclose(f);
-        }
+    int flags = SHM_HUGETLB;
 
-        if (huge_page_size == 0) {
-            huge_page_size = 2 * 1024L *1024L;
-        }
+#if defined (SHM_HUGE_SHIFT)
+    if (0 != mca_sshmem_base_hugepage_size) {
+        flags |= mca_sshmem_base_get_hugepage_shift(mca_sshmem_base_hugepage_size)
+                 << SHM_HUGE_SHIFT;
     }
+#endif
 
-    return huge_page_size;
+    return flags;
 }
-
-
+#endif
@@ -2,7 +2,7 @@
 
 set -u
 
-echo "ompi version with AVX512 -- Usage: arg1: count of elements, args2: 'i'|'u'|'f'|'d' : datatype: signed, unsigned, float, double. args3 size of type. args4 operation"
+echo "ompi version with AVX512 -- Usage: arg1: count of elements, args2: 'i'|'u'|'f'|'d'|'h'|'b' : datatype: signed, unsigned, float, double, half, bfloat16. args3 size of type. args4 operation"
 mpirun="mpirun --mca pml ob1 --mca btl vader,self"
 # For SVE-architecture
 # echo "$mpirun -mca op_sve_hardware_available 0 -mca op_avx_hardware_available 0 -n 1 Reduce_local_float 1048576  i 8 max"
@@ -79,3 +79,30 @@ for op in max min sum prod; do
     done
 done
 
+echo "========Half precision and bfloat16 all operations========="
+echo ""
+for op in max min sum prod; do
+    for type in h b; do
+        for size in 1024 127 130; do
+            foo=$((1024 * 1024 + $size))
+            echo -e "Test $Yellow __mm512 instruction for loop $NC Total_num_bits = $foo * 16"
+            cmd="$mpirun -n 1 reduce_local -l $foo -u $foo -t $type -s 16 -o $op"
+            if test $verbose -eq 1 ; then echo $cmd; fi
+            eval $cmd
+        done
+    done
+done
+
+echo "========Pair types maxloc & minloc========="
+echo ""
+for op in maxloc minloc; do
+    for type in i f d; do
+        for size in 1024 127 130; do
+            foo=$((1024 * 1024 + $size))
+            echo -e "Test $Yellow __mm512 instruction for loop $NC Total_num_elements = $foo"
+            cmd="$mpirun -n 1 reduce_local -l $foo -u $foo -t $type -o $op"
+            if test $verbose -eq 1 ; then echo $cmd; fi
+            eval $cmd
+        done
+    done
+done
@@ -0,0 +1,434 @@
+/* -*- Mode: C; c-basic-offset:4 ; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+/*
+ * Performance harness for the datatype engine. For a set of representative
+ * layouts (contiguous, vector, indexed, subarray, struct with gaps and
+ * resized) and for message sizes growing geometrically, measure:
+ *  - pack:     throughput of opal_convertor_pack on the whole buffer
+ *  - unpack:   throughput of opal_convertor_unpack on the whole buffer
+ *  - position: cost of opal_convertor_set_position to random offsets
+ *  - raw:      cost of generating the iovec list with opal_convertor_raw
+ *  - commit:   cost of building and committing (optimizing) the layout
+ *
+ * The output is one CSV line per measurement (comments start with '#') so
+ * that successive runs can be compared mechanically.
+ */
+
+/* needed for getopt() */
+#define _POSIX_C_SOURCE 200809L
+
+#include "ompi_config.h"
+#include "ompi/datatype/ompi_datatype.h"
+#include "opal/datatype/opal_convertor.h"
+#include "opal/runtime/opal.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef HAVE_SYS_TIME_H
+#    include <sys/time.h>
+#endif
+#include <unistd.h>
+
+#define TIMER_DATA_TYPE struct timeval
+#define GET_TIME(TV)    gettimeofday(&(TV), NULL)
+#define ELAPSED_TIME(TSTART, TEND) \
+    (((TEND).tv_sec - (TSTART).tv_sec) * 1000000 + ((TEND).tv_usec - (TSTART).tv_usec))
+
+#define BENCH_OP_PACK     0x01
+#define BENCH_OP_UNPACK   0x02
+#define BENCH_OP_POSITION 0x04
+#define BENCH_OP_RAW      0x08
+#define BENCH_OP_COMMIT   0x10
+#define BENCH_OP_ALL      0x1f
+
+#define BENCH_POSITIONS 64 /* number of seeks per position measurement */
+#define BENCH_IOVECS    128 /* iovec array length for the raw measurement */
+
+static size_t min_size = 8;
+static size_t max_size = (size_t) 1 << 30;
+static size_t size_factor = 4;
+static long min_time = 100000; /* usec spent, at least, on each measurement */
+static int min_reps = 3;
+static int max_reps = 1000000;
+static int do_ops = BENCH_OP_ALL;
+static const char *only_layout = NULL;
+
+/**
+ * Layout constructors. Each one returns a committed datatype describing one
+ * element of the layout; the benchmark then uses a count of these elements
+ * to reach the requested packed size.
+ */
+static ompi_datatype_t *build_contiguous(void)
+{
+    ompi_datatype_t *dt;
+    ompi_datatype_create_contiguous(1, &ompi_mpi_double.dt, &dt);
+    ompi_datatype_commit(&dt);
+    return dt;
+}
+
+static ompi_datatype_t *build_vector(void)
+{
+    ompi_datatype_t *dt;
+    ompi_datatype_create_vector(8, 2, 3, &ompi_mpi_double.dt, &dt);
+    ompi_datatype_commit(&dt);
+    return dt;
+}
+
+static ompi_datatype_t *build_indexed(void)
+{
+    int blen[] = {1, 3, 2, 4, 1};
+    int disp[] = {0, 2, 7, 11, 17};
+    ompi_datatype_t *dt;
+
+    ompi_datatype_create_indexed(5, blen, disp, &ompi_mpi_int.dt, &dt);
+    ompi_datatype_commit(&dt);
+    return dt;
+}
+
+static ompi_datatype_t *build_subarray(void)
+{
+    int sizes[] = {8, 8, 8}, subsizes[] = {6, 6, 6}, starts[] = {1, 1, 1};
+    ompi_datatype_t *dt;
+
+    ompi_datatype_create_subarray(3, sizes, subsizes, starts, MPI_ORDER_C, &ompi_mpi_double.dt,
+                                  &dt);
+    ompi_datatype_commit(&dt);
+    return dt;
+}
+
+static ompi_datatype_t *build_struct_gaps(void)
+{
+    /* struct { char c; double d; int i; } with the natural padding */
+    int blen[] = {1, 1, 1};
+    ptrdiff_t disp[] = {0, 8, 16};
+    ompi_datatype_t *types[] = {&ompi_mpi_char.dt, &ompi_mpi_double.dt, &ompi_mpi_int.dt};
+    ompi_datatype_t *tmp, *dt;
+
+    ompi_datatype_create_struct(3, blen, disp, types, &tmp);
+    ompi_datatype_create_resized(tmp, 0, 24, &dt);
+    ompi_datatype_commit(&dt);
+    ompi_datatype_destroy(&tmp);
+    return dt;
+}
+
+static ompi_datatype_t *build_resized(void)
+{
+    ompi_datatype_t *dt;
+
+    ompi_datatype_create_resized(&ompi_mpi_double.dt, 0, 2 * sizeof(double), &dt);
+    ompi_datatype_commit(&dt);
+    return dt;
+}
+
+typedef struct {
+    const char *name;
+    ompi_datatype_t *(*build)(void);
+} bench_layout_t;
+
+static bench_layout_t layouts[] = {
+    {"contiguous", build_contiguous},
+    {"vector", build_vector},
+    {"indexed", build_indexed},
+    {"subarray", build_subarray},
+    {"struct_gaps", build_struct_gaps},
+    {"resized", build_resized},
+    {NULL, NULL},
+};
+
+static void print_result(const char *layout, const char *op, size_t bytes, size_t count,
+                         int reps, long usec, const ompi_datatype_t *dt, uint32_t iovecs)
+{
+    double per_op = (double) usec / (double) reps;
+    double mbps = (0.0 == per_op) ? 0.0 : (double) bytes / per_op;
+
+    printf("%s,%s,%zu,%zu,%d,%.3f,%.2f,%u,%u,%u\n", layout, op, bytes, count, reps, per_op, mbps,
+           (unsigned) dt->super.desc.used, (unsigned) dt->super.opt_desc.used, iovecs);
+    fflush(stdout);
+}
+
+/**
+ * Run the body until both the minimum time and the minimum number of
+ * repetitions are reached. The first execution is a warm-up and is not
+ * accounted for.
+ */
+#define BENCH_LOOP(REPS, USEC, BODY)                                                               \
+    do {                                                                                           \
+        TIMER_DATA_TYPE _start, _end;                                                              \
+        BODY;                                                                                      \
+        (REPS) = 0;                                                                                \
+        GET_TIME(_start);                                                                          \
+        do {                                                                                       \
+            BODY;                                                                                  \
+            (REPS)++;                                                                              \
+            GET_TIME(_end);                                                                        \
+            (USEC) = ELAPSED_TIME(_start, _end);                                                   \
+        } while (((REPS) < max_reps) && (((USEC) < min_time) || ((REPS) < min_reps)));             \
+    } while (0)
+
+static int bench_pack(opal_convertor_t *conv, ompi_datatype_t *dt, size_t count, char *buf,
+                      char *packed, size_t bytes)
+{
+    struct iovec iov;
+    uint32_t iov_count;
+    size_t max_data;
+
+    opal_convertor_prepare_for_send(conv, &dt->super, count, buf);
+    iov.iov_base = packed;
+    iov.iov_len = bytes;
+    iov_count = 1;
+    max_data = bytes;
+    opal_convertor_pack(conv, &iov, &iov_count, &max_data);
+    return (max_data == bytes) ? OMPI_SUCCESS : OMPI_ERROR;
+}
+
+static int bench_unpack(opal_convertor_t *conv, ompi_datatype_t *dt, size_t count, char *buf,
+                        char *packed, size_t bytes)
+{
+    struct iovec iov;
+    uint32_t iov_count;
+    size_t max_data;
+
+    opal_convertor_prepare_for_recv(conv, &dt->super, count, buf);
+    iov.iov_base = packed;
+    iov.iov_len = bytes;
+    iov_count = 1;
+    max_data = bytes;
+    opal_convertor_unpack(conv, &iov, &iov_count, &max_data);
+    return (max_data == bytes) ? OMPI_SUCCESS : OMPI_ERROR;
+}
+
+static void bench_position(opal_convertor_t *conv, ompi_datatype_t *dt, size_t count, char *buf,
+                           const size_t *positions)
+{
+    size_t position;
+
+    opal_convertor_prepare_for_send(conv, &dt->super, count, buf);
+    for (int i = 0; i < BENCH_POSITIONS; i++) {
+        position = positions[i];
+        opal_convertor_set_position(conv, &position);
+    }
+}
+
+static uint32_t bench_raw(opal_convertor_t *conv, ompi_datatype_t *dt, size_t count, char *buf,
+                          struct iovec *iov)
+{
+    uint32_t iov_count, total = 0;
+    size_t max_data;
+
+    opal_convertor_prepare_for_send(conv, &dt->super, count, buf);
+    do {
+        iov_count = BENCH_IOVECS;
+        max_data = 0;
+        if (1 == opal_convertor_raw(conv, iov, &iov_count, &max_data)) {
+            total += iov_count;
+            break;
+        }
+        total += iov_count;
+    } while (0 != iov_count);
+    return total;
+}
+
+static int bench_layout(const bench_layout_t *layout)
+{
+    ompi_datatype_t *dt;
+    opal_convertor_t *conv;
+    struct iovec iov[BENCH_IOVECS];
+    size_t positions[BENCH_POSITIONS];
+    size_t elem_size, bytes, count, last_count = 0, buf_length;
+    ptrdiff_t lb, extent;
+    char *buf, *packed;
+    long usec;
+    int reps, rc = OMPI_SUCCESS;
+    uint32_t iovecs = 0;
+
+    dt = layout->build();
+    opal_datatype_type_size(&dt->super, &elem_size);
+    ompi_datatype_get_extent(dt, &lb, &extent);
+
+    if (do_ops & BENCH_OP_COMMIT) {
+        BENCH_LOOP(reps, usec, {
+            ompi_datatype_t *tmp = layout->build();
+            ompi_datatype_destroy(&tmp);
+        });
+        print_result(layout->name, "commit", elem_size, 1, reps, usec, dt, 0);
+    }
+
+    conv = opal_convertor_create(opal_local_arch, 0);
+    for (size_t target = min_size;; target *= size_factor) {
+        if (target > max_size) {
+            if ((target / size_factor) >= max_size) {
+                break;
+            }
+            target = max_size; /* always measure the upper bound */
+        }
+        count = target / elem_size;
+        if ((0 == count) || (count == last_count) || (count > INT_MAX)) {
+            continue;
+        }
+        last_count = count;
+        bytes = count * elem_size;
+        buf_length = (count - 1) * extent + dt->super.true_ub;
+
+        buf = malloc(buf_length);
+        packed = malloc(bytes);
+        if ((NULL == buf) || (NULL == packed)) {
+            printf("# %s: skip %zu bytes (cannot allocate %zu bytes)\n", layout->name, bytes,
+                   buf_length + bytes);
+            free(buf);
+            free(packed);
+            break;
+        }
+        /* touch all pages before starting the clock */
+        memset(buf, 1, buf_length);
+        memset(packed, 0, bytes);
+
+        if (do_ops & BENCH_OP_PACK) {
+            BENCH_LOOP(reps, usec, rc |= bench_pack(conv, dt, count, buf, packed, bytes));
+            print_result(layout->name, "pack", bytes, count, reps, usec, dt, 0);
+        }
+        if (do_ops & BENCH_OP_UNPACK) {
+            BENCH_LOOP(reps, usec, rc |= bench_unpack(conv, dt, count, buf, packed, bytes));
+            print_result(layout->name, "unpack", bytes, count, reps, usec, dt, 0);
+        }
+        if (do_ops & BENCH_OP_POSITION) {
+            /* deterministic pseudo-random offsets, so runs are comparable */
+            unsigned int seed = 0x5eed;
+            for (int i = 0; i < BENCH_POSITIONS; i++) {
+                positions[i] = (size_t) rand_r(&seed) * RAND_MAX + rand_r(&seed);
+                positions[i] %= bytes;
+            }
+            BENCH_LOOP(reps, usec, bench_position(conv, dt, count, buf, positions));
+            print_result(layout->name, "position", bytes, count, reps * BENCH_POSITIONS, usec, dt,
+                         0);
+        }
+        if (do_ops & BENCH_OP_RAW) {
+            BENCH_LOOP(reps, usec, iovecs = bench_raw(conv, dt, count, buf, iov));
+            print_result(layout->name, "raw", bytes, count, reps, usec, dt, iovecs);
+        }
+
+        free(buf);
+        free(packed);
+        if (target == max_size) {
+            break;
+        }
+    }
+    OBJ_RELEASE(conv);
+    ompi_datatype_destroy(&dt);
+
+    if (OMPI_SUCCESS != rc) {
+        fprintf(stderr, "%s: the convertor did not process the expected amount of data\n",
+                layout->name);
+    }
+    return rc;
+}
+
+static void usage(const char *name)
+{
+    printf("Usage: %s [-s min_bytes] [-S max_bytes] [-f factor] [-t min_usec]\n"
+           "          [-r min_reps] [-R max_reps] [-l layout] [-o ops]\n"
+           "  ops is a combination of p(ack), u(npack), s(eek/position), r(aw), c(ommit)\n"
+           "  layouts: ",
+           name);
+    for (int i = 0; NULL != layouts[i].name; i++) {
+        printf("%s ", layouts[i].name);
+    }
+    printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+    int c, rc = OMPI_SUCCESS;
+
+    while (-1 != (c = getopt(argc, argv, "s:S:f:t:r:R:l:o:h"))) {
+        switch (c) {
+        case 's':
+            min_size = strtoull(optarg, NULL, 10);
+            break;
+        case 'S':
+            max_size = strtoull(optarg, NULL, 10);
+            break;
+        case 'f':
+            size_factor = strtoull(optarg, NULL, 10);
+            break;
+        case 't':
+            min_time = atol(optarg);
+            break;
+        case 'r':
+            min_reps = atoi(optarg);
+            break;
+        case 'R':
+            max_reps = atoi(optarg);
+            break;
+        case 'l':
+            only_layout = optarg;
+            break;
+        case 'o':
+            do_ops = 0;
+            for (const char *p = optarg; '\0' != *p; p++) {
+                switch (*p) {
+                case 'p':
+                    do_ops |= BENCH_OP_PACK;
+                    break;
+                case 'u':
+                    do_ops |= BENCH_OP_UNPACK;
+                    break;
+                case 's':
+                    do_ops |= BENCH_OP_POSITION;
+                    break;
+                case 'r':
+                    do_ops |= BENCH_OP_RAW;
+                    break;
+                case 'c':
+                    do_ops |= BENCH_OP_COMMIT;
+                    break;
+                default:
+                    usage(argv[0]);
+                    exit(-1);
+                }
+            }
+            break;
+        case 'h':
+            usage(argv[0]);
+            exit(0);
+        default:
+            usage(argv[0]);
+            exit(-1);
+        }
+    }
+    if ((0 == min_size) || (min_size > max_size) || (size_factor < 2) || (min_reps <= 0)
+        || (max_reps < min_reps)) {
+        usage(argv[0]);
+        exit(-1);
+    }
+
+    opal_init(NULL, NULL);
+    ompi_datatype_init();
+
+    printf("# layout,operation,bytes,count,repetitions,usec_per_op,MB_per_s,"
+           "desc_used,opt_desc_used,iovecs\n");
+    for (int i = 0; NULL != layouts[i].name; i++) {
+        if ((NULL != only_layout) && (0 != strcmp(only_layout, layouts[i].name))) {
+            continue;
+        }
+        rc |= bench_layout(&layouts[i]);
+    }
+
+    /* clean-ups all data allocations */
+    opal_finalize_util();
+
+    return (OMPI_SUCCESS == rc) ? 0 : 1;
+}
@@ -350,6 +350,120 @@ clean_and_return:
     return OMPI_SUCCESS;
 }
 
+#define PERIODIC_COUNT  64
+#define PERIODIC_STRIDE 48
+
+/**
+ * An array of padded structures where each array element is described
+ * independently (as a struct of structs) ends up with one entry per element
+ * in the optimized description unless the periodic pattern is folded into a
+ * loop. Check that the folding happens, and that the folded description
+ * produces exactly the same packed stream as the equivalent vector of the
+ * same structure.
+ */
+static int test_periodic_struct_array(void)
+{
+    ompi_datatype_t *tmp, *particle, *folded, *reference;
+    ompi_datatype_t *types[PERIODIC_COUNT];
+    ptrdiff_t disps[PERIODIC_COUNT] = {0, 3 * sizeof(double)};
+    int blens[PERIODIC_COUNT] = {3, 1};
+    opal_convertor_t *convertor;
+    struct iovec iov;
+    uint32_t iov_count;
+    size_t max_data, size, i;
+    char *src, *dst, *packed1, *packed2;
+    int rc = OMPI_SUCCESS;
+
+    /* struct { double pos[3]; int id; } padded to 32 bytes */
+    types[0] = &ompi_mpi_double.dt;
+    types[1] = &ompi_mpi_int.dt;
+    ompi_datatype_create_struct(2, blens, disps, types, &tmp);
+    ompi_datatype_create_resized(tmp, 0, 32, &particle);
+    OBJ_RELEASE(tmp);
+
+    for (i = 0; i < PERIODIC_COUNT; i++) {
+        blens[i] = 1;
+        disps[i] = i * PERIODIC_STRIDE; /* not contiguous, so the struct cannot merge them */
+        types[i] = particle;
+    }
+    ompi_datatype_create_struct(PERIODIC_COUNT, blens, disps, types, &folded);
+    ompi_datatype_commit(&folded);
+    ompi_datatype_create_hvector(PERIODIC_COUNT, 1, PERIODIC_STRIDE, particle, &reference);
+    ompi_datatype_commit(&reference);
+    if (outputFlags & DUMP_DATA_AFTER_COMMIT) {
+        ompi_datatype_dump(folded);
+    }
+    printf("periodic struct: description %u entries, optimized %u entries\n",
+           (unsigned) folded->super.desc.used, (unsigned) folded->super.opt_desc.used);
+    if (folded->super.opt_desc.used >= PERIODIC_COUNT) {
+        printf("periodic pattern has not been folded\n");
+        rc = OMPI_ERROR;
+    }
+
+    size = folded->super.size;
+    src = malloc(PERIODIC_COUNT * PERIODIC_STRIDE);
+    dst = malloc(PERIODIC_COUNT * PERIODIC_STRIDE);
+    packed1 = malloc(size);
+    packed2 = malloc(size);
+    for (i = 0; i < PERIODIC_COUNT * PERIODIC_STRIDE; i++) {
+        src[i] = i % 128 + 32;
+    }
+    memset(dst, 0, PERIODIC_COUNT * PERIODIC_STRIDE);
+
+    /* pack with the reference datatype in one step */
+    convertor = opal_convertor_create(remote_arch, 0);
+    opal_convertor_prepare_for_send(convertor, &(reference->super), 1, src);
+    iov.iov_base = packed1;
+    iov.iov_len = max_data = size;
+    iov_count = 1;
+    opal_convertor_pack(convertor, &iov, &iov_count, &max_data);
+    OBJ_RELEASE(convertor);
+
+    /* pack with the folded datatype in small, unaligned fragments */
+    convertor = opal_convertor_create(remote_arch, 0);
+    opal_convertor_prepare_for_send(convertor, &(folded->super), 1, src);
+    for (i = 0; i < size; i += max_data) {
+        iov.iov_base = packed2 + i;
+        iov.iov_len = max_data = (size - i) < 13 ? (size - i) : 13;
+        iov_count = 1;
+        opal_convertor_pack(convertor, &iov, &iov_count, &max_data);
+    }
+    OBJ_RELEASE(convertor);
+    if (0 != memcmp(packed1, packed2, size)) {
+        printf("packed data differ between the folded and reference datatypes\n");
+        rc = OMPI_ERROR;
+    }
+
+    /* and unpack it back in fragments */
+    convertor = opal_convertor_create(remote_arch, 0);
+    opal_convertor_prepare_for_recv(convertor, &(folded->super), 1, dst);
+    for (i = 0; i < size; i += max_data) {
+        iov.iov_base = packed2 + i;
+        iov.iov_len = max_data = (size - i) < 13 ? (size - i) : 13;
+        iov_count = 1;
+        opal_convertor_unpack(convertor, &iov, &iov_count, &max_data);
+    }
+    OBJ_RELEASE(convertor);
+    for (i = 0; i < PERIODIC_COUNT * PERIODIC_STRIDE; i++) {
+        /* only the first 28 bytes of each structure carry data */
+        char expected = ((i % PERIODIC_STRIDE) < 28) ? src[i] : 0;
+        if (dst[i] != expected) {
+            printf("unpacked data differ at byte %" PRIsize_t "\n", i);
+            rc = OMPI_ERROR;
+            break;
+        }
+    }
+
+    free(src);
+    free(dst);
+    free(packed1);
+    free(packed2);
+    OBJ_RELEASE(reference);
+    OBJ_RELEASE(folded);
+    OBJ_RELEASE(particle);
+    return rc;
+}
+
 /**
  * Main function. Call several tests and print-out the results. It try to stress the convertor
  * using difficult data-type constructions as well as strange segment sizes for the conversion.
@@ -402,6 +516,13 @@ int main(int argc, char *argv[])
     else
         printf("decode [NOT PASSED]\n");
 
+    printf("\n\n#\n * TEST PERIODIC STRUCT ARRAY\n #\n\n");
+    rc = test_periodic_struct_array();
+    if (rc == 0)
+        printf("periodic folding [PASSED]\n");
+    else
+        printf("periodic folding [NOT PASSED]\n");
+
     printf("\n\n#\n * TEST MATRIX BORDERS\n #\n\n");
     pdt = test_matrix_borders(length, 100);
     if (outputFlags & DUMP_DATA_AFTER_COMMIT) {
@@ -30,8 +30,10 @@
 #include <unistd.h>
 
 #include "mpi.h"
+#include "mpi-ext.h"
 #include "ompi/communicator/communicator.h"
 #include "ompi/datatype/ompi_datatype.h"
+#include "ompi/mca/op/base/functions.h"
 #include "ompi/runtime/mpiruntime.h"
 
 typedef struct op_name_s {
@@ -51,12 +53,28 @@ static op_name_t array_of_ops[] = {
     {"lxor", "MPI_LXOR", MPI_LXOR},
     {"bxor", "MPI_BXOR", MPI_BXOR},
     {"replace", "MPI_REPLACE", MPI_REPLACE},
+    {"maxloc", "MPI_MAXLOC", MPI_MAXLOC},
+    {"minloc", "MPI_MINLOC", MPI_MINLOC},
     {NULL, "MPI_OP_NULL", MPI_OP_NULL},
 };
-static int do_ops[12] = {
+static int do_ops[14] = {
     -1,
 }; /* index of the ops to do. Size +1 larger than the array_of_ops */
 static int verbose = 0;
+
+/* pair types used by MPI_MAXLOC and MPI_MINLOC */
+typedef struct {
+    int v;
+    int k;
+} int_int_t;
+typedef struct {
+    float v;
+    int k;
+} float_int_t;
+typedef struct {
+    double v;
+    int k;
+} double_int_t;
 static int total_errors = 0;
 
 #define max(a, b) ((a) > (b) ? (a) : (b))
@@ -180,17 +198,96 @@ do { \
     } \
     goto check_and_continue; \
 } while (0)
+/*
+ * The expected result is computed from the input and the saved copy of the inout
+ * buffer: the pair with the winning value, and the smallest index on ties.
+ */
+#define MPI_OP_LOC_TEST(OPNAME, MPIOP, MPITYPE, TYPE, INBUF, INOUT_BUF, CHECK_BUF, COUNT, TYPE_PREFIX) \
+do { \
+    const TYPE *_p1 = ((TYPE*)(INBUF)), *_p3 = ((TYPE*)(CHECK_BUF)); \
+    TYPE *_p2 = ((TYPE*)(INOUT_BUF)); \
+    skip_op_type = 0; \
+    int min_count = min((COUNT), max_shift); \
+    for(int _k = 0; _k < min_count; +_k++ ) { \
+        duration[_k] = 0.0; \
+        for(int _r = repeats; _r > 0; _r--) { \
+            memcpy(_p2, _p3, sizeof(TYPE) * (COUNT)); \
+            tstart = MPI_Wtime(); \
+            MPI_Reduce_local(_p1+_k, _p2+_k, (COUNT)-_k, (MPITYPE), (MPIOP)); \
+            tend = MPI_Wtime(); \
+            duration[_k] += (tend - tstart); \
+            if( check ) { \
+                for( i = 0; i < (COUNT)-_k; i++ ) { \
+                    TYPE _v1 = (_p1+_k)[i], _v2 = (_p2+_k)[i], _v3 = (_p3+_k)[i], _exp = _v3; \
+                    if( _v1.v OPNAME _v3.v ) _exp = _v1; \
+                    else if( (_v1.v == _v3.v) && (_v1.k < _v3.k) ) _exp.k = _v1.k; \
+                    if( (_v2.v == _exp.v) && (_v2.k == _exp.k) ) \
+                        continue; \
+                    printf("First error at alignment %d position %d ((%" TYPE_PREFIX ", %d) %s (%" TYPE_PREFIX ", %d) != (%" TYPE_PREFIX ", %d))\n", \
+                           _k, i, _v1.v, _v1.k, (#OPNAME), _v3.v, _v3.k, _v2.v, _v2.k); \
+                    correctness = 0; \
+                    break; \
+                } \
+            } \
+        } \
+    } \
+    goto check_and_continue; \
+} while (0)
+
+/*
+ * The 16 bits floating point types have no portable C type: the expected
+ * result is computed by the base implementation of the op on a copy of the
+ * inout buffer, and compared bit for bit with the result of MPI_Reduce_local
+ * (which uses the vectorized functions when an op component provides them).
+ */
+#define MPI_OP_BASE_TEST(FORTRAN_OP, MPIOP, MPITYPE, BASE_TYPE, INBUF, INOUT_BUF, CHECK_BUF, REF_BUF, COUNT) \
+do { \
+    const uint16_t *_p1 = (INBUF), *_p3 = (CHECK_BUF); \
+    uint16_t *_p2 = (INOUT_BUF), *_p4 = (REF_BUF); \
+    ompi_op_base_handler_fn_t _ref_fn = ompi_op_base_functions[(FORTRAN_OP)][(BASE_TYPE)]; \
+    MPI_Datatype _dtype = (MPITYPE); \
+    int _n; \
+    if (NULL == _ref_fn) { /* type not supported by this build */ \
+        goto check_and_continue; \
+    } \
+    skip_op_type = 0; \
+    int min_count = min((COUNT), max_shift); \
+    for(int _k = 0; _k < min_count; +_k++ ) { \
+        duration[_k] = 0.0; \
+        for(int _r = repeats; _r > 0; _r--) { \
+            memcpy(_p2, _p3, sizeof(uint16_t) * (COUNT)); \
+            tstart = MPI_Wtime(); \
+            MPI_Reduce_local(_p1+_k, _p2+_k, (COUNT)-_k, _dtype, (MPIOP)); \
+            tend = MPI_Wtime(); \
+            duration[_k] += (tend - tstart); \
+            if( check ) { \
+                memcpy(_p4, _p3, sizeof(uint16_t) * (COUNT)); \
+                _n = (COUNT) - _k; \
+                _ref_fn(_p1+_k, _p4+_k, &_n, &_dtype, NULL); \
+                for( i = 0; i < (COUNT)-_k; i++ ) { \
+                    if((_p2+_k)[i] == (_p4+_k)[i]) \
+                        continue; \
+                    printf("First error at alignment %d position %d (0x%04x %s 0x%04x: 0x%04x != 0x%04x)\n", \
+                           _k, i, (_p1+_k)[i], op, (_p3+_k)[i], (_p2+_k)[i], (_p4+_k)[i]); \
+                    correctness = 0; \
+                    break; \
+                } \
+            } \
+        } \
+    } \
+    goto check_and_continue; \
+} while (0)
 /* clang-format on */
 
 int main(int argc, char **argv)
 {
-    static void *in_buf = NULL, *inout_buf = NULL, *inout_check_buf = NULL;
+    static void *in_buf = NULL, *inout_buf = NULL, *inout_check_buf = NULL, *ref_buf = NULL;
     int count, type_size = 8, rank, size, provided, correctness = 1;
     int repeats = 1, i, c, op1_alignment = 0, res_alignment = 0;
     int max_shift = 4;
     double *duration, tstart, tend;
     bool check = true;
-    char type[5] = "uifd", *op = "sum", *mpi_type;
+    char type[7] = "uifdhb", *op = "sum", *mpi_type;
     int lower = 1, upper = 16*1024*1024, skip_op_type;
     MPI_Op mpi_op;
 
@@ -233,14 +330,13 @@ int main(int argc, char **argv)
         case 't':
             for (i = 0; i < (int) strlen(optarg); i++) {
                 if (!(('i' == optarg[i]) || ('u' == optarg[i]) || ('f' == optarg[i])
-                      || ('d' == optarg[i]))) {
-                    fprintf(
-                        stderr,
-                        "type must be i (signed int), u (unsigned int), f (float) or d (double)\n");
+                      || ('d' == optarg[i]) || ('h' == optarg[i]) || ('b' == optarg[i]))) {
+                    fprintf(stderr, "type must be i (signed int), u (unsigned int), f (float), "
+                                    "d (double), h (half) or b (bfloat16)\n");
                     exit(-1);
                 }
             }
-            strncpy(type, optarg, 4);
+            strncpy(type, optarg, sizeof(type) - 1);
             break;
         case 'o':
             build_do_ops(optarg, do_ops);
@@ -274,10 +370,14 @@ int main(int argc, char **argv)
                     " -l <number> : lower number of elements\n"
                     " -u <number> : upper number of elements\n"
                     " -s <type_size> : 8, 16, 32 or 64 bits elements\n"
-                    " -t [i,u,f,d] : type of the elements to apply the operations on\n"
+                    " -t [i,u,f,d,h,b] : type of the elements to apply the operations on\n"
+                    "           (h and b are MPIX_SHORT_FLOAT and MPIX_BFLOAT16, checked\n"
+                    "           against the base implementation of the op)\n"
                     " -r <number> : number of repetitions for each test\n"
                     " -o <op> : comma separated list of operations to execute among\n"
-                    "           sum, min, max, prod, bor, bxor, band\n"
+                    "           sum, min, max, prod, bor, bxor, band, maxloc, minloc\n"
+                    "           (maxloc and minloc use MPI_2INT, MPI_FLOAT_INT and MPI_DOUBLE_INT\n"
+                    "           for the i, f and d types)\n"
                     " -i <number> : shift on all buffers to check alignment\n"
                     " -1 <number> : (mis)alignment in elements for the first op\n"
                     " -2 <number> : (mis)alignment in elements for the result\n"
@@ -292,9 +392,11 @@ int main(int argc, char **argv)
     if (!do_ops_built) { /* not yet done, take the default */
         build_do_ops("all", do_ops);
     }
-    posix_memalign(&in_buf, 64, (upper + op1_alignment) * sizeof(double));
-    posix_memalign(&inout_buf, 64, (upper + res_alignment) * sizeof(double));
-    posix_memalign(&inout_check_buf, 64, upper * sizeof(double));
+    /* large enough for the pair types used by maxloc and minloc */
+    posix_memalign(&in_buf, 64, (upper + op1_alignment) * sizeof(double_int_t));
+    posix_memalign(&inout_buf, 64, (upper + res_alignment) * sizeof(double_int_t));
+    posix_memalign(&inout_check_buf, 64, upper * sizeof(double_int_t));
+    posix_memalign(&ref_buf, 64, upper * sizeof(uint16_t));
     duration = (double *) malloc(max_shift * sizeof(double));
 
     ompi_mpi_init(argc, argv, MPI_THREAD_SERIALIZED, &provided, false);
@@ -705,6 +807,115 @@ int main(int argc, char **argv)
                                            inout_double_for_check, count, "f");
                     }
                 }
+
+#if defined(OMPI_HAVE_MPI_EXT_SHORTFLOAT) && OMPI_HAVE_MPI_EXT_SHORTFLOAT
+                if (('h' == type[type_idx]) || ('b' == type[type_idx])) {
+                    uint16_t *in_16 = (uint16_t *) in_buf + op1_alignment,
+                             *inout_16 = (uint16_t *) inout_buf + res_alignment,
+                             *inout_16_for_check = (uint16_t *) inout_check_buf;
+                    MPI_Datatype dt16;
+                    int base_type;
+                    /* values in [0.5, 2) with both signs, so that every op rounds
+                     * without ever overflowing */
+                    if ('h' == type[type_idx]) {
+                        for (i = 0; i < count; i++) {
+                            in_16[i] = (0 == i % 3 ? 0x8000 : 0) | (0x3800 + (i * 37) % 0x800);
+                            inout_16[i] = inout_16_for_check[i] = (0 == i % 5 ? 0x8000 : 0)
+                                                                  | (0x3800 + (i * 101) % 0x800);
+                        }
+                        mpi_type = "MPIX_SHORT_FLOAT";
+                        dt16 = MPIX_SHORT_FLOAT;
+                        base_type = OMPI_OP_BASE_TYPE_SHORT_FLOAT;
+                    } else {
+                        for (i = 0; i < count; i++) {
+                            in_16[i] = (0 == i % 3 ? 0x8000 : 0) | (0x3f00 + (i * 37) % 0x100);
+                            inout_16[i] = inout_16_for_check[i] = (0 == i % 5 ? 0x8000 : 0)
+                                                                  | (0x3f00 + (i * 101) % 0x100);
+                        }
+                        mpi_type = "MPIX_BFLOAT16";
+                        dt16 = MPIX_BFLOAT16;
+                        base_type = OMPI_OP_BASE_TYPE_BFLOAT16;
+                    }
+
+                    if (0 == strcmp(op, "sum")) {
+                        MPI_OP_BASE_TEST(OMPI_OP_BASE_FORTRAN_SUM, mpi_op, dt16, base_type, in_16,
+                                         inout_16, inout_16_for_check, ref_buf, count);
+                    }
+                    if (0 == strcmp(op, "prod")) {
+                        MPI_OP_BASE_TEST(OMPI_OP_BASE_FORTRAN_PROD, mpi_op, dt16, base_type, in_16,
+                                         inout_16, inout_16_for_check, ref_buf, count);
+                    }
+                    if (0 == strcmp(op, "max")) {
+                        MPI_OP_BASE_TEST(OMPI_OP_BASE_FORTRAN_MAX, mpi_op, dt16, base_type, in_16,
+                                         inout_16, inout_16_for_check, ref_buf, count);
+                    }
+                    if (0 == strcmp(op, "min")) {
+                        MPI_OP_BASE_TEST(OMPI_OP_BASE_FORTRAN_MIN, mpi_op, dt16, base_type, in_16,
+                                         inout_16, inout_16_for_check, ref_buf, count);
+                    }
+                }
+#endif  /* OMPI_HAVE_MPI_EXT_SHORTFLOAT */
+
+                if ((0 == strcmp(op, "maxloc")) || (0 == strcmp(op, "minloc"))) {
+                    /* values repeat every few elements to exercise the tie handling */
+                    if ('i' == type[type_idx]) {
+                        int_int_t *in_2int = (int_int_t *) in_buf + op1_alignment,
+                                  *inout_2int = (int_int_t *) inout_buf + res_alignment,
+                                  *inout_2int_for_check = (int_int_t *) inout_check_buf;
+                        for (i = 0; i < count; i++) {
+                            in_2int[i].v = i % 7 - 3;
+                            in_2int[i].k = i % 11;
+                            inout_2int[i].v = inout_2int_for_check[i].v = (3 * i) % 5 - 2;
+                            inout_2int[i].k = inout_2int_for_check[i].k = count - i;
+                        }
+                        mpi_type = "MPI_2INT";
+
+                        if (0 == strcmp(op, "maxloc")) {
+                            MPI_OP_LOC_TEST(>, mpi_op, MPI_2INT, int_int_t, in_2int, inout_2int,
+                                            inout_2int_for_check, count, "d");
+                        }
+                        MPI_OP_LOC_TEST(<, mpi_op, MPI_2INT, int_int_t, in_2int, inout_2int,
+                                        inout_2int_for_check, count, "d");
+                    }
+                    if ('f' == type[type_idx]) {
+                        float_int_t *in_fi = (float_int_t *) in_buf + op1_alignment,
+                                    *inout_fi = (float_int_t *) inout_buf + res_alignment,
+                                    *inout_fi_for_check = (float_int_t *) inout_check_buf;
+                        for (i = 0; i < count; i++) {
+                            in_fi[i].v = (float) (i % 7) - 3.5f;
+                            in_fi[i].k = i % 11;
+                            inout_fi[i].v = inout_fi_for_check[i].v = (float) ((3 * i) % 5) - 1.5f;
+                            inout_fi[i].k = inout_fi_for_check[i].k = count - i;
+                        }
+                        mpi_type = "MPI_FLOAT_INT";
+
+                        if (0 == strcmp(op, "maxloc")) {
+                            MPI_OP_LOC_TEST(>, mpi_op, MPI_FLOAT_INT, float_int_t, in_fi, inout_fi,
+                                            inout_fi_for_check, count, "f");
+                        }
+                        MPI_OP_LOC_TEST(<, mpi_op, MPI_FLOAT_INT, float_int_t, in_fi, inout_fi,
+                                        inout_fi_for_check, count, "f");
+                    }
+                    if ('d' == type[type_idx]) {
+                        double_int_t *in_di = (double_int_t *) in_buf + op1_alignment,
+                                     *inout_di = (double_int_t *) inout_buf + res_alignment,
+                                     *inout_di_for_check = (double_int_t *) inout_check_buf;
+                        for (i = 0; i < count; i++) {
+                            in_di[i].v = (double) (i % 7) - 3.5;
+                            in_di[i].k = i % 11;
+                            inout_di[i].v = inout_di_for_check[i].v = (double) ((3 * i) % 5) - 1.5;
+                            inout_di[i].k = inout_di_for_check[i].k = count - i;
+                        }
+                        mpi_type = "MPI_DOUBLE_INT";
+
+                        if (0 == strcmp(op, "maxloc")) {
+                            MPI_OP_LOC_TEST(>, mpi_op, MPI_DOUBLE_INT, double_int_t, in_di,
+                                            inout_di, inout_di_for_check, count, "f");
+                        }
+                        MPI_OP_LOC_TEST(<, mpi_op, MPI_DOUBLE_INT, double_int_t, in_di, inout_di,
+                                        inout_di_for_check, count, "f");
+                    }
+                }
             check_and_continue:
                 if (!skip_op_type)
                     print_status(array_of_ops[do_ops[op_idx]].mpi_op_name, mpi_type, type_size,
@@ -719,6 +930,7 @@ int main(int argc, char **argv)
     free(in_buf);
     free(inout_buf);
     free(inout_check_buf);
+    free(ref_buf);
 
     return (0 == total_errors) ? 0 : -1;
 }
@@ -0,0 +1,96 @@
+/* -*- C -*-
+ *
+ * $HEADER$
+ *
+ * Attach a second region to a dynamic window in the middle of a passive
+ * target epoch, while small puts to the first region may still be
+ * combined and pending at the origin (osc_rdma_aggregation_limit > 0).
+ * The access to the new region refreshes the cached region table of the
+ * target before the pending puts are flushed.
+ */
+
+#include "mpi.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define COUNT 64
+
+int main(int argc, char *argv[])
+{
+    int rank, size, target, source, i, errors = 0;
+    int *first, *second;
+    MPI_Aint first_addr, second_addr, *first_addrs, *second_addrs;
+    MPI_Win win;
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    target = (rank + 1) % size;
+    source = (rank + size - 1) % size;
+
+    first = calloc(COUNT, sizeof(int));
+    second = calloc(COUNT, sizeof(int));
+    first_addrs = malloc(size * sizeof(MPI_Aint));
+    second_addrs = malloc(size * sizeof(MPI_Aint));
+
+    MPI_Win_create_dynamic(MPI_INFO_NULL, MPI_COMM_WORLD, &win);
+    MPI_Win_attach(win, first, COUNT * sizeof(int));
+    MPI_Get_address(first, &first_addr);
+    MPI_Allgather(&first_addr, 1, MPI_AINT, first_addrs, 1, MPI_AINT, MPI_COMM_WORLD);
+
+    MPI_Win_lock_all(0, win);
+
+    /* adjacent small puts, candidates for combining */
+    for (i = 0; i < COUNT / 2; i++) {
+        int value = rank * 1000 + i;
+        MPI_Put(&value, 1, MPI_INT, target, MPI_Aint_add(first_addrs[target], i * sizeof(int)),
+                1, MPI_INT, win);
+    }
+
+    /* attach a second region without closing the epoch */
+    MPI_Win_attach(win, second, COUNT * sizeof(int));
+    MPI_Get_address(second, &second_addr);
+    MPI_Allgather(&second_addr, 1, MPI_AINT, second_addrs, 1, MPI_AINT, MPI_COMM_WORLD);
+
+    for (i = 0; i < COUNT; i++) {
+        int value = rank * 1000 + 500 + i;
+        MPI_Put(&value, 1, MPI_INT, target, MPI_Aint_add(second_addrs[target], i * sizeof(int)),
+                1, MPI_INT, win);
+    }
+    for (i = COUNT / 2; i < COUNT; i++) {
+        int value = rank * 1000 + i;
+        MPI_Put(&value, 1, MPI_INT, target, MPI_Aint_add(first_addrs[target], i * sizeof(int)),
+                1, MPI_INT, win);
+    }
+
+    MPI_Win_unlock_all(win);
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    for (i = 0; i < COUNT; i++) {
+        if (first[i] != source * 1000 + i) {
+            fprintf(stderr, "[%d] first[%d] = %d, expected %d\n", rank, i, first[i], source * 1000 + i);
+            errors++;
+        }
+        if (second[i] != source * 1000 + 500 + i) {
+            fprintf(stderr, "[%d] second[%d] = %d, expected %d\n", rank, i, second[i],
+                    source * 1000 + 500 + i);
+            errors++;
+        }
+    }
+
+    MPI_Win_detach(win, second);
+    MPI_Win_detach(win, first);
+    MPI_Win_free(&win);
+
+    MPI_Allreduce(MPI_IN_PLACE, &errors, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    if (0 == rank) {
+        printf("%s\n", (0 == errors) ? "PASSED" : "FAILED");
+    }
+
+    free(first);
+    free(second);
+    free(first_addrs);
+    free(second_addrs);
+    MPI_Finalize();
+    return (0 == errors) ? 0 : 1;
+}